@@ -505,6 +505,15 @@ function(hpx_check_for_cxx17_std_variant)
   )
 endfunction()
 
+# ##############################################################################
+function(hpx_check_for_cxx17_std_experimental_simd)
+  add_hpx_config_test(
+    HPX_WITH_CXX17_STD_EXPERIMENTAL_SIMD
+    SOURCE cmake/tests/cxx17_std_experimental_simd.cpp
+    FILE ${ARGN}
+  )
+endfunction()
+
 # ##############################################################################
 function(hpx_check_for_cxx17_std_transform_scan)
   add_hpx_config_test(
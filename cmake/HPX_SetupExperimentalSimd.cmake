@@ -0,0 +1,33 @@
+# Copyright (c) 2021 The STE||AR-Group
+#
+# SPDX-License-Identifier: BSL-1.0
+# Distributed under the Boost Software License, Version 1.0. (See accompanying
+# file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+# Enable the data parallel algorithms based on the vector types provided by
+# <experimental/simd> (Parallelism TS v2). This requires C++17 and a standard
+# library implementing the TS (libstdc++ from GCC 11 or newer).
+
+if(HPX_WITH_DATAPAR_EXPERIMENTAL_SIMD)
+  if(HPX_WITH_DATAPAR_VC)
+    hpx_error(
+      "HPX_WITH_DATAPAR_VC and HPX_WITH_DATAPAR_EXPERIMENTAL_SIMD are mutually exclusive, please enable only one of them"
+    )
+  endif()
+
+  if(HPX_CXX_STANDARD LESS 17)
+    hpx_error(
+      "HPX_WITH_DATAPAR_EXPERIMENTAL_SIMD requires C++17 or newer (currently using C++${HPX_CXX_STANDARD})"
+    )
+  endif()
+
+  hpx_check_for_cxx17_std_experimental_simd(
+    REQUIRED
+      "HPX_WITH_DATAPAR_EXPERIMENTAL_SIMD requires a standard library providing <experimental/simd>"
+  )
+
+  hpx_add_config_define(HPX_HAVE_DATAPAR)
+  hpx_add_config_define(HPX_HAVE_DATAPAR_EXPERIMENTAL_SIMD)
+
+  hpx_info("Using std::experimental::simd (vectorization)")
+endif()
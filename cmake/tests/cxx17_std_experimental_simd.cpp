@@ -0,0 +1,26 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#include <experimental/simd>
+
+namespace stdx = std::experimental;
+
+int main()
+{
+    alignas(stdx::memory_alignment_v<stdx::native_simd<float>>) float
+        data[stdx::native_simd<float>::size()] = {};
+
+    stdx::native_simd<float> v(data, stdx::vector_aligned);
+    v += 1.0f;
+    v.copy_to(data, stdx::element_aligned);
+
+    return stdx::popcount(v == 1.0f) ==
+            static_cast<int>(stdx::native_simd<float>::size()) ?
+        0 :
+        1;
+}
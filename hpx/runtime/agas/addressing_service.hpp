@@ -15,7 +15,6 @@
 #include <hpx/agas/agas_fwd.hpp>
 #include <hpx/agas/gva.hpp>
 #include <hpx/agas/primary_namespace.hpp>
-#include <hpx/cache/lru_cache.hpp>
 #include <hpx/cache/statistics/local_full_statistics.hpp>
 #include <hpx/components_base/pinned_ptr.hpp>
 #include <hpx/functional/function.hpp>
@@ -24,6 +23,7 @@
 #include <hpx/naming_base/address.hpp>
 #include <hpx/naming_base/id_type.hpp>
 #include <hpx/runtime/agas/component_namespace.hpp>
+#include <hpx/runtime/agas/detail/sharded_gva_cache.hpp>
 #include <hpx/runtime/agas/locality_namespace.hpp>
 #include <hpx/runtime/agas/symbol_namespace.hpp>
 #include <hpx/runtime/parcelset_fwd.hpp>
@@ -74,17 +74,18 @@ public:
     // {{{ gva cache
     struct gva_cache_key;
 
-    typedef hpx::util::cache::lru_cache<
+    // the gva cache is split into shards, each protected by its own lock
+    typedef detail::sharded_gva_cache<
         gva_cache_key
       , gva
       , hpx::util::cache::statistics::local_full_statistics
+      , mutex_type
     > gva_cache_type;
     // }}}
 
     typedef std::set<naming::gid_type> migrated_objects_table_type;
     typedef std::map<naming::gid_type, std::int64_t> refcnt_requests_type;
 
-    mutable mutex_type gva_cache_mtx_;
     std::shared_ptr<gva_cache_type> gva_cache_;
 
     mutable mutex_type migrated_objects_mtx_;
@@ -0,0 +1,329 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/cache/lru_cache.hpp>
+#include <hpx/cache/statistics/no_statistics.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace hpx { namespace agas { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // The sharded_gva_cache splits the AGAS gva cache into a (power of two)
+    // number of independent LRU caches, each of which is protected by its own
+    // lock. This avoids all worker threads serializing on a single lock while
+    // resolving addresses.
+    //
+    // GIDs are assigned to shards in blocks of 2^block_bits consecutive ids,
+    // so that a cached range of GIDs normally lives in exactly one shard. A
+    // range crossing block boundaries is stored in every shard it overlaps,
+    // which preserves the range caching semantics: any GID inside a cached
+    // range can be resolved by looking at the single shard it maps to.
+    // Updating such a range is all-or-nothing: all shards it overlaps with
+    // are locked (in ascending order) and the update is applied to none of
+    // them if it is rejected for any of them. The number of shards is
+    // limited to max_shards, which allows to keep the set of shards touched
+    // by an update on the stack.
+    //
+    // Every logical operation is counted exactly once, in the statistics of
+    // the shard the first GID of the key maps to. Only evictions are counted
+    // by the shard they happen in, thus each evicted copy of a range stored
+    // in several shards is counted separately (as is the size of the cache).
+    //
+    // The Key type has to expose get_gid() and get_count(), just like the
+    // gva_cache_key used by the addressing_service.
+    template <typename Key, typename Entry, typename Statistics,
+        typename Mutex>
+    class sharded_gva_cache
+    {
+    public:
+        typedef Key key_type;
+        typedef Entry entry_type;
+        typedef Statistics statistics_type;
+        typedef Mutex mutex_type;
+        typedef hpx::util::cache::lru_cache<Key, Entry> cache_type;
+        typedef std::size_t size_type;
+
+        // number of low bits of a GID which are ignored when selecting the
+        // shard for it
+        static constexpr std::size_t block_bits = 12;
+
+        // maximal number of shards
+        static constexpr std::size_t max_shards = 256;
+
+    private:
+        typedef typename statistics_type::update_on_exit update_on_exit;
+        typedef std::bitset<max_shards> shard_set;
+
+        // the caches of the shards do not collect any statistics, those are
+        // maintained next to them to be able to count each operation once
+        struct shard
+        {
+            mutable mutex_type mtx_;
+            cache_type cache_;
+            statistics_type statistics_;
+        };
+        typedef hpx::util::cache_aligned_data_derived<shard> shard_type;
+
+        // Lock the given shards in ascending order (to avoid deadlocks) and
+        // unlock them on destruction
+        class shard_set_lock
+        {
+        public:
+            shard_set_lock(sharded_gva_cache& cache, shard_set const& shards)
+              : cache_(cache)
+              , shards_(shards)
+            {
+                for (std::size_t i = 0; i != cache_.num_shards_; ++i)
+                {
+                    if (shards_[i])
+                        cache_.shards_[i].mtx_.lock();
+                }
+            }
+
+            ~shard_set_lock()
+            {
+                for (std::size_t i = 0; i != cache_.num_shards_; ++i)
+                {
+                    if (shards_[i])
+                        cache_.shards_[i].mtx_.unlock();
+                }
+            }
+
+            shard_set_lock(shard_set_lock const&) = delete;
+            shard_set_lock& operator=(shard_set_lock const&) = delete;
+
+        private:
+            sharded_gva_cache& cache_;
+            shard_set const& shards_;
+        };
+
+    public:
+        explicit sharded_gva_cache(std::size_t num_shards = 1)
+          : num_shards_(1)
+        {
+            while (num_shards_ < num_shards && num_shards_ < max_shards)
+                num_shards_ <<= 1;
+            shards_.reset(new shard_type[num_shards_]);
+        }
+
+        sharded_gva_cache(sharded_gva_cache const&) = delete;
+        sharded_gva_cache& operator=(sharded_gva_cache const&) = delete;
+
+        std::size_t num_shards() const
+        {
+            return num_shards_;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Return the overall number of cached entries (an entry stored in
+        // several shards is counted once for each of those)
+        size_type size() const
+        {
+            size_type result = 0;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                std::lock_guard<mutex_type> l(shards_[i].mtx_);
+                result += shards_[i].cache_.size();
+            }
+            return result;
+        }
+
+        // Distribute the overall capacity evenly over all shards
+        void reserve(size_type max_size)
+        {
+            size_type shard_size = (max_size + num_shards_ - 1) / num_shards_;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shard_type& s = shards_[i];
+
+                std::lock_guard<mutex_type> l(s.mtx_);
+                size_type const old_size = s.cache_.size();
+                s.cache_.reserve(shard_size);
+                count_evictions(s, old_size - s.cache_.size());
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        bool get_entry(key_type const& k, key_type& realkey, entry_type& e)
+        {
+            shard_type& s = shards_[shard_index(k.get_gid())];
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            update_on_exit update(s.statistics_,
+                hpx::util::cache::statistics::method_get_entry);
+
+            if (!s.cache_.get_entry(k, realkey, e))
+            {
+                s.statistics_.got_miss();
+                return false;
+            }
+
+            s.statistics_.got_hit();
+            return true;
+        }
+
+        // Insert or update the given entry in all shards the key's range of
+        // GIDs overlaps with. Just like lru_cache::update_if, the update is
+        // rejected if f returns true for an entry already stored for the
+        // key. The update is applied either to all or to none of the shards.
+        template <typename F>
+        bool update_if(key_type const& k, entry_type const& e, F&& f)
+        {
+            shard_set const shards = shard_indices(k);
+            shard_set_lock l(*this, shards);
+
+            shard_type& home = shards_[shard_index(k.get_gid())];
+            update_on_exit update(home.statistics_,
+                hpx::util::cache::statistics::method_update_entry);
+
+            // check whether any of the shards rejects the update before
+            // modifying any of them, without touching the cached entries
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                key_type realkey;
+                if (shards[i] && shards_[i].cache_.find(k, realkey) &&
+                    f(k, realkey))
+                {
+                    return false;
+                }
+            }
+
+            if (home.cache_.holds_key(k))
+            {
+                home.statistics_.got_hit();
+            }
+            else
+            {
+                home.statistics_.got_miss();
+                home.statistics_.got_insertion();
+            }
+
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                if (!shards[i])
+                    continue;
+
+                shard_type& s = shards_[i];
+
+                size_type const old_size = s.cache_.size();
+                bool const inserted = !s.cache_.holds_key(k);
+
+                s.cache_.update_if(k, e,
+                    [](key_type const&, key_type const&) { return false; });
+
+                count_evictions(
+                    s, old_size + (inserted ? 1 : 0) - s.cache_.size());
+            }
+            return true;
+        }
+
+        template <typename Func>
+        size_type erase(Func const& ep)
+        {
+            size_type erased = 0;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shard_type& s = shards_[i];
+
+                std::lock_guard<mutex_type> l(s.mtx_);
+                update_on_exit update(s.statistics_,
+                    hpx::util::cache::statistics::method_erase_entry);
+
+                size_type const n = s.cache_.erase(ep);
+                count_evictions(s, n);
+                erased += n;
+            }
+            return erased;
+        }
+
+        void clear()
+        {
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                std::lock_guard<mutex_type> l(shards_[i].mtx_);
+                shards_[i].cache_.clear();
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Sum up the result of invoking the given function on the statistics
+        // instance of each of the shards
+        template <typename F>
+        std::uint64_t accumulate_statistics(F&& f)
+        {
+            std::uint64_t result = 0;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                std::lock_guard<mutex_type> l(shards_[i].mtx_);
+                result += f(shards_[i].statistics_);
+            }
+            return result;
+        }
+
+    private:
+        std::size_t shard_index(std::uint64_t msb, std::uint64_t block) const
+        {
+            std::uint64_t const h = (msb * 0x9e3779b97f4a7c15ull) ^ block;
+            return static_cast<std::size_t>(h & (num_shards_ - 1));
+        }
+
+        std::size_t shard_index(naming::gid_type const& gid) const
+        {
+            return shard_index(gid.get_msb(), gid.get_lsb() >> block_bits);
+        }
+
+        // Return the set of all shards the range of GIDs referred to by the
+        // given key overlaps with.
+        shard_set shard_indices(key_type const& k) const
+        {
+            naming::gid_type const first = k.get_gid();
+            std::uint64_t const first_block = first.get_lsb() >> block_bits;
+            std::uint64_t const last_block =
+                (first.get_lsb() + k.get_count()) >> block_bits;
+
+            shard_set shards;
+
+            // the range wraps around into the next msb or spans all shards
+            if (last_block < first_block ||
+                last_block - first_block >= num_shards_)
+            {
+                for (std::size_t i = 0; i != num_shards_; ++i)
+                    shards.set(i);
+                return shards;
+            }
+
+            for (std::uint64_t block = first_block; block <= last_block;
+                 ++block)
+            {
+                shards.set(shard_index(first.get_msb(), block));
+            }
+            return shards;
+        }
+
+        static void count_evictions(shard_type& s, size_type count)
+        {
+            while (count-- != 0)
+                s.statistics_.got_eviction();
+        }
+
+    private:
+        std::size_t num_shards_;
+        std::unique_ptr<shard_type[]> shards_;
+    };
+}}}
@@ -15,6 +15,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <vector>
 
 #include <hpx/config/warnings_prefix.hpp>
 
@@ -44,6 +45,19 @@ namespace hpx { namespace threads {
             performance_counters::counter_info const& info, error_code& ec);
 #endif
 
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+        typedef std::vector<std::int64_t> (
+            threadmanager::*threadmanager_histogram_func)(bool reset);
+        typedef std::vector<std::int64_t> (
+            thread_pool_base::*threadpool_histogram_func)(
+            std::size_t num_thread, bool reset);
+
+        naming::gid_type latency_histogram_counter_creator(threadmanager* tm,
+            threadmanager_histogram_func total_func,
+            threadpool_histogram_func pool_func,
+            performance_counters::counter_info const& info, error_code& ec);
+#endif
+
         naming::gid_type locality_pool_thread_no_total_counter_creator(
             threadmanager* tm, threadpool_counter_func pool_func,
             performance_counters::counter_info const& info, error_code& ec);
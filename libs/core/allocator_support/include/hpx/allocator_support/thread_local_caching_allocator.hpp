@@ -0,0 +1,141 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/allocator_support/internal_allocator.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// The thread local caching allocator serves small single-object allocations
+// (shared states, continuations) from size-class free lists kept per
+// OS-thread, i.e. per worker thread. Freed blocks are put on the free list of
+// the thread which releases them, surplus blocks are exchanged in batches
+// with global per size-class lists. Larger, over-aligned or array allocations
+// are passed through to the internal allocator. The caches are bypassed
+// altogether if HPX was configured for sanitizers or Valgrind, to not hide
+// memory errors from these tools.
+namespace hpx { namespace util {
+    namespace detail {
+        // maximal size of the objects served from the thread local caches
+        HPX_STATIC_CONSTEXPR std::size_t thread_local_cache_max_size = 1024;
+
+        HPX_CORE_EXPORT void* thread_local_cache_allocate(std::size_t size);
+        HPX_CORE_EXPORT void thread_local_cache_deallocate(
+            void* p, std::size_t size) noexcept;
+
+        template <typename T>
+        struct is_thread_local_cacheable
+          : std::integral_constant<bool,
+#if defined(HPX_HAVE_SANITIZERS) || defined(HPX_HAVE_VALGRIND)
+                false
+#else
+                sizeof(T) <= thread_local_cache_max_size &&
+                    alignof(T) <= alignof(std::max_align_t)
+#endif
+                >
+        {
+        };
+    }    // namespace detail
+
+    // Number of allocations served from (hits) or not served from (misses)
+    // the thread local caches, exposed as performance counters
+    HPX_CORE_EXPORT std::int64_t get_thread_local_cache_hit_count(bool reset);
+    HPX_CORE_EXPORT std::int64_t get_thread_local_cache_miss_count(bool reset);
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T = int>
+    struct thread_local_caching_allocator
+    {
+        typedef T value_type;
+        typedef T* pointer;
+        typedef const T* const_pointer;
+        typedef T& reference;
+        typedef T const& const_reference;
+        typedef std::size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+
+        template <typename U>
+        struct rebind
+        {
+            typedef thread_local_caching_allocator<U> other;
+        };
+
+        typedef std::true_type is_always_equal;
+        typedef std::true_type propagate_on_container_move_assignment;
+
+        thread_local_caching_allocator() = default;
+
+        template <typename U>
+        explicit thread_local_caching_allocator(
+            thread_local_caching_allocator<U> const&)
+        {
+        }
+
+        HPX_NODISCARD pointer allocate(size_type n, void const* = nullptr)
+        {
+            if (detail::is_thread_local_cacheable<T>::value && n == 1)
+            {
+                return static_cast<pointer>(
+                    detail::thread_local_cache_allocate(sizeof(T)));
+            }
+            return internal_allocator<T>{}.allocate(n);
+        }
+
+        void deallocate(pointer p, size_type n) noexcept
+        {
+            if (detail::is_thread_local_cacheable<T>::value && n == 1)
+            {
+                detail::thread_local_cache_deallocate(p, sizeof(T));
+                return;
+            }
+            internal_allocator<T>{}.deallocate(p, n);
+        }
+
+        size_type max_size() const noexcept
+        {
+            return (std::numeric_limits<size_type>::max)() / sizeof(T);
+        }
+
+        template <typename U, typename... Args>
+        void construct(U* p, Args&&... args)
+        {
+            ::new ((void*) p) U(std::forward<Args>(args)...);
+        }
+
+        template <typename U>
+        void destroy(U* p)
+        {
+            p->~U();
+        }
+    };
+
+    template <typename T, typename U>
+    constexpr bool operator==(thread_local_caching_allocator<T> const&,
+        thread_local_caching_allocator<U> const&)
+    {
+        return true;
+    }
+
+    template <typename T, typename U>
+    constexpr bool operator!=(thread_local_caching_allocator<T> const&,
+        thread_local_caching_allocator<U> const&)
+    {
+        return false;
+    }
+}}    // namespace hpx::util
+
+#include <hpx/config/warnings_suffix.hpp>
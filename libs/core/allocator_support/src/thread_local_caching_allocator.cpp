@@ -0,0 +1,333 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace hpx { namespace util {
+    namespace detail { namespace {
+        ///////////////////////////////////////////////////////////////////////
+        // Blocks are rounded up to a multiple of the size class granularity.
+        // Free blocks are linked through their first word, the first block
+        // of a batch of free blocks additionally holds the link to the next
+        // batch and the number of blocks in the batch.
+        constexpr std::size_t granularity = 64;
+        constexpr std::size_t num_size_classes =
+            thread_local_cache_max_size / granularity;
+
+        // maximal number of blocks held per size class and OS-thread, half of
+        // them are moved to the global list once this is exceeded
+        constexpr std::size_t max_local_blocks = 256;
+        constexpr std::size_t batch_size = max_local_blocks / 2;
+
+        // maximal number of batches held by the global list of a size class,
+        // surplus blocks are given back to the internal allocator
+        constexpr std::size_t max_global_batches = 64;
+
+        struct free_block
+        {
+            free_block* next_;
+            free_block* next_batch_;
+            std::size_t batch_count_;
+        };
+
+        static_assert(sizeof(free_block) <= granularity,
+            "the minimal block size must be able to hold a free_block");
+
+        constexpr std::size_t get_size_class(std::size_t size)
+        {
+            return (size + granularity - 1) / granularity - 1;
+        }
+
+        constexpr std::size_t get_block_size(std::size_t size_class)
+        {
+            return (size_class + 1) * granularity;
+        }
+
+        void* allocate_block(std::size_t size_class)
+        {
+            return internal_allocator<char>{}.allocate(
+                get_block_size(size_class));
+        }
+
+        void deallocate_block(void* p, std::size_t size_class) noexcept
+        {
+            internal_allocator<char>{}.deallocate(
+                static_cast<char*>(p), get_block_size(size_class));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        struct global_size_class
+        {
+            std::mutex mtx_;
+            free_block* batches_ = nullptr;
+            std::size_t num_batches_ = 0;
+        };
+
+        struct local_cache;
+
+        struct global_cache
+        {
+            global_size_class classes_[num_size_classes];
+
+            // all live thread local caches, used for collecting the counts
+            std::mutex caches_mtx_;
+            local_cache* caches_ = nullptr;
+
+            // counts of the thread local caches which have been destroyed
+            std::int64_t retired_hits_ = 0;
+            std::int64_t retired_misses_ = 0;
+
+            // counter values at the time of the last reset
+            std::int64_t reset_hits_ = 0;
+            std::int64_t reset_misses_ = 0;
+        };
+
+        // The global cache is intentionally never destroyed as blocks may
+        // still be released during static destruction.
+        global_cache& get_global_cache()
+        {
+            static global_cache* cache = new global_cache;
+            return *cache;
+        }
+
+        // Take a batch of free blocks from the global list, if any
+        free_block* pop_batch(std::size_t size_class, std::size_t& count)
+        {
+            global_size_class& c = get_global_cache().classes_[size_class];
+
+            std::lock_guard<std::mutex> l(c.mtx_);
+            free_block* batch = c.batches_;
+            if (batch != nullptr)
+            {
+                c.batches_ = batch->next_batch_;
+                --c.num_batches_;
+                count = batch->batch_count_;
+            }
+            return batch;
+        }
+
+        // Give a batch of free blocks to the global list, release it if the
+        // global list is full already
+        void push_batch(std::size_t size_class, free_block* batch,
+            std::size_t count) noexcept
+        {
+            global_size_class& c = get_global_cache().classes_[size_class];
+
+            {
+                std::lock_guard<std::mutex> l(c.mtx_);
+                if (c.num_batches_ < max_global_batches)
+                {
+                    batch->batch_count_ = count;
+                    batch->next_batch_ = c.batches_;
+                    c.batches_ = batch;
+                    ++c.num_batches_;
+                    return;
+                }
+            }
+
+            while (batch != nullptr)
+            {
+                free_block* next = batch->next_;
+                deallocate_block(batch, size_class);
+                batch = next;
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // set once the cache of the current OS-thread has been destroyed,
+        // blocks released afterwards go directly to the global lists
+        thread_local bool local_cache_destroyed = false;
+
+        struct local_cache
+        {
+            struct entry
+            {
+                free_block* free_ = nullptr;
+                std::size_t count_ = 0;
+            };
+
+            local_cache()
+            {
+                global_cache& g = get_global_cache();
+
+                std::lock_guard<std::mutex> l(g.caches_mtx_);
+                next_ = g.caches_;
+                prev_ = nullptr;
+                if (next_ != nullptr)
+                    next_->prev_ = this;
+                g.caches_ = this;
+            }
+
+            ~local_cache()
+            {
+                local_cache_destroyed = true;
+
+                for (std::size_t i = 0; i != num_size_classes; ++i)
+                {
+                    if (entries_[i].free_ != nullptr)
+                        push_batch(i, entries_[i].free_, entries_[i].count_);
+                }
+
+                global_cache& g = get_global_cache();
+
+                std::lock_guard<std::mutex> l(g.caches_mtx_);
+                if (prev_ != nullptr)
+                    prev_->next_ = next_;
+                else
+                    g.caches_ = next_;
+                if (next_ != nullptr)
+                    next_->prev_ = prev_;
+
+                g.retired_hits_ += hits_.load(std::memory_order_relaxed);
+                g.retired_misses_ += misses_.load(std::memory_order_relaxed);
+            }
+
+            // the counts are modified by the owning thread only
+            static void increment(std::atomic<std::int64_t>& count) noexcept
+            {
+                count.store(count.load(std::memory_order_relaxed) + 1,
+                    std::memory_order_relaxed);
+            }
+
+            entry entries_[num_size_classes];
+
+            std::atomic<std::int64_t> hits_{0};
+            std::atomic<std::int64_t> misses_{0};
+
+            local_cache* next_;
+            local_cache* prev_;
+        };
+
+        local_cache* get_local_cache()
+        {
+            if (local_cache_destroyed)
+                return nullptr;
+
+            static thread_local local_cache cache;
+            return &cache;
+        }
+    }}    // namespace detail::<unnamed>
+
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        void* thread_local_cache_allocate(std::size_t size)
+        {
+            std::size_t const size_class = get_size_class(size);
+
+            local_cache* cache = get_local_cache();
+            if (cache == nullptr)
+                return allocate_block(size_class);
+
+            local_cache::entry& e = cache->entries_[size_class];
+            if (e.free_ == nullptr)
+            {
+                // refill from the global list
+                std::size_t count = 0;
+                free_block* batch = pop_batch(size_class, count);
+                if (batch == nullptr)
+                {
+                    local_cache::increment(cache->misses_);
+                    return allocate_block(size_class);
+                }
+
+                e.free_ = batch;
+                e.count_ = count;
+            }
+
+            local_cache::increment(cache->hits_);
+
+            free_block* p = e.free_;
+            e.free_ = p->next_;
+            --e.count_;
+            return p;
+        }
+
+        void thread_local_cache_deallocate(void* p, std::size_t size) noexcept
+        {
+            std::size_t const size_class = get_size_class(size);
+
+            local_cache* cache = get_local_cache();
+            if (cache == nullptr)
+            {
+                deallocate_block(p, size_class);
+                return;
+            }
+
+            local_cache::entry& e = cache->entries_[size_class];
+            if (e.count_ == max_local_blocks)
+            {
+                // move a batch of blocks to the global list
+                free_block* batch = e.free_;
+                free_block* last = batch;
+                for (std::size_t i = 1; i != batch_size; ++i)
+                    last = last->next_;
+
+                e.free_ = last->next_;
+                e.count_ -= batch_size;
+                last->next_ = nullptr;
+
+                push_batch(size_class, batch, batch_size);
+            }
+
+            free_block* block = static_cast<free_block*>(p);
+            block->next_ = e.free_;
+            e.free_ = block;
+            ++e.count_;
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace {
+        template <typename F>
+        std::int64_t get_cache_count(
+            std::int64_t detail::global_cache::*retired,
+            std::int64_t detail::global_cache::*reset_value, F&& get,
+            bool reset)
+        {
+            detail::global_cache& g = detail::get_global_cache();
+
+            std::lock_guard<std::mutex> l(g.caches_mtx_);
+
+            std::int64_t count = g.*retired;
+            for (detail::local_cache* c = g.caches_; c != nullptr; c = c->next_)
+            {
+                count += get(*c).load(std::memory_order_relaxed);
+            }
+
+            std::int64_t const result = count - g.*reset_value;
+            if (reset)
+                g.*reset_value = count;
+            return result;
+        }
+    }    // namespace
+
+    std::int64_t get_thread_local_cache_hit_count(bool reset)
+    {
+        return get_cache_count(&detail::global_cache::retired_hits_,
+            &detail::global_cache::reset_hits_,
+            [](detail::local_cache& c) -> std::atomic<std::int64_t>& {
+                return c.hits_;
+            },
+            reset);
+    }
+
+    std::int64_t get_thread_local_cache_miss_count(bool reset)
+    {
+        return get_cache_count(&detail::global_cache::retired_misses_,
+            &detail::global_cache::reset_misses_,
+            [](detail::local_cache& c) -> std::atomic<std::int64_t>& {
+                return c.misses_;
+            },
+            reset);
+    }
+}}    // namespace hpx::util
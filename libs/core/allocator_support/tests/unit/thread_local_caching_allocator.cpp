@@ -0,0 +1,144 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+
+template <std::size_t N>
+struct object
+{
+    char data[N];
+};
+
+template <typename T>
+void test_reuse()
+{
+    using allocator_type = hpx::util::thread_local_caching_allocator<T>;
+    using traits = std::allocator_traits<allocator_type>;
+
+    allocator_type alloc;
+
+    // objects handed out concurrently are distinct and usable
+    std::vector<T*> objects;
+    std::set<T*> unique;
+    for (int i = 0; i != 1000; ++i)
+    {
+        T* p = traits::allocate(alloc, 1);
+        HPX_TEST(p != nullptr);
+        std::memset(p, 0xcd, sizeof(T));
+        objects.push_back(p);
+        unique.insert(p);
+    }
+    HPX_TEST_EQ(unique.size(), objects.size());
+
+    for (T* p : objects)
+    {
+        traits::deallocate(alloc, p, 1);
+    }
+
+#if !defined(HPX_HAVE_SANITIZERS) && !defined(HPX_HAVE_VALGRIND)
+    // released objects are handed out again
+    std::int64_t const hits =
+        hpx::util::get_thread_local_cache_hit_count(false);
+
+    T* p = traits::allocate(alloc, 1);
+    HPX_TEST(unique.find(p) != unique.end());
+    traits::deallocate(alloc, p, 1);
+
+    HPX_TEST_EQ(hpx::util::get_thread_local_cache_hit_count(false), hits + 1);
+#endif
+}
+
+void test_arrays()
+{
+    // arrays and large objects are not cached, but need to work nevertheless
+    hpx::util::thread_local_caching_allocator<int> alloc;
+    int* p = alloc.allocate(100);
+    std::memset(p, 0, 100 * sizeof(int));
+    alloc.deallocate(p, 100);
+
+    hpx::util::thread_local_caching_allocator<object<4096>> large_alloc;
+    object<4096>* q = large_alloc.allocate(1);
+    std::memset(q, 0, sizeof(object<4096>));
+    large_alloc.deallocate(q, 1);
+}
+
+void test_cross_thread()
+{
+    // blocks allocated on one thread may be released on another one
+    using allocator_type =
+        hpx::util::thread_local_caching_allocator<object<128>>;
+
+    std::vector<object<128>*> objects;
+    std::thread producer([&]() {
+        allocator_type alloc;
+        for (int i = 0; i != 10000; ++i)
+        {
+            objects.push_back(alloc.allocate(1));
+        }
+    });
+    producer.join();
+
+    std::thread consumer([&]() {
+        allocator_type alloc;
+        for (object<128>* p : objects)
+        {
+            alloc.deallocate(p, 1);
+        }
+    });
+    consumer.join();
+
+    // the blocks released by the consumer thread are now available to other
+    // threads through the global lists
+    std::thread user([]() {
+        allocator_type alloc;
+        std::vector<object<128>*> local_objects;
+        for (int i = 0; i != 1000; ++i)
+        {
+            local_objects.push_back(alloc.allocate(1));
+        }
+        for (object<128>* p : local_objects)
+        {
+            alloc.deallocate(p, 1);
+        }
+    });
+    user.join();
+}
+
+void test_counters()
+{
+    std::int64_t const hits = hpx::util::get_thread_local_cache_hit_count(true);
+    std::int64_t const misses =
+        hpx::util::get_thread_local_cache_miss_count(true);
+    HPX_TEST(hits >= 0);
+    HPX_TEST(misses >= 0);
+
+    // reset counters start over
+    HPX_TEST_EQ(hpx::util::get_thread_local_cache_hit_count(false), 0);
+    HPX_TEST_EQ(hpx::util::get_thread_local_cache_miss_count(false), 0);
+}
+
+int main()
+{
+    test_reuse<object<16>>();
+    test_reuse<object<64>>();
+    test_reuse<object<200>>();
+    test_reuse<object<1024>>();
+    test_arrays();
+    test_cross_thread();
+    test_counters();
+
+    return hpx::util::report_errors();
+}
@@ -9,6 +9,7 @@
 #include <hpx/config.hpp>
 #include <hpx/cache/policies/always.hpp>
 #include <hpx/cache/statistics/no_statistics.hpp>
+#include <hpx/cache/storage/linked_hash_map.hpp>
 
 #include <algorithm>
 #include <deque>
@@ -48,7 +49,9 @@ namespace hpx { namespace util { namespace cache {
     /// \tparam CacheStorage  A (optional) container type used to store the
     ///                       cache items. The container must be an associative
     ///                       and STL compatible container.The default is a
-    ///                       std::map<Key, Entry>.
+    ///                       std::map<Key, Entry>. Using a
+    ///                       \a storage#linked_hash_map selects the O(1)
+    ///                       linked storage engine (see below).
     /// \tparam Statistics    A (optional) type allowing to collect some basic
     ///                       statistics about the operation of the cache
     ///                       instance. The type must conform to the
@@ -779,4 +782,403 @@ namespace hpx { namespace util { namespace cache {
 
         statistics_type statistics_;    // embedded statistics instance
     };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief The linked storage engine of the \a local_cache.
+    ///
+    /// This specialization of \a local_cache is selected whenever a
+    /// \a storage#linked_hash_map is used as the \a CacheStorage. It keeps the
+    /// entries in a linked list which is ordered by their eviction priority,
+    /// indexed by a hash map. Cache hits, insertions, and evictions are O(1),
+    /// as opposed to the heap based engine which has to rebuild its heap
+    /// whenever an entry is touched.
+    ///
+    /// The \a UpdatePolicy has to be one of the ordering policies
+    /// \a policies#lru_order, \a policies#fifo_order, or
+    /// \a policies#lfu_order. It defines how the eviction order is changed
+    /// whenever an entry is inserted or touched. All other template
+    /// parameters have the same meaning as for the primary template.
+    template <typename Key, typename Entry, typename UpdatePolicy,
+        typename InsertPolicy, typename Hash, typename KeyEqual,
+        typename Statistics>
+    class local_cache<Key, Entry, UpdatePolicy, InsertPolicy,
+        storage::linked_hash_map<Key, Entry, Hash, KeyEqual>, Statistics>
+    {
+    public:
+        typedef Key key_type;
+        typedef Entry entry_type;
+        typedef UpdatePolicy update_policy_type;
+        typedef InsertPolicy insert_policy_type;
+        typedef storage::linked_hash_map<Key, Entry, Hash, KeyEqual>
+            storage_type;
+        typedef Statistics statistics_type;
+
+        typedef typename entry_type::value_type value_type;
+        typedef typename storage_type::size_type size_type;
+        typedef typename storage_type::value_type storage_value_type;
+
+    private:
+        typedef typename storage_type::iterator iterator;
+
+        typedef typename update_policy_type::template engine<storage_type>
+            order_engine_type;
+
+        typedef typename statistics_type::update_on_exit update_on_exit;
+
+    public:
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Construct an instance of a local_cache.
+        ///
+        /// \param max_size   [in] The maximal size this cache is allowed to
+        ///                   reach any time. The default is zero (no size
+        ///                   limitation).
+        /// \param ip         [in] An instance of the \a InsertPolicy to use for
+        ///                   this cache.
+        ///
+        local_cache(size_type max_size = 0,
+            update_policy_type const& = update_policy_type(),
+            insert_policy_type const& ip = insert_policy_type())
+          : max_size_(max_size)
+          , current_size_(0)
+          , insert_policy_(ip)
+        {
+        }
+
+        local_cache(local_cache&& other)
+          : max_size_(other.max_size_)
+          , current_size_(other.current_size_)
+          , store_(std::move(other.store_))
+          , order_(std::move(other.order_))
+          , insert_policy_(std::move(other.insert_policy_))
+          , statistics_(std::move(other.statistics_))
+        {
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Return current size of the cache.
+        size_type size() const
+        {
+            return current_size_;
+        }
+
+        /// \brief Access the maximum size the cache is allowed to grow to.
+        size_type capacity() const
+        {
+            return max_size_;
+        }
+
+        /// \brief Change the maximum size this cache can grow to, see the
+        ///        primary template for details.
+        bool reserve(size_type max_size)
+        {
+            bool retval = true;
+            if (max_size && max_size < max_size_ &&
+                !free_space(long(max_size_ - max_size)))
+            {
+                retval = false;    // not able to shrink cache
+            }
+
+            max_size_ = max_size;    // change capacity in any case
+            return retval;
+        }
+
+        /// \brief Check whether the cache currently holds an entry identified
+        ///        by the given key
+        bool holds_key(key_type const& k) const
+        {
+            return store_.find(k) != store_.end();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Get a specific entry identified by the given key, see the
+        ///        primary template for details.
+        bool get_entry(key_type const& k, key_type& realkey, entry_type& val)
+        {
+            update_on_exit update(statistics_, statistics::method_get_entry);
+
+            iterator it = find_and_touch(k);
+            if (it == store_.end())
+                return false;
+
+            realkey = (*it).first;
+            val = (*it).second;
+            return true;
+        }
+
+        bool get_entry(key_type const& k, entry_type& val)
+        {
+            update_on_exit update(statistics_, statistics::method_get_entry);
+
+            iterator it = find_and_touch(k);
+            if (it == store_.end())
+                return false;
+
+            val = (*it).second;
+            return true;
+        }
+
+        bool get_entry(key_type const& k, value_type& val)
+        {
+            update_on_exit update(statistics_, statistics::method_get_entry);
+
+            iterator it = find_and_touch(k);
+            if (it == store_.end())
+                return false;
+
+            val = (*it).second.get();
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Insert a new element into this cache, see the primary
+        ///        template for details.
+        bool insert(key_type const& k, value_type const& val)
+        {
+            entry_type e(val);
+            return insert(k, e);
+        }
+
+        bool insert(key_type const& k, entry_type& e)
+        {
+            update_on_exit update(statistics_, statistics::method_insert_entry);
+
+            // ask entry if it really wants to be inserted
+            if (!insert_policy_(e) || !e.insert())
+                return false;
+
+            // make sure cache doesn't get too large
+            size_type entry_size = e.get_size();
+            if (0 != max_size_ && current_size_ + entry_size > max_size_ &&
+                !free_space(long(current_size_ - max_size_ + entry_size)))
+            {
+                return false;
+            }
+
+            // insert new entry to cache
+            std::pair<iterator, bool> p =
+                store_.insert(storage_value_type(k, e));
+            if (!p.second)
+                return false;
+
+            current_size_ += entry_size;
+            order_.inserted(store_, p.first);
+
+            // update statistics
+            statistics_.got_insertion();
+
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Update an existing element in this cache, see the primary
+        ///        template for details.
+        ///
+        /// \note  As opposed to the primary template, updating an entry does
+        ///        not call its \a entry#touch function. The \a UpdatePolicy
+        ///        decides whether the eviction order changes.
+        bool update(key_type const& k, value_type const& val)
+        {
+            update_on_exit update(statistics_, statistics::method_update_entry);
+
+            iterator it = store_.find(k);
+            if (it == store_.end())
+            {
+                // doesn't exist in this cache
+                statistics_.got_miss();    // update statistics
+                return insert(k, val);     // insert into cache
+            }
+
+            // update cache entry, this is not counted as a use of the entry
+            (*it).second.get() = val;
+            order_.updated(store_, it);
+
+            // update statistics
+            statistics_.got_hit();
+
+            return true;
+        }
+
+        template <typename F>
+        bool update_if(key_type const& k, value_type const& val, F f)
+        {
+            update_on_exit update(statistics_, statistics::method_update_entry);
+
+            iterator it = store_.find(k);
+            if (it == store_.end())
+            {
+                // doesn't exist in this cache
+                statistics_.got_miss();    // update statistics
+                return insert(k, val);     // insert into cache
+            }
+
+            if (!f(k, (*it).first))
+                return false;
+
+            // update cache entry, this is not counted as a use of the entry
+            (*it).second.get() = val;
+            order_.updated(store_, it);
+
+            // update statistics
+            statistics_.got_hit();
+
+            return true;
+        }
+
+        bool update(key_type const& k, entry_type& e)
+        {
+            update_on_exit update(statistics_, statistics::method_update_entry);
+
+            iterator it = store_.find(k);
+            if (it == store_.end())
+            {
+                // doesn't exist in this cache
+                statistics_.got_miss();    // update statistics
+                return insert(k, e);       // insert into cache
+            }
+
+            // make sure the old entry agrees to be removed
+            if (!(*it).second.remove())
+                return false;    // entry doesn't want to be removed
+
+            // make sure the new entry agrees to be inserted
+            if (!insert_policy_(e) || !e.insert())
+                return false;    // entry doesn't want to be inserted
+
+            // replace the cache entry, this re-establishes its position in
+            // the eviction order
+            order_.erased(store_, it);
+            (*it).second = e;
+            order_.inserted(store_, it);
+
+            // update statistics
+            statistics_.got_hit();
+
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Remove stored entries from the cache for which the supplied
+        ///        function object returns true, see the primary template for
+        ///        details.
+        template <typename Func>
+        size_type erase(Func const& ep = policies::always<storage_value_type>())
+        {
+            update_on_exit update(statistics_, statistics::method_erase_entry);
+
+            size_type erased = 0;
+            for (iterator it = store_.begin(); it != store_.end(); /**/)
+            {
+                storage_value_type& val = *it;
+                if (ep(val) && val.second.remove())
+                {
+                    size_type entry_size = val.second.get_size();
+                    current_size_ -= entry_size;
+                    erased += entry_size;
+
+                    iterator sit = it++;
+                    order_.erased(store_, sit);
+                    store_.erase(sit);
+
+                    // update statistics
+                    statistics_.got_eviction();
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+
+            return erased;
+        }
+
+        size_type erase()
+        {
+            return erase(policies::always<storage_value_type>());
+        }
+
+        /// \brief Clear the cache
+        ///
+        /// Unconditionally removes all stored entries from the cache.
+        void clear()
+        {
+            store_.clear();
+            order_.clear();
+            statistics_.clear();
+            current_size_ = 0;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Allow to access the embedded statistics instance
+        statistics_type const& get_statistics() const
+        {
+            return statistics_;
+        }
+
+        statistics_type& get_statistics()
+        {
+            return statistics_;
+        }
+
+    protected:
+        ///////////////////////////////////////////////////////////////////////
+        // Locate the given key and touch the found entry
+        iterator find_and_touch(key_type const& k)
+        {
+            iterator it = store_.find(k);
+            if (it == store_.end())
+            {
+                statistics_.got_miss();    // update statistics
+                return it;                 // doesn't exist in this cache
+            }
+
+            order_.touch(store_, it);
+
+            statistics_.got_hit();    // update statistics
+            return it;
+        }
+
+        // Free some space in the cache, the entries are visited in their
+        // eviction order
+        bool free_space(long num_free)
+        {
+            if (store_.empty())
+                return false;
+
+            for (iterator it = store_.begin();
+                 num_free > 0 && it != store_.end();
+                /**/)
+            {
+                if (!(*it).second.remove())
+                {
+                    ++it;    // do not remove this entry from the cache
+                    continue;
+                }
+
+                size_type entry_size = (*it).second.get_size();
+
+                iterator sit = it++;
+                order_.erased(store_, sit);
+                store_.erase(sit);
+
+                num_free -= static_cast<long>(entry_size);
+                current_size_ -= entry_size;
+
+                // update statistics
+                statistics_.got_eviction();
+            }
+
+            return num_free <= 0;
+        }
+
+    private:
+        size_type max_size_;        // cache capacity
+        size_type current_size_;    // current cache size
+        storage_type store_;        // the cache itself
+
+        // the update policy's engine keeping the entries in eviction order
+        order_engine_type order_;
+        insert_policy_type insert_policy_;
+
+        statistics_type statistics_;    // embedded statistics instance
+    };
 }}}    // namespace hpx::util::cache
@@ -137,6 +137,31 @@ namespace hpx { namespace util { namespace cache {
             return map_.find(key) != map_.end();
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Look up the key stored in the cache for the given key
+        ///
+        /// \param key     [in] The key for the entry which should be looked up
+        ///               in the cache.
+        /// \param realkey [out] If the cache holds an entry for the key this
+        ///               value on successful return will be a copy of the key
+        ///               the entry is stored with.
+        ///
+        /// \note         This function neither calls the entry's function
+        ///               \a entry#touch nor updates the statistics, it does
+        ///               not change the order in which entries are evicted.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool find(key_type const& key, key_type& realkey) const
+        {
+            auto it = map_.find(key);
+            if (it == map_.end())
+                return false;
+
+            realkey = it->first;
+            return true;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         /// \brief Get a specific entry identified by the given key.
         ///
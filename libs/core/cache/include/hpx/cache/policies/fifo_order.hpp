@@ -0,0 +1,44 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace util { namespace cache { namespace policies {
+    ///////////////////////////////////////////////////////////////////////////
+    /// The \a fifo_order update policy is used with the linked storage engine
+    /// (see \a storage#linked_hash_map). Entries are kept in the order of
+    /// their insertion, touching an entry never changes its position. The
+    /// entry inserted first is evicted first.
+    struct fifo_order
+    {
+        template <typename Storage>
+        class engine
+        {
+            typedef typename Storage::iterator iterator;
+
+        public:
+            void inserted(Storage& s, iterator it)
+            {
+                s.splice(s.end(), it);
+            }
+
+            bool touch(Storage&, iterator it)
+            {
+                (*it).second.touch();
+                return false;
+            }
+
+            void updated(Storage&, iterator) {}
+
+            void erased(Storage&, iterator) {}
+
+            void clear() {}
+        };
+    };
+}}}}    // namespace hpx::util::cache::policies
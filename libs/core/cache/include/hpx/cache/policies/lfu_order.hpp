@@ -0,0 +1,137 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <iterator>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace util { namespace cache { namespace policies {
+    ///////////////////////////////////////////////////////////////////////////
+    /// The \a lfu_order update policy is used with the linked storage engine
+    /// (see \a storage#linked_hash_map). The entries are kept sorted by the
+    /// value returned from their \a get_access_count function (see
+    /// \a entries#lfu_entry), entries with the same count are kept in the
+    /// order they reached that count. The least frequently used entry is
+    /// evicted first. Only lookups increment the access count of an entry,
+    /// updating its value leaves its position unchanged.
+    ///
+    /// The engine remembers the last entry of each group of entries sharing
+    /// the same access count, which allows to move a touched entry to its
+    /// new position in O(1) as long as the access count is incremented in
+    /// small steps.
+    struct lfu_order
+    {
+        template <typename Storage>
+        class engine
+        {
+            typedef typename Storage::iterator iterator;
+            typedef typename std::decay<decltype(
+                std::declval<typename Storage::mapped_type const&>()
+                    .get_access_count())>::type count_type;
+
+            typedef std::unordered_map<count_type, iterator> group_map_type;
+
+            static count_type get_count(iterator it)
+            {
+                return (*it).second.get_access_count();
+            }
+
+            // remove the given entry from the group it currently belongs to
+            void unlink(Storage& s, iterator it, count_type count)
+            {
+                typename group_map_type::iterator git = last_.find(count);
+                if (git == last_.end() || git->second != it)
+                    return;
+
+                if (it != s.begin())
+                {
+                    iterator prev = std::prev(it);
+                    if (get_count(prev) == count)
+                    {
+                        git->second = prev;
+                        return;
+                    }
+                }
+                last_.erase(git);
+            }
+
+            // move the (unlinked) entry behind all entries with a count not
+            // larger than its own, starting the search at 'pos'
+            void link(Storage& s, iterator it, iterator pos)
+            {
+                count_type count = get_count(it);
+
+                typename group_map_type::iterator git = last_.find(count);
+                if (git != last_.end())
+                {
+                    pos = std::next(git->second);
+                }
+                else
+                {
+                    // skip all groups of entries with smaller counts
+                    while (pos != s.end() && pos != it &&
+                        get_count(pos) < count)
+                    {
+                        pos = std::next(last_[get_count(pos)]);
+                    }
+                }
+
+                s.splice(pos, it);
+                last_[count] = it;
+            }
+
+        public:
+            void inserted(Storage& s, iterator it)
+            {
+                s.splice(s.end(), it);
+                link(s, it, s.begin());
+            }
+
+            bool touch(Storage& s, iterator it)
+            {
+                count_type count = get_count(it);
+                if (!(*it).second.touch())
+                    return false;
+
+                unlink(s, it, count);
+
+                count_type new_count = get_count(it);
+                if (new_count < count)
+                {
+                    s.splice(s.end(), it);
+                    link(s, it, s.begin());
+                }
+                else
+                {
+                    link(s, it, std::next(it));
+                }
+                return true;
+            }
+
+            // updating the value of an entry does not count as a use
+            void updated(Storage&, iterator) {}
+
+            void erased(Storage& s, iterator it)
+            {
+                unlink(s, it, get_count(it));
+            }
+
+            void clear()
+            {
+                last_.clear();
+            }
+
+        private:
+            group_map_type last_;
+        };
+    };
+}}}}    // namespace hpx::util::cache::policies
@@ -0,0 +1,53 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace util { namespace cache { namespace policies {
+    ///////////////////////////////////////////////////////////////////////////
+    /// The \a lru_order update policy is used with the linked storage engine
+    /// (see \a storage#linked_hash_map). Newly inserted entries and entries
+    /// whose \a entry#touch function returns \a true are moved to the end of
+    /// the eviction order, thus the least recently used entry is evicted
+    /// first. Updating the value of an entry moves it to the end of the
+    /// eviction order as well.
+    struct lru_order
+    {
+        template <typename Storage>
+        class engine
+        {
+            typedef typename Storage::iterator iterator;
+
+        public:
+            void inserted(Storage& s, iterator it)
+            {
+                s.splice(s.end(), it);
+            }
+
+            bool touch(Storage& s, iterator it)
+            {
+                if (!(*it).second.touch())
+                    return false;
+
+                s.splice(s.end(), it);
+                return true;
+            }
+
+            // an updated entry becomes the most recently used one
+            void updated(Storage& s, iterator it)
+            {
+                s.splice(s.end(), it);
+            }
+
+            void erased(Storage&, iterator) {}
+
+            void clear() {}
+        };
+    };
+}}}}    // namespace hpx::util::cache::policies
@@ -0,0 +1,160 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace util { namespace cache { namespace storage {
+    ///////////////////////////////////////////////////////////////////////////
+    /// \class linked_hash_map linked_hash_map.hpp
+    ///
+    /// \brief The \a linked_hash_map is a cache storage holding its items in
+    ///        a doubly linked list (defining the eviction order of the items)
+    ///        which is indexed by a hash map. All operations (lookup,
+    ///        insertion, removal, and reordering of an item) are O(1).
+    ///
+    ///        Using this type as the \a CacheStorage of a \a local_cache
+    ///        selects the linked storage engine, which has to be combined
+    ///        with one of the ordering policies \a policies#lru_order,
+    ///        \a policies#fifo_order, or \a policies#lfu_order as its
+    ///        \a UpdatePolicy.
+    ///
+    /// \tparam Key           The type of the keys to use to identify the
+    ///                       entries stored in the cache
+    /// \tparam Entry         The type of the items to be held in the cache
+    /// \tparam Hash          The hash function used for the keys
+    /// \tparam KeyEqual      The function used to compare keys for equality
+    template <typename Key, typename Entry, typename Hash = std::hash<Key>,
+        typename KeyEqual = std::equal_to<Key>>
+    class linked_hash_map
+    {
+    public:
+        typedef Key key_type;
+        typedef Entry mapped_type;
+        typedef std::pair<Key const, Entry> value_type;
+        typedef std::size_t size_type;
+
+    private:
+        typedef std::list<value_type> list_type;
+
+    public:
+        typedef typename list_type::iterator iterator;
+        typedef typename list_type::const_iterator const_iterator;
+
+    private:
+        typedef std::unordered_map<Key, iterator, Hash, KeyEqual> index_type;
+
+    public:
+        linked_hash_map() = default;
+
+        linked_hash_map(linked_hash_map&& other) = default;
+        linked_hash_map& operator=(linked_hash_map&& other) = default;
+
+        // the index refers to the list nodes, copying would invalidate it
+        linked_hash_map(linked_hash_map const&) = delete;
+        linked_hash_map& operator=(linked_hash_map const&) = delete;
+
+        ///////////////////////////////////////////////////////////////////////
+        // The items are iterated in their eviction order: the first item is
+        // the next candidate to be evicted.
+        iterator begin()
+        {
+            return list_.begin();
+        }
+        const_iterator begin() const
+        {
+            return list_.begin();
+        }
+
+        iterator end()
+        {
+            return list_.end();
+        }
+        const_iterator end() const
+        {
+            return list_.end();
+        }
+
+        size_type size() const
+        {
+            return index_.size();
+        }
+
+        bool empty() const
+        {
+            return index_.empty();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        iterator find(key_type const& k)
+        {
+            typename index_type::iterator it = index_.find(k);
+            if (it == index_.end())
+                return list_.end();
+            return it->second;
+        }
+
+        const_iterator find(key_type const& k) const
+        {
+            typename index_type::const_iterator it = index_.find(k);
+            if (it == index_.end())
+                return list_.end();
+            return it->second;
+        }
+
+        // New items are always appended to the end of the eviction order.
+        std::pair<iterator, bool> insert(value_type const& val)
+        {
+            std::pair<typename index_type::iterator, bool> p =
+                index_.insert(typename index_type::value_type(
+                    val.first, list_.end()));
+            if (!p.second)
+                return std::make_pair(p.first->second, false);
+
+            try
+            {
+                p.first->second = list_.insert(list_.end(), val);
+            }
+            catch (...)
+            {
+                index_.erase(p.first);
+                throw;
+            }
+            return std::make_pair(p.first->second, true);
+        }
+
+        void erase(iterator it)
+        {
+            index_.erase(it->first);
+            list_.erase(it);
+        }
+
+        void clear()
+        {
+            index_.clear();
+            list_.clear();
+        }
+
+        // Move the item referred to by 'it' in front of 'pos' in the eviction
+        // order. This does not invalidate any iterators.
+        void splice(iterator pos, iterator it)
+        {
+            list_.splice(pos, list_, it);
+        }
+
+    private:
+        list_type list_;
+        index_type index_;
+    };
+}}}}    // namespace hpx::util::cache::storage
@@ -0,0 +1,145 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the heap based storage engine of the local_cache
+// with the linked (list/hash map based) storage engine for the LRU, FIFO, and
+// LFU entry types. Each test fills a cache and then performs a random mix of
+// lookups (inserting the key on a miss).
+
+#include <hpx/hpx_init.hpp>
+
+#include <hpx/cache/entries/fifo_entry.hpp>
+#include <hpx/cache/entries/lfu_entry.hpp>
+#include <hpx/cache/entries/lru_entry.hpp>
+#include <hpx/cache/local_cache.hpp>
+#include <hpx/cache/policies/fifo_order.hpp>
+#include <hpx/cache/policies/lfu_order.hpp>
+#include <hpx/cache/policies/lru_order.hpp>
+#include <hpx/cache/storage/linked_hash_map.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Entry>
+using heap_cache = hpx::util::cache::local_cache<std::uint64_t, Entry,
+    std::less<Entry>, hpx::util::cache::policies::always<Entry>,
+    std::map<std::uint64_t, Entry>>;
+
+template <typename Entry, typename UpdatePolicy>
+using linked_cache = hpx::util::cache::local_cache<std::uint64_t, Entry,
+    UpdatePolicy, hpx::util::cache::policies::always<Entry>,
+    hpx::util::cache::storage::linked_hash_map<std::uint64_t, Entry>>;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Cache>
+double run_test(std::size_t cache_size, std::vector<std::uint64_t> const& keys)
+{
+    Cache cache(cache_size);
+    for (std::uint64_t k = 0; k != cache_size; ++k)
+    {
+        cache.insert(k, k);
+    }
+
+    hpx::chrono::high_resolution_timer t;
+
+    std::uint64_t value = 0;
+    for (std::uint64_t k : keys)
+    {
+        if (!cache.get_entry(k, value))
+        {
+            cache.insert(k, k);
+        }
+    }
+
+    return t.elapsed();
+}
+
+template <typename HeapCache, typename LinkedCache>
+void compare(char const* name, std::size_t cache_size,
+    std::vector<std::uint64_t> const& keys)
+{
+    double heap_time = run_test<HeapCache>(cache_size, keys);
+    double linked_time = run_test<LinkedCache>(cache_size, keys);
+
+    std::cout << name << ": heap engine " << heap_time
+              << " [s], linked engine " << linked_time << " [s] (speedup "
+              << (heap_time / linked_time) << ")\n";
+
+    hpx::util::print_cdash_timing((std::string(name) + "Heap").c_str(),
+        heap_time);
+    hpx::util::print_cdash_timing((std::string(name) + "Linked").c_str(),
+        linked_time);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t cache_size = vm["cache_size"].as<std::size_t>();
+    std::size_t num_accesses = vm["num_accesses"].as<std::size_t>();
+    double hit_ratio = vm["hit_ratio"].as<double>();
+
+    // generate keys such that roughly the given ratio of the accesses hit
+    // the cache
+    std::mt19937_64 gen(vm["seed"].as<unsigned int>());
+    std::uniform_int_distribution<std::uint64_t> dist(0,
+        static_cast<std::uint64_t>(double(cache_size) / hit_ratio));
+
+    std::vector<std::uint64_t> keys;
+    keys.reserve(num_accesses);
+    for (std::size_t i = 0; i != num_accesses; ++i)
+    {
+        keys.push_back(dist(gen));
+    }
+
+    using namespace hpx::util::cache;
+
+    compare<heap_cache<entries::lru_entry<std::uint64_t>>,
+        linked_cache<entries::lru_entry<std::uint64_t>, policies::lru_order>>(
+        "LRU", cache_size, keys);
+    compare<heap_cache<entries::fifo_entry<std::uint64_t>>,
+        linked_cache<entries::fifo_entry<std::uint64_t>,
+            policies::fifo_order>>("FIFO", cache_size, keys);
+    compare<heap_cache<entries::lfu_entry<std::uint64_t>>,
+        linked_cache<entries::lfu_entry<std::uint64_t>, policies::lfu_order>>(
+        "LFU", cache_size, keys);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("cache_size", value<std::size_t>()->default_value(4096),
+         "capacity of the caches (default: 4096)")
+        ("num_accesses,n", value<std::size_t>()->default_value(100000),
+         "number of cache accesses to perform (default: 100000)")
+        ("hit_ratio", value<double>()->default_value(0.8),
+         "approximate ratio of cache hits (default: 0.8)")
+        ("seed", value<unsigned int>()->default_value(0),
+         "the random number generator seed to use (default: 0)")
+        ;
+    // clang-format on
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    return hpx::init(argc, argv, init_args);
+}
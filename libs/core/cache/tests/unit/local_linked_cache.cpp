@@ -0,0 +1,195 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/cache/entries/fifo_entry.hpp>
+#include <hpx/cache/entries/lfu_entry.hpp>
+#include <hpx/cache/entries/lru_entry.hpp>
+#include <hpx/cache/local_cache.hpp>
+#include <hpx/cache/policies/fifo_order.hpp>
+#include <hpx/cache/policies/lfu_order.hpp>
+#include <hpx/cache/policies/lru_order.hpp>
+#include <hpx/cache/statistics/local_statistics.hpp>
+#include <hpx/cache/storage/linked_hash_map.hpp>
+#include <hpx/hpx_main.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////////
+struct data
+{
+    data(char const* const k, char const* const v)
+      : key(k)
+      , value(v)
+    {
+    }
+
+    char const* const key;
+    char const* const value;
+};
+
+data cache_entries[] = {data("white", "255,255,255"),
+    data("yellow", "255,255,0"), data("green", "0,255,0"),
+    data("blue", "0,0,255"), data("magenta", "255,0,255"),
+    data("black", "0,0,0"), data(nullptr, nullptr)};
+
+template <typename Entry, typename UpdatePolicy>
+using linked_cache = hpx::util::cache::local_cache<std::string, Entry,
+    UpdatePolicy, hpx::util::cache::policies::always<Entry>,
+    hpx::util::cache::storage::linked_hash_map<std::string, Entry>,
+    hpx::util::cache::statistics::local_statistics>;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_lru()
+{
+    typedef hpx::util::cache::entries::lru_entry<std::string> entry_type;
+    typedef linked_cache<entry_type, hpx::util::cache::policies::lru_order>
+        cache_type;
+
+    cache_type c(3);
+
+    // insert 3 items into the cache
+    data* d = &cache_entries[0];
+    for (int i = 0; i < 3 && d->key != nullptr; ++d, ++i)
+    {
+        HPX_TEST(c.insert(d->key, d->value));
+    }
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(3), c.size());
+
+    // now touch the first item, making it the most recently used one
+    std::string white;
+    HPX_TEST(c.get_entry("white", white));
+    HPX_TEST_EQ(white, "255,255,255");
+
+    // add two more items, this evicts 'yellow' and 'green'
+    for (int i = 0; i < 2 && d->key != nullptr; ++d, ++i)
+    {
+        HPX_TEST(c.insert(d->key, d->value));
+        HPX_TEST_EQ(static_cast<cache_type::size_type>(3), c.size());
+    }
+
+    HPX_TEST(c.holds_key("white"));
+    HPX_TEST(!c.holds_key("yellow"));
+    HPX_TEST(!c.holds_key("green"));
+    HPX_TEST(c.holds_key("blue"));
+    HPX_TEST(c.holds_key("magenta"));
+
+    HPX_TEST_EQ(c.get_statistics().hits(), std::size_t(1));
+    HPX_TEST_EQ(c.get_statistics().evictions(), std::size_t(2));
+
+    // updating an entry makes it the most recently used one as well
+    HPX_TEST(c.update("white", "255,0,0"));
+    HPX_TEST(c.insert("black", "0,0,0"));
+    HPX_TEST(c.holds_key("white"));
+    HPX_TEST(!c.holds_key("blue"));
+
+    HPX_TEST(c.get_entry("white", white));
+    HPX_TEST_EQ(white, "255,0,0");
+
+    c.clear();
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(0), c.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_fifo()
+{
+    typedef hpx::util::cache::entries::fifo_entry<std::string> entry_type;
+    typedef linked_cache<entry_type, hpx::util::cache::policies::fifo_order>
+        cache_type;
+
+    cache_type c(3);
+
+    data* d = &cache_entries[0];
+    for (int i = 0; i < 3 && d->key != nullptr; ++d, ++i)
+    {
+        HPX_TEST(c.insert(d->key, d->value));
+    }
+
+    // touching does not change the eviction order
+    std::string white;
+    HPX_TEST(c.get_entry("white", white));
+
+    HPX_TEST(c.insert(d->key, d->value));
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(3), c.size());
+
+    HPX_TEST(!c.holds_key("white"));
+    HPX_TEST(c.holds_key("yellow"));
+    HPX_TEST(c.holds_key("green"));
+    HPX_TEST(c.holds_key("blue"));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_lfu()
+{
+    typedef hpx::util::cache::entries::lfu_entry<std::string> entry_type;
+    typedef linked_cache<entry_type, hpx::util::cache::policies::lfu_order>
+        cache_type;
+
+    cache_type c(3);
+
+    data* d = &cache_entries[0];
+    for (int i = 0; i < 3 && d->key != nullptr; ++d, ++i)
+    {
+        HPX_TEST(c.insert(d->key, d->value));
+    }
+
+    // white is used three times, yellow once, green never
+    std::string val;
+    for (int i = 0; i != 3; ++i)
+    {
+        HPX_TEST(c.get_entry("white", val));
+    }
+    HPX_TEST(c.get_entry("yellow", val));
+
+    // blue replaces green, the least frequently used entry
+    HPX_TEST(c.insert(d->key, d->value));
+    ++d;
+    HPX_TEST(!c.holds_key("green"));
+    HPX_TEST(c.holds_key("blue"));
+
+    // magenta replaces blue (both never used, blue is older)
+    HPX_TEST(c.insert(d->key, d->value));
+    HPX_TEST(!c.holds_key("blue"));
+    HPX_TEST(c.holds_key("magenta"));
+
+    // make magenta the most frequently used entry
+    for (int i = 0; i != 4; ++i)
+    {
+        HPX_TEST(c.get_entry("magenta", val));
+    }
+
+    // updating yellow does not count as a use, black replaces yellow
+    HPX_TEST(c.update("yellow", "255,255,128"));
+    HPX_TEST(c.update("yellow", "255,255,64"));
+    HPX_TEST(c.insert("black", "0,0,0"));
+    HPX_TEST(!c.holds_key("yellow"));
+    HPX_TEST(c.holds_key("white"));
+    HPX_TEST(c.holds_key("magenta"));
+    HPX_TEST(c.holds_key("black"));
+
+    // erasing entries keeps the order consistent
+    HPX_TEST_EQ(c.erase([](cache_type::storage_value_type const& v) {
+        return v.first == "white";
+    }),
+        static_cast<cache_type::size_type>(1));
+
+    HPX_TEST(c.insert("yellow", "255,255,0"));
+    HPX_TEST(c.insert("green", "0,255,0"));
+    HPX_TEST(!c.holds_key("black"));
+    HPX_TEST(c.holds_key("magenta"));
+    HPX_TEST(c.holds_key("yellow"));
+    HPX_TEST(c.holds_key("green"));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_lru();
+    test_fifo();
+    test_lfu();
+
+    return hpx::util::report_errors();
+}
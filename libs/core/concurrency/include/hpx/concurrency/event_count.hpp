@@ -0,0 +1,108 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#if !defined(__linux__)
+#include <condition_variable>
+#include <mutex>
+#endif
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace util {
+    ///////////////////////////////////////////////////////////////////////////
+    // An event_count allows for threads to block until some condition
+    // (checked outside of the event_count) becomes true without having to
+    // protect the condition by a mutex. A waiting thread announces its
+    // intent to wait first, then re-checks the condition, and only then
+    // blocks:
+    //
+    //      if (condition()) return;
+    //      auto key = ec.prepare_wait();
+    //      if (condition()) { ec.cancel_wait(); return; }
+    //      ec.wait(key, timeout);
+    //
+    // A notifying thread makes the condition true first and calls
+    // notify_one/notify_all afterwards. Notifying is cheap (a single atomic
+    // load) if no thread is waiting. On Linux, waiting threads block on a
+    // futex, elsewhere a mutex/condition_variable pair is used.
+    class HPX_CORE_EXPORT event_count
+    {
+    public:
+        using key_type = std::uint32_t;
+
+        event_count() = default;
+
+        event_count(event_count const&) = delete;
+        event_count& operator=(event_count const&) = delete;
+
+        // Announce the intent to wait, the returned key has to be passed to
+        // wait() or the wait has to be canceled.
+        key_type prepare_wait() noexcept
+        {
+            waiters_.fetch_add(1, std::memory_order_seq_cst);
+            return epoch_.load(std::memory_order_acquire);
+        }
+
+        // The condition became true after prepare_wait, don't wait.
+        void cancel_wait() noexcept
+        {
+            waiters_.fetch_sub(1, std::memory_order_seq_cst);
+        }
+
+        // Block until notified after prepare_wait returned the given key or
+        // until the given time has elapsed. Returns whether the thread was
+        // notified.
+        bool wait(key_type key, std::chrono::nanoseconds timeout);
+
+        // Wake up at most one of the waiting threads.
+        void notify_one() noexcept
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (waiters_.load(std::memory_order_relaxed) != 0)
+            {
+                notify(false);
+            }
+        }
+
+        // Wake up all waiting threads.
+        void notify_all() noexcept
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (waiters_.load(std::memory_order_relaxed) != 0)
+            {
+                notify(true);
+            }
+        }
+
+        // Return the number of threads currently waiting (or preparing to
+        // wait).
+        std::uint32_t num_waiters() const noexcept
+        {
+            return waiters_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        void notify(bool all) noexcept;
+
+        std::atomic<key_type> epoch_{0};
+        std::atomic<std::uint32_t> waiters_{0};
+
+#if !defined(__linux__)
+        std::mutex mtx_;
+        std::condition_variable cond_;
+#endif
+    };
+}}    // namespace hpx::util
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -0,0 +1,102 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/event_count.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+
+#if defined(__linux__)
+#include <ctime>
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#include <condition_variable>
+#include <mutex>
+#endif
+
+namespace hpx { namespace util {
+#if defined(__linux__)
+    namespace {
+        // std::atomic<std::uint32_t> is required to have the same layout as
+        // std::uint32_t for the futex to work
+        static_assert(sizeof(std::atomic<std::uint32_t>) ==
+                sizeof(std::uint32_t),
+            "std::atomic<std::uint32_t> must be layout compatible with "
+            "std::uint32_t");
+
+        void futex_wait(std::atomic<std::uint32_t>& addr, std::uint32_t value,
+            std::chrono::nanoseconds timeout)
+        {
+            struct timespec ts;
+            ts.tv_sec = static_cast<time_t>(timeout.count() / 1000000000);
+            ts.tv_nsec = static_cast<long>(timeout.count() % 1000000000);
+
+            // returns immediately if the value has changed already,
+            // spurious wakeups are handled by the caller
+            ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&addr),
+                FUTEX_WAIT_PRIVATE, value, &ts, nullptr, 0);
+        }
+
+        void futex_wake(std::atomic<std::uint32_t>& addr, int count)
+        {
+            ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&addr),
+                FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+        }
+    }    // namespace
+
+    bool event_count::wait(key_type key, std::chrono::nanoseconds timeout)
+    {
+        if (timeout.count() > 0)
+        {
+            futex_wait(epoch_, key, timeout);
+        }
+
+        waiters_.fetch_sub(1, std::memory_order_seq_cst);
+        return epoch_.load(std::memory_order_acquire) != key;
+    }
+
+    void event_count::notify(bool all) noexcept
+    {
+        epoch_.fetch_add(1, std::memory_order_acq_rel);
+        futex_wake(epoch_, all ? INT_MAX : 1);
+    }
+#else
+    bool event_count::wait(key_type key, std::chrono::nanoseconds timeout)
+    {
+        {
+            std::unique_lock<std::mutex> l(mtx_);
+            cond_.wait_for(l, timeout, [&]() {
+                return epoch_.load(std::memory_order_acquire) != key;
+            });
+        }
+
+        waiters_.fetch_sub(1, std::memory_order_seq_cst);
+        return epoch_.load(std::memory_order_acquire) != key;
+    }
+
+    void event_count::notify(bool all) noexcept
+    {
+        {
+            // the epoch is modified while holding the lock to avoid for the
+            // notification to get lost between the waiting thread checking
+            // the epoch and starting to wait
+            std::lock_guard<std::mutex> l(mtx_);
+            epoch_.fetch_add(1, std::memory_order_acq_rel);
+        }
+
+        if (all)
+            cond_.notify_all();
+        else
+            cond_.notify_one();
+    }
+#endif
+}}    // namespace hpx::util
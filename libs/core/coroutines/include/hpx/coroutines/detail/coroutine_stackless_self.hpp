@@ -12,6 +12,7 @@
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/coroutines/thread_id_type.hpp>
 #include <hpx/functional/function.hpp>
+#include <hpx/modules/errors.hpp>
 
 #include <cstddef>
 #include <exception>
@@ -37,7 +38,10 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
         arg_type yield_impl(result_type) override
         {
             // stackless coroutines don't support suspension
-            HPX_ASSERT(false);
+            HPX_THROW_EXCEPTION(invalid_status,
+                "coroutine_stackless_self::yield_impl",
+                "a thread created without a stack "
+                "(thread_stacksize::nostack) can't be suspended");
             return threads::thread_restart_state::abort;
         }
 
@@ -55,6 +55,8 @@
 #include <sys/param.h>
 
 #include <stdexcept>
+
+#include <hpx/coroutines/detail/stack_pool.hpp>
 #endif
 
 #if defined(__FreeBSD__)
@@ -79,6 +81,13 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
 
         inline void* alloc_stack(std::size_t size)
         {
+#if defined(HPX_HAVE_THREAD_STACK_POOL)
+            if (use_stack_pool)
+            {
+                return stack_pool::allocate(size);
+            }
+#endif
+
             void* real_stack = ::mmap(nullptr, size + EXEC_PAGESIZE,
                 PROT_EXEC | PROT_READ | PROT_WRITE,
 #if defined(__APPLE__)
@@ -153,6 +162,14 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
 
         inline void free_stack(void* stack, std::size_t size)
         {
+#if defined(HPX_HAVE_THREAD_STACK_POOL)
+            if (use_stack_pool)
+            {
+                stack_pool::deallocate(stack, size);
+                return;
+            }
+#endif
+
 #if defined(HPX_HAVE_THREAD_GUARD_PAGE)
             if (use_guard_pages)
             {
@@ -0,0 +1,70 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if (defined(__linux) || defined(linux) || defined(__linux__) ||               \
+    defined(__FreeBSD__) || defined(__APPLE__)) &&                             \
+    defined(HPX_HAVE_THREAD_STACK_MMAP)
+#include <unistd.h>
+
+#if defined(_POSIX_MAPPED_FILES) && _POSIX_MAPPED_FILES > 0
+#define HPX_HAVE_THREAD_STACK_POOL
+#endif
+#endif
+
+#include <cstddef>
+#include <cstdint>
+
+///////////////////////////////////////////////////////////////////////////////
+// The stack pool is a process-wide cache of coroutine stacks used by
+// posix::alloc_stack/free_stack if enabled (hpx.stacks.use_pool). Stacks are
+// carved from large mappings and are never unmapped. Freed stacks are first
+// kept in a small per OS-thread cache (keeping them local to the core, and
+// thus the NUMA domain, which used them last) and are returned to a global
+// per-size list otherwise. The memory of idle stacks beyond
+// hpx.stacks.pool_max_idle is released lazily (madvise(MADV_DONTNEED)) by
+// trim() while their address range stays reserved. If hpx.stacks.pool_prefault
+// is set, all pages of a stack not backed by memory are touched before it is
+// handed out.
+//
+// HPX_HAVE_THREAD_STACK_POOL is defined on the platforms the pool is available
+// on.
+#if defined(HPX_HAVE_THREAD_STACK_POOL)
+namespace hpx { namespace threads { namespace coroutines { namespace detail {
+    namespace posix {
+        // these global variables are set from the runtime configuration
+        // before the first HPX thread is created
+        HPX_CORE_EXPORT extern bool use_stack_pool;
+        HPX_CORE_EXPORT extern bool use_huge_pages;
+        HPX_CORE_EXPORT extern bool stack_pool_prefault;
+        HPX_CORE_EXPORT extern std::size_t stack_pool_max_idle;
+
+        namespace stack_pool {
+            // Return a stack of the given size (a multiple of the page size).
+            // A (possibly protected) guard page is located directly below the
+            // returned address.
+            HPX_CORE_EXPORT void* allocate(std::size_t size);
+
+            // Give back a stack previously returned from allocate()
+            HPX_CORE_EXPORT void deallocate(void* stack, std::size_t size);
+
+            // Release the memory of the least recently used idle stacks in
+            // excess of stack_pool_max_idle. This is invoked by idle worker
+            // threads, it skips size classes which are busy and releases the
+            // memory without holding any lock.
+            HPX_CORE_EXPORT void trim();
+
+            // Pool occupancy, exposed as performance counters
+            HPX_CORE_EXPORT std::int64_t get_in_use_count(bool reset);
+            HPX_CORE_EXPORT std::int64_t get_idle_count(bool reset);
+            HPX_CORE_EXPORT std::int64_t get_mapped_bytes(bool reset);
+            HPX_CORE_EXPORT std::int64_t get_release_count(bool reset);
+        }    // namespace stack_pool
+}}}}}    // namespace hpx::threads::coroutines::detail::posix
+#endif
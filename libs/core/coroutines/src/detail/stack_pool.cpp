@@ -0,0 +1,456 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/detail/stack_pool.hpp>
+
+#if defined(HPX_HAVE_THREAD_STACK_POOL)
+#include <hpx/assert.hpp>
+#include <hpx/coroutines/detail/posix_utility.hpp>
+
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+
+#include <sys/mman.h>
+
+namespace hpx { namespace threads { namespace coroutines { namespace detail {
+    namespace posix {
+        ///////////////////////////////////////////////////////////////////////
+        HPX_CORE_EXPORT bool use_stack_pool = false;
+        HPX_CORE_EXPORT bool use_huge_pages = false;
+        HPX_CORE_EXPORT bool stack_pool_prefault = false;
+        HPX_CORE_EXPORT std::size_t stack_pool_max_idle = 1024;
+
+        namespace stack_pool {
+            ///////////////////////////////////////////////////////////////////
+            // Idle stacks are linked through the first word of their topmost
+            // page. This page is never released (see trim), and the context
+            // will overwrite the link with the watermark when the stack is
+            // handed out again.
+            struct idle_stack
+            {
+                idle_stack* next;
+            };
+
+            inline idle_stack* as_idle(void* stack, std::size_t size)
+            {
+                return reinterpret_cast<idle_stack*>(
+                    static_cast<char*>(stack) + size - EXEC_PAGESIZE);
+            }
+
+            inline void* as_stack(idle_stack* p, std::size_t size)
+            {
+                return reinterpret_cast<char*>(p) + EXEC_PAGESIZE - size;
+            }
+
+            ///////////////////////////////////////////////////////////////////
+            // target size of a single mapping stacks are carved from
+            constexpr std::size_t chunk_size = std::size_t(8) << 20;
+
+            // maximal number of stacks held in the per OS-thread caches
+            constexpr std::size_t local_cache_size = 16;
+
+            // maximal number of different stack sizes handled by the pool,
+            // HPX uses four (small, medium, large, huge)
+            constexpr std::size_t max_size_classes = 8;
+
+            struct size_class
+            {
+                std::mutex mtx_;
+                std::size_t size_ = 0;
+
+                // global list of idle stacks whose memory has not been
+                // released yet, the most recently freed stack comes first
+                idle_stack* idle_ = nullptr;
+
+                // length of idle_, read without holding mtx_ by trim()
+                std::atomic<std::size_t> idle_count_{0};
+
+                // global list of idle stacks whose memory has been released
+                idle_stack* released_ = nullptr;
+
+                // remaining part of the mapping new stacks are carved from
+                char* chunk_ = nullptr;
+                std::size_t chunk_slots_ = 0;
+            };
+
+            struct pool
+            {
+                std::mutex mtx_;    // protects creation of size classes
+                std::atomic<std::size_t> num_classes_{0};
+                size_class classes_[max_size_classes];
+
+                std::atomic<std::int64_t> in_use_{0};
+                std::atomic<std::int64_t> idle_{0};
+                std::atomic<std::int64_t> mapped_{0};
+                std::atomic<std::int64_t> released_{0};
+            };
+
+            // The pool is intentionally never destroyed as stacks may still
+            // be in use (or cached by other OS-threads) during static
+            // destruction.
+            pool& get_pool()
+            {
+                static pool* p = new pool;
+                return *p;
+            }
+
+            std::size_t get_size_class(pool& p, std::size_t size)
+            {
+                std::size_t num_classes =
+                    p.num_classes_.load(std::memory_order_acquire);
+                for (std::size_t i = 0; i != num_classes; ++i)
+                {
+                    if (p.classes_[i].size_ == size)
+                        return i;
+                }
+
+                std::lock_guard<std::mutex> l(p.mtx_);
+                num_classes = p.num_classes_.load(std::memory_order_relaxed);
+                for (std::size_t i = 0; i != num_classes; ++i)
+                {
+                    if (p.classes_[i].size_ == size)
+                        return i;
+                }
+
+                if (num_classes == max_size_classes)
+                {
+                    throw std::runtime_error(
+                        "stack_pool: too many different stack sizes");
+                }
+
+                p.classes_[num_classes].size_ = size;
+                p.num_classes_.store(
+                    num_classes + 1, std::memory_order_release);
+                return num_classes;
+            }
+
+            ///////////////////////////////////////////////////////////////////
+            // Map a new chunk for the given size class, each slot consists of
+            // a guard page followed by the stack itself.
+            void map_chunk(pool& p, size_class& c)
+            {
+                std::size_t const slot_size = c.size_ + EXEC_PAGESIZE;
+                std::size_t slots = chunk_size / slot_size;
+                if (slots == 0)
+                    slots = 1;
+
+                std::size_t const bytes = slots * slot_size;
+                void* chunk = ::mmap(nullptr, bytes,
+                    PROT_EXEC | PROT_READ | PROT_WRITE,
+#if defined(__APPLE__)
+                    MAP_PRIVATE | MAP_ANON | MAP_NORESERVE,
+#elif defined(__FreeBSD__)
+                    MAP_PRIVATE | MAP_ANON,
+#else
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+#endif
+                    -1, 0);
+
+                if (chunk == MAP_FAILED)
+                {
+                    if (ENOMEM == errno && use_guard_pages)
+                    {
+                        throw std::runtime_error(
+                            "mmap() failed to allocate "
+                            "thread stack due to insufficient resources, "
+                            "increase /proc/sys/vm/max_map_count or add "
+                            "-Ihpx.stacks.use_guard_pages=0 to the command "
+                            "line");
+                    }
+                    throw std::runtime_error(
+                        "mmap() failed to allocate thread stack");
+                }
+
+#if defined(MADV_HUGEPAGE)
+                if (use_huge_pages)
+                {
+                    ::madvise(chunk, bytes, MADV_HUGEPAGE);
+                }
+#endif
+
+                c.chunk_ = static_cast<char*>(chunk);
+                c.chunk_slots_ = slots;
+                p.mapped_ += static_cast<std::int64_t>(bytes);
+            }
+
+            // Carve a new stack from the current chunk, requires c.mtx_ to be
+            // held
+            void* carve_stack(pool& p, size_class& c)
+            {
+                if (c.chunk_slots_ == 0)
+                    map_chunk(p, c);
+
+                char* slot = c.chunk_;
+                c.chunk_ += c.size_ + EXEC_PAGESIZE;
+                --c.chunk_slots_;
+
+#if defined(HPX_HAVE_THREAD_GUARD_PAGE)
+                if (use_guard_pages)
+                {
+                    ::mprotect(slot, EXEC_PAGESIZE, PROT_NONE);
+                }
+#endif
+                return slot + EXEC_PAGESIZE;
+            }
+
+            // Touch all pages of the given stack, starting at its top (where
+            // the context starts using it), so that running a thread on it
+            // does not incur any page faults.
+            void prefault_stack(void* stack, std::size_t size)
+            {
+                volatile char* p = static_cast<char*>(stack) + size;
+                for (std::size_t i = EXEC_PAGESIZE; i <= size;
+                     i += EXEC_PAGESIZE)
+                {
+                    *(p - i) = 0;
+                }
+            }
+
+            ///////////////////////////////////////////////////////////////////
+            // Return an idle stack to the global list of its size class. Its
+            // memory is not released here, see trim().
+            void release_to_global(size_class& c, idle_stack* s)
+            {
+                std::lock_guard<std::mutex> l(c.mtx_);
+                s->next = c.idle_;
+                c.idle_ = s;
+                c.idle_count_.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            ///////////////////////////////////////////////////////////////////
+            // Per OS-thread cache of idle stacks. Worker threads are usually
+            // pinned to a core, hence the stacks cached here stay local to
+            // the NUMA domain of the core which has touched them last.
+            // set once the cache of the current OS-thread has been destroyed,
+            // stacks freed afterwards go directly to the global lists
+            static thread_local bool local_cache_destroyed = false;
+
+            struct local_cache
+            {
+                struct entry
+                {
+                    idle_stack* idle_ = nullptr;
+                    std::size_t count_ = 0;
+                };
+
+                ~local_cache()
+                {
+                    local_cache_destroyed = true;
+
+                    pool& p = get_pool();
+                    for (std::size_t i = 0; i != max_size_classes; ++i)
+                    {
+                        while (entries_[i].idle_ != nullptr)
+                        {
+                            idle_stack* s = entries_[i].idle_;
+                            entries_[i].idle_ = s->next;
+                            release_to_global(p.classes_[i], s);
+                        }
+                    }
+                }
+
+                entry entries_[max_size_classes];
+            };
+
+            local_cache::entry* get_local_cache_entry(std::size_t idx)
+            {
+                if (local_cache_destroyed)
+                    return nullptr;
+
+                static thread_local local_cache cache;
+                return &cache.entries_[idx];
+            }
+
+            ///////////////////////////////////////////////////////////////////
+            void* allocate(std::size_t size)
+            {
+                HPX_ASSERT(size % EXEC_PAGESIZE == 0 && size > EXEC_PAGESIZE);
+
+                pool& p = get_pool();
+                std::size_t const idx = get_size_class(p, size);
+
+                ++p.in_use_;
+
+                local_cache::entry* e = get_local_cache_entry(idx);
+                if (e != nullptr && e->idle_ != nullptr)
+                {
+                    idle_stack* s = e->idle_;
+                    e->idle_ = s->next;
+                    --e->count_;
+                    --p.idle_;
+                    return as_stack(s, size);
+                }
+
+                void* stack = nullptr;
+                bool fresh = true;
+
+                {
+                    size_class& c = p.classes_[idx];
+                    std::lock_guard<std::mutex> l(c.mtx_);
+                    if (c.idle_ != nullptr)
+                    {
+                        idle_stack* s = c.idle_;
+                        c.idle_ = s->next;
+                        c.idle_count_.fetch_sub(1, std::memory_order_relaxed);
+                        --p.idle_;
+
+                        fresh = false;
+                        stack = as_stack(s, size);
+                    }
+                    else if (c.released_ != nullptr)
+                    {
+                        idle_stack* s = c.released_;
+                        c.released_ = s->next;
+                        --p.idle_;
+
+                        stack = as_stack(s, size);
+                    }
+                    else
+                    {
+                        try
+                        {
+                            stack = carve_stack(p, c);
+                        }
+                        catch (...)
+                        {
+                            --p.in_use_;
+                            throw;
+                        }
+                    }
+                }
+
+                // stacks which were newly carved or whose memory was released
+                // are not backed by any pages yet
+                if (fresh && stack_pool_prefault)
+                    prefault_stack(stack, size);
+
+                return stack;
+            }
+
+            void deallocate(void* stack, std::size_t size)
+            {
+                pool& p = get_pool();
+                std::size_t const idx = get_size_class(p, size);
+
+                --p.in_use_;
+                ++p.idle_;
+
+                idle_stack* s = as_idle(stack, size);
+
+                local_cache::entry* e = get_local_cache_entry(idx);
+                if (e != nullptr && e->count_ < local_cache_size)
+                {
+                    s->next = e->idle_;
+                    e->idle_ = s;
+                    ++e->count_;
+                    return;
+                }
+
+                release_to_global(p.classes_[idx], s);
+            }
+
+            ///////////////////////////////////////////////////////////////////
+            void trim()
+            {
+                pool& p = get_pool();
+                std::size_t const max_idle = stack_pool_max_idle;
+
+                std::size_t const num_classes =
+                    p.num_classes_.load(std::memory_order_acquire);
+                for (std::size_t i = 0; i != num_classes; ++i)
+                {
+                    size_class& c = p.classes_[i];
+
+                    // avoid touching the size class if there is nothing to do
+                    if (c.idle_count_.load(std::memory_order_relaxed) <=
+                        max_idle)
+                    {
+                        continue;
+                    }
+
+                    // unlink the least recently freed stacks in excess of
+                    // max_idle, never wait for a size class which is busy
+                    idle_stack* excess = nullptr;
+                    {
+                        std::unique_lock<std::mutex> l(
+                            c.mtx_, std::try_to_lock);
+                        if (!l.owns_lock() ||
+                            c.idle_count_.load(std::memory_order_relaxed) <=
+                                max_idle)
+                        {
+                            continue;
+                        }
+
+                        if (max_idle == 0)
+                        {
+                            excess = c.idle_;
+                            c.idle_ = nullptr;
+                        }
+                        else
+                        {
+                            idle_stack* last = c.idle_;
+                            for (std::size_t n = 1; n != max_idle; ++n)
+                                last = last->next;
+
+                            excess = last->next;
+                            last->next = nullptr;
+                        }
+                        c.idle_count_.store(
+                            max_idle, std::memory_order_relaxed);
+                    }
+
+                    // release the memory of the unlinked stacks (except for
+                    // their topmost page holding the link) without holding
+                    // the lock
+                    idle_stack* last = excess;
+                    std::int64_t released = 0;
+                    for (idle_stack* s = excess; s != nullptr; s = s->next)
+                    {
+                        ::madvise(as_stack(s, c.size_),
+                            c.size_ - EXEC_PAGESIZE, MADV_DONTNEED);
+                        last = s;
+                        ++released;
+                    }
+                    p.released_ += released;
+
+                    std::lock_guard<std::mutex> l(c.mtx_);
+                    last->next = c.released_;
+                    c.released_ = excess;
+                }
+            }
+
+            ///////////////////////////////////////////////////////////////////
+            std::int64_t get_in_use_count(bool)
+            {
+                return get_pool().in_use_.load(std::memory_order_relaxed);
+            }
+
+            std::int64_t get_idle_count(bool)
+            {
+                return get_pool().idle_.load(std::memory_order_relaxed);
+            }
+
+            std::int64_t get_mapped_bytes(bool)
+            {
+                return get_pool().mapped_.load(std::memory_order_relaxed);
+            }
+
+            std::int64_t get_release_count(bool reset)
+            {
+                pool& p = get_pool();
+                if (reset)
+                    return p.released_.exchange(0, std::memory_order_relaxed);
+                return p.released_.load(std::memory_order_relaxed);
+            }
+        }    // namespace stack_pool
+}}}}}    // namespace hpx::threads::coroutines::detail::posix
+
+#endif
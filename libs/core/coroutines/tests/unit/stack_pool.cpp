@@ -0,0 +1,156 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/testing.hpp>
+
+#if (defined(__linux) || defined(linux) || defined(__linux__)) &&              \
+    defined(HPX_HAVE_THREAD_STACK_MMAP)
+#include <hpx/coroutines/detail/posix_utility.hpp>
+#include <hpx/coroutines/detail/stack_pool.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace posix = hpx::threads::coroutines::detail::posix;
+namespace stack_pool = posix::stack_pool;
+
+void test_reuse(std::size_t size)
+{
+    std::int64_t const in_use = stack_pool::get_in_use_count(false);
+
+    // stacks handed out concurrently are distinct and usable
+    std::vector<void*> stacks;
+    std::set<void*> unique;
+    for (int i = 0; i != 100; ++i)
+    {
+        void* stack = posix::alloc_stack(size);
+        HPX_TEST(stack != nullptr);
+        std::memset(stack, 0xcd, size);
+        posix::watermark_stack(stack, size);
+        stacks.push_back(stack);
+        unique.insert(stack);
+    }
+    HPX_TEST_EQ(unique.size(), stacks.size());
+    HPX_TEST_EQ(stack_pool::get_in_use_count(false), in_use + 100);
+
+    std::int64_t const mapped = stack_pool::get_mapped_bytes(false);
+    HPX_TEST(mapped >= static_cast<std::int64_t>(100 * size));
+
+    for (void* stack : stacks)
+        posix::free_stack(stack, size);
+    HPX_TEST_EQ(stack_pool::get_in_use_count(false), in_use);
+    HPX_TEST(stack_pool::get_idle_count(false) >= 100);
+
+    // freed stacks are handed out again instead of mapping new memory
+    for (int i = 0; i != 100; ++i)
+    {
+        void* stack = posix::alloc_stack(size);
+        HPX_TEST(unique.find(stack) != unique.end());
+        stacks[i] = stack;
+    }
+    HPX_TEST_EQ(stack_pool::get_mapped_bytes(false), mapped);
+
+    for (void* stack : stacks)
+        posix::free_stack(stack, size);
+}
+
+void test_lazy_release(std::size_t size)
+{
+    std::size_t const max_idle = posix::stack_pool_max_idle;
+    posix::stack_pool_max_idle = 0;
+
+    stack_pool::get_release_count(true);
+
+    // more stacks than fit into the thread local cache, the remaining ones
+    // will be released by the next trim only
+    std::vector<void*> stacks;
+    for (int i = 0; i != 64; ++i)
+        stacks.push_back(posix::alloc_stack(size));
+    for (void* stack : stacks)
+        posix::free_stack(stack, size);
+
+    HPX_TEST_EQ(stack_pool::get_release_count(false), std::int64_t(0));
+
+    stack_pool::trim();
+    std::int64_t const released = stack_pool::get_release_count(false);
+    HPX_TEST(released != 0);
+
+    // stacks which were released before are not released again
+    stack_pool::trim();
+    HPX_TEST_EQ(stack_pool::get_release_count(false), released);
+
+    // released stacks are handed out again, pre-faulted if requested
+    posix::stack_pool_prefault = true;
+    for (void*& stack : stacks)
+    {
+        stack = posix::alloc_stack(size);
+        std::memset(stack, 0xcd, size);
+    }
+    for (void* stack : stacks)
+        posix::free_stack(stack, size);
+    posix::stack_pool_prefault = false;
+
+    // only the stacks freed since the last trim are released
+    stack_pool::trim();
+    std::int64_t const released_again = stack_pool::get_release_count(false);
+    HPX_TEST(released_again > released);
+    HPX_TEST(released_again <= released + 64);
+
+    posix::stack_pool_max_idle = max_idle;
+}
+
+void test_threads(std::size_t size)
+{
+    std::int64_t const in_use = stack_pool::get_in_use_count(false);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t != 4; ++t)
+    {
+        threads.emplace_back([size]() {
+            for (int j = 0; j != 100; ++j)
+            {
+                std::vector<void*> stacks;
+                for (int i = 0; i != 40; ++i)
+                {
+                    void* stack = posix::alloc_stack(size);
+                    posix::watermark_stack(stack, size);
+                    stacks.push_back(stack);
+                }
+                for (void* stack : stacks)
+                    posix::free_stack(stack, size);
+            }
+        });
+    }
+    for (auto& t : threads)
+        t.join();
+
+    HPX_TEST_EQ(stack_pool::get_in_use_count(false), in_use);
+}
+
+int main()
+{
+    // the stack pool is disabled by default
+    HPX_TEST(!posix::use_stack_pool);
+    posix::use_stack_pool = true;
+
+    test_reuse(HPX_SMALL_STACK_SIZE);
+    test_reuse(HPX_MEDIUM_STACK_SIZE);
+    test_lazy_release(HPX_SMALL_STACK_SIZE);
+    test_threads(HPX_SMALL_STACK_SIZE);
+
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return hpx::util::report_errors();
+}
+#endif
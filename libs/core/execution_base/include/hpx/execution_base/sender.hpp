@@ -274,4 +274,50 @@ namespace hpx { namespace execution { namespace experimental {
         };
     }    // namespace traits
 
+    /// schedule is a customization point object. A scheduler is a lightweight
+    /// handle to an execution context. The result of the expression
+    /// `hpx::execution::experimental::schedule(sched)` is a sender which
+    /// completes on the execution context of `sched` with no values:
+    ///     * `sched.schedule()`, if that expression is valid and returns a
+    ///       type satisfying the `sender` concept,
+    ///     * Otherwise, the expression is ill-formed.
+    ///
+    /// The customization is implemented in terms of `hpx::function::tag_invoke`
+    HPX_INLINE_CONSTEXPR_VARIABLE struct schedule_t
+      : hpx::functional::tag_fallback<schedule_t>
+    {
+        template <typename Scheduler>
+        friend constexpr HPX_FORCEINLINE auto
+        tag_fallback_invoke(schedule_t, Scheduler&& sched) noexcept(
+            noexcept(std::declval<Scheduler&&>().schedule()))
+            -> decltype(std::declval<Scheduler&&>().schedule())
+        {
+            static_assert(
+                hpx::execution::experimental::traits::is_sender_v<
+                    decltype(std::declval<Scheduler&&>().schedule())>,
+                "hpx::execution::experimental::schedule needs to return a "
+                "type satisfying the sender concept");
+
+            return std::forward<Scheduler>(sched).schedule();
+        }
+    } schedule{};
+
+    namespace traits {
+        /// A scheduler is a copyable type for which
+        /// `hpx::execution::experimental::schedule` returns a sender.
+        template <typename Scheduler>
+        struct is_scheduler
+          : std::integral_constant<bool,
+                std::is_copy_constructible<
+                    typename std::decay<Scheduler>::type>::value &&
+                    hpx::is_invocable_v<
+                        hpx::execution::experimental::schedule_t,
+                        typename std::decay<Scheduler>::type&>>
+        {
+        };
+
+        template <typename Scheduler>
+        constexpr bool is_scheduler_v = is_scheduler<Scheduler>::value;
+    }    // namespace traits
+
 }}}    // namespace hpx::execution::experimental
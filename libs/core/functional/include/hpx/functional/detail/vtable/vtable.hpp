@@ -9,6 +9,7 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
 
 #include <cstddef>
 #include <type_traits>
@@ -59,9 +60,11 @@ namespace hpx { namespace util { namespace detail {
             using storage_t =
                 typename std::aligned_storage<sizeof(T), alignof(T)>::type;
 
+            // objects not fitting into the embedded storage are allocated from
+            // the thread local caches
             if (sizeof(T) > storage_size)
             {
-                return new storage_t;
+                return thread_local_caching_allocator<storage_t>{}.allocate(1);
             }
             return storage;
         }
@@ -80,7 +83,8 @@ namespace hpx { namespace util { namespace detail {
 
             if (sizeof(T) > storage_size)
             {
-                delete static_cast<storage_t*>(obj);
+                thread_local_caching_allocator<storage_t>{}.deallocate(
+                    static_cast<storage_t*>(obj), 1);
             }
         }
         void (*deallocate)(void*, std::size_t storage_size, bool);
@@ -21,3 +21,6 @@
 #if defined(HPX_HAVE_SHARED_PRIORITY_SCHEDULER)
 #include <hpx/schedulers/shared_priority_queue_scheduler.hpp>
 #endif
+#if defined(HPX_HAVE_WORK_STEALING_SCHEDULER)
+#include <hpx/schedulers/work_stealing_queue_scheduler.hpp>
+#endif
@@ -23,6 +23,7 @@
 #include <hpx/threading_base/thread_queue_init_parameters.hpp>
 #include <hpx/topology/topology.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cmath>
 #include <cstddef>
@@ -555,6 +556,85 @@ namespace hpx { namespace threads { namespace policies {
             queues_[num_thread].data_->create_thread(data, id, ec);
         }
 
+        // Work items without a thread hint are distributed in contiguous
+        // blocks over the queues (starting at the next queue in round robin
+        // order), consecutive work items targeting the same queue are handed
+        // to it as a whole. High and low priority work items are created one
+        // by one.
+        void create_threads(thread_init_data* data, std::size_t count,
+            error_code& ec) override
+        {
+            if (count == 0)
+                return;
+
+            std::size_t const first_queue =
+                curr_queue_.fetch_add((std::min)(count, num_queues_));
+
+            // returns std::size_t(-1) for work items not going to the normal
+            // priority queues
+            auto target_queue = [&](std::size_t i) -> std::size_t {
+                if (data[i].priority != thread_priority::normal &&
+                    data[i].priority != thread_priority::default_)
+                {
+                    return std::size_t(-1);
+                }
+                if (data[i].schedulehint.mode ==
+                    thread_schedule_hint_mode::thread)
+                {
+                    return std::size_t(data[i].schedulehint.hint) %
+                        num_queues_;
+                }
+                return (first_queue + (i * num_queues_) / count) % num_queues_;
+            };
+
+            std::size_t begin = 0;
+            std::size_t num_thread = target_queue(0);
+            for (std::size_t i = 1; i <= count; ++i)
+            {
+                std::size_t next_thread = 0;
+                if (i != count)
+                {
+                    next_thread = target_queue(i);
+                    if (next_thread == num_thread &&
+                        num_thread != std::size_t(-1))
+                    {
+                        continue;
+                    }
+                }
+
+                if (num_thread == std::size_t(-1))
+                {
+                    HPX_ASSERT(i - begin == 1);
+                    create_thread(data[begin], nullptr, ec);
+                    if (ec)
+                        return;
+                }
+                else
+                {
+                    std::unique_lock<pu_mutex_type> l;
+                    std::size_t const active_thread =
+                        select_active_pu(l, num_thread);
+
+                    for (std::size_t j = begin; j != i; ++j)
+                    {
+                        data[j].schedulehint.mode =
+                            thread_schedule_hint_mode::thread;
+                        data[j].schedulehint.hint =
+                            static_cast<std::int16_t>(active_thread);
+                    }
+
+                    HPX_ASSERT(active_thread < num_queues_);
+                    queues_[active_thread].data_->create_threads(
+                        data + begin, i - begin, ec);
+                    if (ec)
+                        return;
+                }
+
+                begin = i;
+                num_thread = next_thread;
+            }
+        }
+
         /// Return the next thread to be executed, return false if none is
         /// available
         bool get_next_thread(std::size_t num_thread, bool running,
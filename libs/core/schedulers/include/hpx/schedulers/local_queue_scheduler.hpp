@@ -23,6 +23,7 @@
 #include <hpx/threading_base/thread_queue_init_parameters.hpp>
 #include <hpx/topology/topology.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
@@ -316,6 +317,58 @@ namespace hpx { namespace threads { namespace policies {
             queues_[num_thread]->create_thread(data, id, ec);
         }
 
+        // Work items without a thread hint are distributed in contiguous
+        // blocks over the queues (starting at the next queue in round robin
+        // order), consecutive work items targeting the same queue are handed
+        // to it as a whole.
+        void create_threads(thread_init_data* data, std::size_t count,
+            error_code& ec) override
+        {
+            if (count == 0)
+                return;
+
+            std::size_t const queue_size = queues_.size();
+            std::size_t const first_queue =
+                curr_queue_.fetch_add((std::min)(count, queue_size));
+
+            auto target_queue = [&](std::size_t i) -> std::size_t {
+                if (data[i].schedulehint.mode ==
+                    thread_schedule_hint_mode::thread)
+                {
+                    return std::size_t(data[i].schedulehint.hint) % queue_size;
+                }
+                return (first_queue + (i * queue_size) / count) % queue_size;
+            };
+
+            std::size_t begin = 0;
+            std::size_t num_thread = target_queue(0);
+            for (std::size_t i = 1; i <= count; ++i)
+            {
+                std::size_t next_thread = 0;
+                if (i != count)
+                {
+                    next_thread = target_queue(i);
+                    if (next_thread == num_thread)
+                        continue;
+                }
+
+                {
+                    std::unique_lock<pu_mutex_type> l;
+                    std::size_t const active_thread =
+                        select_active_pu(l, num_thread);
+
+                    HPX_ASSERT(active_thread < queue_size);
+                    queues_[active_thread]->create_threads(
+                        data + begin, i - begin, ec);
+                    if (ec)
+                        return;
+                }
+
+                begin = i;
+                num_thread = next_thread;
+            }
+        }
+
         /// Return the next thread to be executed, return false if none is
         /// available
         virtual bool get_next_thread(std::size_t num_thread, bool running,
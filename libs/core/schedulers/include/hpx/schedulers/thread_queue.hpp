@@ -19,6 +19,7 @@
 #include <hpx/schedulers/lockfree_queue_backends.hpp>
 #include <hpx/schedulers/maintain_queue_wait_times.hpp>
 #include <hpx/schedulers/queue_helpers.hpp>
+#include <hpx/schedulers/thread_registry.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_data.hpp>
@@ -32,6 +33,7 @@
 #include <hpx/timing/tick_counter.hpp>
 #endif
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
@@ -42,7 +44,6 @@
 #include <memory>
 #include <mutex>
 #include <string>
-#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -89,9 +90,7 @@ namespace hpx { namespace threads { namespace policies {
         using mutex_type = Mutex;
 
         // this is the type of a map holding all threads (except depleted ones)
-        using thread_map_type = std::unordered_set<thread_id_type,
-            std::hash<thread_id_type>, std::equal_to<thread_id_type>,
-            util::internal_allocator<thread_id_type>>;
+        using thread_map_type = thread_registry;
 
         using thread_heap_type =
             std::list<thread_id_type, util::internal_allocator<thread_id_type>>;
@@ -231,19 +230,7 @@ namespace hpx { namespace threads { namespace policies {
                 task_description_alloc_.deallocate(task, 1);
 
                 // add the new entry to the map of all threads
-                std::pair<thread_map_type::iterator, bool> p =
-                    thread_map_.insert(thrd);
-
-                if (HPX_UNLIKELY(!p.second))
-                {
-                    --addfrom->new_tasks_count_.data_;
-                    lk.unlock();
-                    HPX_THROW_EXCEPTION(hpx::out_of_memory,
-                        "thread_queue::add_new",
-                        "Couldn't add new thread to the thread map");
-                    return 0;
-                }
-
+                thread_map_.insert(get_thread_id_data(thrd));
                 ++thread_map_count_;
 
                 // Decrement only after thread_map_count_ has been incremented
@@ -260,7 +247,7 @@ namespace hpx { namespace threads { namespace policies {
                 }
 
                 // this thread has to be in the map now
-                HPX_ASSERT(thread_map_.find(thrd) != thread_map_.end());
+                HPX_ASSERT(thread_map_.contains(get_thread_id_data(thrd)));
                 HPX_ASSERT(
                     &get_thread_id_data(thrd)->get_queue<thread_queue>() ==
                     this);
@@ -378,20 +365,15 @@ namespace hpx { namespace threads { namespace policies {
                 thread_data* todelete;
                 while (terminated_items_.pop(todelete))
                 {
-                    thread_id_type tid(todelete);
                     --terminated_items_count_;
 
                     // this thread has to be in this map
-                    HPX_ASSERT(thread_map_.find(tid) != thread_map_.end());
+                    HPX_ASSERT(thread_map_.contains(todelete));
 
-                    bool deleted = thread_map_.erase(tid) != 0;
-                    HPX_ASSERT(deleted);
-                    if (deleted)
-                    {
-                        deallocate(todelete);
-                        --thread_map_count_;
-                        HPX_ASSERT(thread_map_count_ >= 0);
-                    }
+                    thread_map_.erase(todelete);
+                    deallocate(todelete);
+                    --thread_map_count_;
+                    HPX_ASSERT(thread_map_count_ >= 0);
                 }
             }
             else
@@ -412,11 +394,9 @@ namespace hpx { namespace threads { namespace policies {
                     --terminated_items_count_;
 
                     // this thread has to be in this map
-                    HPX_ASSERT(thread_map_.find(tid) != thread_map_.end());
+                    HPX_ASSERT(thread_map_.contains(todelete));
 
-                    bool deleted = thread_map_.erase(tid) != 0;
-                    HPX_ASSERT(deleted);
-                    HPX_UNUSED(deleted);
+                    thread_map_.erase(todelete);
                     --thread_map_count_;
 
                     HPX_ASSERT(thread_map_count_ >= 0);
@@ -684,21 +664,11 @@ namespace hpx { namespace threads { namespace policies {
                     create_thread_object(thrd, data, lk);
 
                     // add a new entry in the map for this thread
-                    std::pair<thread_map_type::iterator, bool> p =
-                        thread_map_.insert(thrd);
-
-                    if (HPX_UNLIKELY(!p.second))
-                    {
-                        lk.unlock();
-                        HPX_THROWS_IF(ec, hpx::out_of_memory,
-                            "thread_queue::create_thread",
-                            "Couldn't add new thread to the map of threads");
-                        return;
-                    }
+                    thread_map_.insert(get_thread_id_data(thrd));
                     ++thread_map_count_;
 
                     // this thread has to be in the map now
-                    HPX_ASSERT(thread_map_.find(thrd) != thread_map_.end());
+                    HPX_ASSERT(thread_map_.contains(get_thread_id_data(thrd)));
                     HPX_ASSERT(
                         &get_thread_id_data(thrd)->get_queue<thread_queue>() ==
                         this);
@@ -735,6 +705,84 @@ namespace hpx { namespace threads { namespace policies {
                 ec = make_success_code();
         }
 
+        // create new threads for a batch of work items, the mutex is
+        // acquired at most once for all threads which have to be created
+        // right away
+        void create_threads(
+            thread_init_data* data, std::size_t count, error_code& ec)
+        {
+            std::size_t num_staged = 0;
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                if (data[i].stacksize == threads::thread_stacksize::current)
+                {
+                    data[i].stacksize = get_self_stacksize_enum();
+                }
+
+                HPX_ASSERT(
+                    data[i].stacksize != threads::thread_stacksize::current);
+
+                if (!data[i].run_now)
+                    ++num_staged;
+            }
+
+            if (num_staged != count)
+            {
+                std::unique_lock<mutex_type> lk(mtx_);
+                for (std::size_t i = 0; i != count; ++i)
+                {
+                    if (!data[i].run_now)
+                        continue;
+
+                    bool schedule_now =
+                        data[i].initial_state == thread_schedule_state::pending;
+
+                    threads::thread_id_type thrd;
+                    create_thread_object(thrd, data[i], lk);
+
+                    // add a new entry in the map for this thread
+                    thread_map_.insert(get_thread_id_data(thrd));
+                    ++thread_map_count_;
+
+                    HPX_ASSERT(thread_map_.contains(get_thread_id_data(thrd)));
+                    HPX_ASSERT(
+                        &get_thread_id_data(thrd)->get_queue<thread_queue>() ==
+                        this);
+
+                    if (schedule_now)
+                    {
+                        schedule_thread(get_thread_id_data(thrd));
+                    }
+                }
+            }
+
+            if (num_staged != 0)
+            {
+                // account for all staged tasks at once, this has to happen
+                // before they become visible to add_new
+                new_tasks_count_.data_ +=
+                    static_cast<std::int64_t>(num_staged);
+
+                for (std::size_t i = 0; i != count; ++i)
+                {
+                    if (data[i].run_now)
+                        continue;
+
+                    task_description* td = task_description_alloc_.allocate(1);
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+                    new (td) task_description{std::move(data[i]),
+                        hpx::chrono::high_resolution_clock::now()};
+#else
+                    new (td) task_description{std::move(data[i])};    //-V106
+#endif
+                    new_tasks_.push(td);
+                }
+            }
+
+            if (&ec != &throws)
+                ec = make_success_code();
+        }
+
         void move_work_items_from(thread_queue* src, std::int64_t count)
         {
             thread_description* trd;
@@ -837,6 +885,53 @@ namespace hpx { namespace threads { namespace policies {
             return false;
         }
 
+        /// Steal up to half (but no more than max_count) of the pending
+        /// threads of the given queue. The first stolen thread is returned
+        /// in thrd, all others are moved to this queue. Returns the number
+        /// of stolen threads.
+        std::size_t steal_half(thread_queue* victim,
+            threads::thread_data*& thrd, std::size_t max_count)
+        {
+            HPX_ASSERT(victim != this && max_count != 0);
+
+            std::int64_t work_items_count =
+                victim->work_items_count_.data_.load(std::memory_order_relaxed);
+
+            if (parameters_.min_tasks_to_steal_pending_ > work_items_count)
+            {
+                return 0;
+            }
+
+            // work_items_count is only a snapshot and may be out of date,
+            // always try to steal at least one thread
+            std::size_t to_steal = 1;
+            if (work_items_count > 1)
+            {
+                to_steal = (std::min)(
+                    static_cast<std::size_t>((work_items_count + 1) / 2),
+                    max_count);
+            }
+
+            if (!victim->get_next_thread(thrd, false, true))
+            {
+                return 0;
+            }
+
+            std::size_t stolen = 1;
+            threads::thread_data* next = nullptr;
+            while (stolen < to_steal &&
+                victim->get_next_thread(next, false, true))
+            {
+                schedule_thread(next);
+                ++stolen;
+            }
+
+            victim->increment_num_stolen_from_pending(stolen);
+            increment_num_stolen_to_pending(stolen);
+
+            return stolen;
+        }
+
         /// Schedule the passed thread
         void schedule_thread(threads::thread_data* thrd, bool other_end = false)
         {
@@ -899,9 +994,9 @@ namespace hpx { namespace threads { namespace policies {
         void abort_all_suspended_threads()
         {
             std::lock_guard<mutex_type> lk(mtx_);
-            thread_map_type::iterator end = thread_map_.end();
-            for (thread_map_type::iterator it = thread_map_.begin(); it != end;
-                 ++it)
+            thread_map_type::const_iterator end = thread_map_.end();
+            for (thread_map_type::const_iterator it = thread_map_.begin();
+                 it != end; ++it)
             {
                 auto thrd = get_thread_id_data(*it);
                 if (thrd->get_state().state() ==
@@ -1092,7 +1187,7 @@ namespace hpx { namespace threads { namespace policies {
 
         mutable mutex_type mtx_;    // mutex protecting the members
 
-        thread_map_type thread_map_;    // mapping of thread id's to HPX-threads
+        thread_map_type thread_map_;    // registry of all HPX-threads
 
         // overall count of work items
         std::atomic<std::int64_t> thread_map_count_;
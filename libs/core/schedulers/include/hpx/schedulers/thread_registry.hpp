@@ -0,0 +1,160 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+
+#include <cstddef>
+#include <iterator>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace threads { namespace policies {
+    ///////////////////////////////////////////////////////////////////////////
+    // The thread_registry keeps track of all threads owned by a thread_queue
+    // (except depleted ones). It is an intrusive doubly linked list threaded
+    // through the thread objects themselves (see thread_data::registry_hook),
+    // thus registering and unregistering a thread is O(1) and never
+    // allocates. The registry is not thread-safe, all accesses have to be
+    // protected by the lock of the owning queue.
+    //
+    // The registry exposes the same interface for iteration as the
+    // std::unordered_set<thread_id_type> it replaces.
+    class thread_registry
+    {
+    public:
+        class const_iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = thread_id_type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = thread_id_type const*;
+            using reference = thread_id_type;
+
+            const_iterator() = default;
+
+            explicit const_iterator(thread_data* p) noexcept
+              : p_(p)
+            {
+            }
+
+            thread_id_type operator*() const noexcept
+            {
+                return thread_id_type(p_);
+            }
+
+            const_iterator& operator++() noexcept
+            {
+                p_ = p_->get_registry_hook().next;
+                return *this;
+            }
+
+            const_iterator operator++(int) noexcept
+            {
+                const_iterator tmp(*this);
+                ++*this;
+                return tmp;
+            }
+
+            friend bool operator==(
+                const_iterator const& lhs, const_iterator const& rhs) noexcept
+            {
+                return lhs.p_ == rhs.p_;
+            }
+
+            friend bool operator!=(
+                const_iterator const& lhs, const_iterator const& rhs) noexcept
+            {
+                return lhs.p_ != rhs.p_;
+            }
+
+        private:
+            thread_data* p_ = nullptr;
+        };
+
+        using iterator = const_iterator;
+
+        thread_registry() = default;
+
+        thread_registry(thread_registry const&) = delete;
+        thread_registry& operator=(thread_registry const&) = delete;
+
+        // add the given thread to the front of the registry
+        void insert(thread_data* thrd) noexcept
+        {
+            HPX_ASSERT(!contains(thrd));
+
+            thread_data::registry_hook& hook = thrd->get_registry_hook();
+            hook.prev = nullptr;
+            hook.next = head_;
+            if (head_ != nullptr)
+            {
+                head_->get_registry_hook().prev = thrd;
+            }
+            head_ = thrd;
+            ++size_;
+        }
+
+        // remove the given thread from the registry
+        void erase(thread_data* thrd) noexcept
+        {
+            HPX_ASSERT(contains(thrd));
+
+            thread_data::registry_hook& hook = thrd->get_registry_hook();
+            if (hook.prev != nullptr)
+            {
+                hook.prev->get_registry_hook().next = hook.next;
+            }
+            else
+            {
+                head_ = hook.next;
+            }
+
+            if (hook.next != nullptr)
+            {
+                hook.next->get_registry_hook().prev = hook.prev;
+            }
+
+            hook.prev = nullptr;
+            hook.next = nullptr;
+            --size_;
+        }
+
+        // return whether the given thread is currently registered, this
+        // assumes that a thread can be registered with at most one registry
+        bool contains(thread_data const* thrd) const noexcept
+        {
+            return thrd->get_registry_hook().prev != nullptr || head_ == thrd;
+        }
+
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        bool empty() const noexcept
+        {
+            return size_ == 0;
+        }
+
+        const_iterator begin() const noexcept
+        {
+            return const_iterator(head_);
+        }
+
+        const_iterator end() const noexcept
+        {
+            return const_iterator();
+        }
+
+    private:
+        thread_data* head_ = nullptr;
+        std::size_t size_ = 0;
+    };
+}}}    // namespace hpx::threads::policies
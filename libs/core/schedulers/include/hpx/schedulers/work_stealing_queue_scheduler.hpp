@@ -0,0 +1,298 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_WORK_STEALING_SCHEDULER)
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/schedulers/deadlock_detection.hpp>
+#include <hpx/schedulers/local_queue_scheduler.hpp>
+#include <hpx/schedulers/lockfree_queue_backends.hpp>
+#include <hpx/schedulers/thread_queue.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace threads { namespace policies {
+    ///////////////////////////////////////////////////////////////////////////
+    /// The work_stealing_queue_scheduler maintains exactly one queue of work
+    /// items (threads) per OS thread, where this OS thread pulls its next work
+    /// from. Idle OS threads steal work from other queues:
+    ///
+    ///  - victims are tried hierarchically, first the queues of the OS
+    ///    threads running on the same core, then the ones on the same NUMA
+    ///    domain, then the ones on the same socket, and last (only if NUMA
+    ///    stealing is enabled) all remaining ones.
+    ///  - on each level the victims are visited starting at a randomly
+    ///    selected one, avoiding for all idle threads to hit the same
+    ///    (neighboring) queue.
+    ///  - up to half of the pending threads of a victim are stolen at once,
+    ///    amortizing the cost of finding a victim.
+    template <typename Mutex = std::mutex,
+        typename PendingQueuing = lockfree_fifo,
+        typename StagedQueuing = lockfree_fifo,
+        typename TerminatedQueuing =
+            default_local_queue_scheduler_terminated_queue>
+    class work_stealing_queue_scheduler
+      : public local_queue_scheduler<Mutex, PendingQueuing, StagedQueuing,
+            TerminatedQueuing>
+    {
+    public:
+        using base_type = local_queue_scheduler<Mutex, PendingQueuing,
+            StagedQueuing, TerminatedQueuing>;
+        using thread_queue_type = typename base_type::thread_queue_type;
+
+        // the levels of the stealing hierarchy
+        enum steal_level
+        {
+            steal_core = 0,
+            steal_numa_domain = 1,
+            steal_socket = 2,
+            steal_remote = 3,
+            num_steal_levels = 4
+        };
+
+        // maximal number of pending threads stolen in one go
+        static constexpr std::size_t max_steal_count = 64;
+
+        work_stealing_queue_scheduler(
+            typename base_type::init_parameter_type const& init,
+            bool deferred_initialization = true)
+          : base_type(init, deferred_initialization)
+          , steal_data_(init.num_queues_)
+        {
+        }
+
+        static std::string get_scheduler_name()
+        {
+            return "work_stealing_queue_scheduler";
+        }
+
+        /// Return the next thread to be executed, return false if none is
+        /// available
+        bool get_next_thread(std::size_t num_thread, bool running,
+            threads::thread_data*& thrd, bool /*enable_stealing*/) override
+        {
+            HPX_ASSERT(num_thread < this->queues_.size());
+
+            thread_queue_type* this_queue = this->queues_[num_thread];
+
+            {
+                bool result = this_queue->get_next_thread(thrd);
+
+                this_queue->increment_num_pending_accesses();
+                if (result)
+                    return true;
+                this_queue->increment_num_pending_misses();
+
+                bool have_staged = this_queue->get_staged_queue_length(
+                                       std::memory_order_relaxed) != 0;
+
+                // Give up, we should have work to convert.
+                if (have_staged)
+                    return false;
+            }
+
+            if (!running)
+            {
+                return false;
+            }
+
+            steal_data& data = steal_data_[num_thread];
+            std::size_t const levels = num_levels();
+            for (std::size_t level = 0; level != levels; ++level)
+            {
+                std::vector<std::size_t> const& victims = data.victims_[level];
+                std::size_t const num_victims = victims.size();
+                if (num_victims == 0)
+                    continue;
+
+                std::size_t const start = data.random() % num_victims;
+                for (std::size_t i = 0; i != num_victims; ++i)
+                {
+                    std::size_t const idx = victims[(start + i) % num_victims];
+                    HPX_ASSERT(idx != num_thread);
+
+                    if (this_queue->steal_half(
+                            this->queues_[idx], thrd, max_steal_count) != 0)
+                    {
+                        return true;
+                    }
+                }
+            }
+
+            return false;
+        }
+
+        /// This is a function which gets called periodically by the thread
+        /// manager to allow for maintenance tasks to be executed in the
+        /// scheduler. Returns true if the OS thread calling this function
+        /// has to be terminated (i.e. no more work has to be done).
+        bool wait_or_add_new(std::size_t num_thread, bool running,
+            std::int64_t& idle_loop_count, bool /* enable_stealing */,
+            std::size_t& added) override
+        {
+            HPX_ASSERT(num_thread < this->queues_.size());
+
+            added = 0;
+
+            thread_queue_type* this_queue = this->queues_[num_thread];
+
+            bool result = this_queue->wait_or_add_new(running, added);
+            if (0 != added)
+                return result;
+
+            // Check if we have been disabled
+            if (!running)
+            {
+                return true;
+            }
+
+            // convert staged threads of other queues, using the same
+            // hierarchy and randomization as for stealing pending threads
+            steal_data& data = steal_data_[num_thread];
+            std::size_t const levels = num_levels();
+            for (std::size_t level = 0; level != levels; ++level)
+            {
+                std::vector<std::size_t> const& victims = data.victims_[level];
+                std::size_t const num_victims = victims.size();
+                if (num_victims == 0)
+                    continue;
+
+                std::size_t const start = data.random() % num_victims;
+                for (std::size_t i = 0; i != num_victims; ++i)
+                {
+                    std::size_t const idx = victims[(start + i) % num_victims];
+                    HPX_ASSERT(idx != num_thread);
+
+                    result = this_queue->wait_or_add_new(
+                                 running, added, this->queues_[idx]) &&
+                        result;
+                    if (0 != added)
+                    {
+                        this->queues_[idx]->increment_num_stolen_from_staged(
+                            added);
+                        this_queue->increment_num_stolen_to_staged(added);
+                        return result;
+                    }
+                }
+            }
+
+#ifdef HPX_HAVE_THREAD_MINIMAL_DEADLOCK_DETECTION
+            // no new work is available, are we deadlocked?
+            if (HPX_UNLIKELY(get_minimal_deadlock_detection_enabled() &&
+                    LHPX_ENABLED(error)))
+            {
+                bool suspended_only = true;
+
+                for (std::size_t i = 0;
+                     suspended_only && i != this->queues_.size(); ++i)
+                {
+                    suspended_only = this->queues_[i]->dump_suspended_threads(
+                        i, idle_loop_count, running);
+                }
+
+                if (HPX_UNLIKELY(suspended_only))
+                {
+                    LTM_(error)    //-V128
+                        << "queue(" << num_thread << "): "
+                        << "no new work available, are we deadlocked?";
+                }
+            }
+#else
+            HPX_UNUSED(idle_loop_count);
+#endif
+
+            return result;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        void on_start_thread(std::size_t num_thread) override
+        {
+            base_type::on_start_thread(num_thread);
+
+            auto const& topo = create_topology();
+            detail::affinity_data const& affinity_data = this->affinity_data_;
+
+            std::size_t const num_pu = affinity_data.get_pu_num(num_thread);
+            mask_cref_type core_mask = topo.get_core_affinity_mask(num_pu);
+            mask_cref_type node_mask =
+                topo.get_numa_node_affinity_mask(num_pu);
+            mask_cref_type socket_mask = topo.get_socket_affinity_mask(num_pu);
+
+            // assign all other queues to the innermost level of the hierarchy
+            // they share with this one
+            steal_data& data = steal_data_[num_thread];
+            for (std::size_t i = 0; i != num_steal_levels; ++i)
+                data.victims_[i].clear();
+
+            std::size_t const queues_size = this->queues_.size();
+            for (std::size_t idx = 0; idx != queues_size; ++idx)
+            {
+                if (idx == num_thread)
+                    continue;
+
+                std::size_t const pu = affinity_data.get_pu_num(idx);
+                if (test(core_mask, pu))
+                    data.victims_[steal_core].push_back(idx);
+                else if (test(node_mask, pu))
+                    data.victims_[steal_numa_domain].push_back(idx);
+                else if (test(socket_mask, pu))
+                    data.victims_[steal_socket].push_back(idx);
+                else
+                    data.victims_[steal_remote].push_back(idx);
+            }
+
+            // seed the random victim selection differently for each thread
+            data.seed_ = 0x9e3779b97f4a7c15ull * (num_thread + 1);
+        }
+
+    private:
+        // Without NUMA stealing the remote level of the hierarchy is skipped.
+        std::size_t num_levels() const
+        {
+            return this->has_scheduler_mode(policies::enable_stealing_numa) ?
+                num_steal_levels :
+                num_steal_levels - 1;
+        }
+
+        struct steal_data_base
+        {
+            // xorshift64 generator used to select the first victim to try
+            std::size_t random()
+            {
+                seed_ ^= seed_ << 13;
+                seed_ ^= seed_ >> 7;
+                seed_ ^= seed_ << 17;
+                return static_cast<std::size_t>(seed_);
+            }
+
+            std::vector<std::size_t> victims_[num_steal_levels];
+            std::uint64_t seed_ = 1;
+        };
+
+        // the data is accessed by the owning OS thread only
+        using steal_data = util::cache_aligned_data_derived<steal_data_base>;
+
+        std::vector<steal_data> steal_data_;
+    };
+}}}    // namespace hpx::threads::policies
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
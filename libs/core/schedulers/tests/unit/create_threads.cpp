@@ -0,0 +1,122 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that work items created in bulk are all run, regardless of their
+// scheduling hints and priorities.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/resource_partitioner.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/modules/schedulers.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/threading_base/register_thread.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+void test_create_threads(std::size_t count)
+{
+    std::atomic<std::size_t> executed(0);
+    hpx::lcos::local::latch l(static_cast<std::ptrdiff_t>(count) + 1);
+
+    std::size_t const num_threads = hpx::get_num_worker_threads();
+
+    std::vector<hpx::threads::thread_init_data> data;
+    data.reserve(count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        // mix work items with and without hints and of different priorities
+        hpx::threads::thread_schedule_hint hint;
+        if (i % 3 == 0)
+        {
+            hint = hpx::threads::thread_schedule_hint(
+                static_cast<std::int16_t>(i % num_threads));
+        }
+
+        hpx::threads::thread_priority priority =
+            hpx::threads::thread_priority::normal;
+        if (i % 7 == 0)
+            priority = hpx::threads::thread_priority::high;
+        else if (i % 11 == 0)
+            priority = hpx::threads::thread_priority::low;
+
+        auto f = [&executed, &l]() {
+            ++executed;
+            l.count_down(1);
+        };
+
+        data.emplace_back(hpx::threads::make_thread_function_nullary(f),
+            "test_create_threads", priority, hint,
+            hpx::threads::thread_stacksize::small_);
+    }
+
+    hpx::threads::register_work_bulk(data.data(), data.size(),
+        hpx::threads::detail::get_self_or_default_pool());
+
+    l.arrive_and_wait();
+    HPX_TEST_EQ(executed.load(), count);
+}
+
+int hpx_main()
+{
+    test_create_threads(0);
+    test_create_threads(1);
+    test_create_threads(100);
+    test_create_threads(10000);
+
+    return hpx::finalize();
+}
+
+template <typename Scheduler, typename... Ts>
+void test_scheduler(int argc, char* argv[], Ts... ts)
+{
+    hpx::init_params init_args;
+
+    init_args.cfg = {"hpx.os_threads=4"};
+    init_args.rp_callback = [ts...](auto& rp) {
+        rp.create_thread_pool("default",
+            [ts...](hpx::threads::thread_pool_init_parameters thread_pool_init,
+                hpx::threads::policies::thread_queue_init_parameters
+                    thread_queue_init)
+                -> std::unique_ptr<hpx::threads::thread_pool_base> {
+                typename Scheduler::init_parameter_type init(
+                    thread_pool_init.num_threads_,
+                    thread_pool_init.affinity_data_, ts..., thread_queue_init);
+                std::unique_ptr<Scheduler> scheduler(new Scheduler(init));
+
+                std::unique_ptr<hpx::threads::thread_pool_base> pool(
+                    new hpx::threads::detail::scheduled_thread_pool<Scheduler>(
+                        std::move(scheduler), thread_pool_init));
+
+                return pool;
+            });
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, init_args), 0);
+}
+
+int main(int argc, char* argv[])
+{
+    {
+        using scheduler_type =
+            hpx::threads::policies::local_priority_queue_scheduler<>;
+        test_scheduler<scheduler_type>(argc, argv, std::size_t(-1));
+    }
+
+    {
+        using scheduler_type = hpx::threads::policies::local_queue_scheduler<>;
+        test_scheduler<scheduler_type>(argc, argv);
+    }
+
+    return hpx::util::report_errors();
+}
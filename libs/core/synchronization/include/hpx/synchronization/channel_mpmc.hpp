@@ -13,9 +13,12 @@
 #include <hpx/modules/concurrency.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/thread_support.hpp>
+#include <hpx/synchronization/detail/condition_variable.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <utility>
@@ -204,6 +207,326 @@ namespace hpx { namespace lcos { namespace local {
         bool closed_;
     };
 
+    ////////////////////////////////////////////////////////////////////////////
+    // Passing lock_free_policy as the second template argument selects the
+    // lock-free implementation of the bounded_channel.
+    struct lock_free_policy
+    {
+    };
+
+    // The lock-free bounded_channel is based on Dmitry Vyukov's bounded MPMC
+    // queue (see http://www.1024cores.net). Every cell of the ring-buffer
+    // carries a sequence number telling producers and consumers whether the
+    // cell is ready to be written or read for the current round, the head and
+    // the tail are tickets claimed using compare-and-swap. Producers and
+    // consumers do not interfere with each other unless the channel is full or
+    // empty. The capacity is rounded up to the next power of two.
+    //
+    // In addition to the non-blocking get and set, this channel provides
+    // get_wait and set_wait which suspend the calling thread until the
+    // operation can be completed or the channel is closed. Waiting threads are
+    // registered with a condition variable, the non-blocking operations touch
+    // the associated lock only if threads are waiting on the opposite end.
+    template <typename T>
+    class bounded_channel<T, lock_free_policy>
+    {
+    private:
+        using mutex_type = hpx::lcos::local::spinlock;
+
+        struct cell
+        {
+            std::atomic<std::size_t> sequence_;
+            T data_;
+        };
+
+        static std::size_t round_up_to_power_of_two(std::size_t size) noexcept
+        {
+            std::size_t result = 1;
+            while (result < size)
+            {
+                result <<= 1;
+            }
+            return result;
+        }
+
+    public:
+        explicit bounded_channel(std::size_t size)
+          : size_(round_up_to_power_of_two(size))
+          , buffer_(new cell[size_])
+          , closed_(false)
+          , consumers_waiting_(0)
+          , producers_waiting_(0)
+        {
+            HPX_ASSERT(size != 0);
+
+            for (std::size_t i = 0; i != size_; ++i)
+            {
+                buffer_[i].sequence_.store(i, std::memory_order_relaxed);
+            }
+
+            head_.data_.store(0, std::memory_order_relaxed);
+            tail_.data_.store(0, std::memory_order_relaxed);
+        }
+
+        // Moving a channel is not thread-safe, no other thread may access
+        // either channel while it is moved.
+        bounded_channel(bounded_channel&& rhs) noexcept
+          : size_(rhs.size_)
+          , buffer_(std::move(rhs.buffer_))
+          , closed_(rhs.closed_.load(std::memory_order_relaxed))
+          , consumers_waiting_(0)
+          , producers_waiting_(0)
+        {
+            head_.data_.store(rhs.head_.data_.load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+            tail_.data_.store(rhs.tail_.data_.load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+
+            rhs.size_ = 0;
+            rhs.closed_.store(true, std::memory_order_relaxed);
+        }
+
+        bounded_channel& operator=(bounded_channel&& rhs) noexcept
+        {
+            head_.data_.store(rhs.head_.data_.load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+            tail_.data_.store(rhs.tail_.data_.load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+            size_ = rhs.size_;
+            buffer_ = std::move(rhs.buffer_);
+            closed_.store(rhs.closed_.load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+
+            rhs.size_ = 0;
+            rhs.closed_.store(true, std::memory_order_relaxed);
+            return *this;
+        }
+
+        ~bounded_channel()
+        {
+            HPX_ASSERT(consumers_waiting_.load(std::memory_order_relaxed) == 0);
+            HPX_ASSERT(producers_waiting_.load(std::memory_order_relaxed) == 0);
+        }
+
+        bool get(T* val = nullptr) const noexcept
+        {
+            if (closed_.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+
+            std::size_t const mask = size_ - 1;
+            std::size_t head = head_.data_.load(std::memory_order_relaxed);
+            cell* c = nullptr;
+
+            for (;;)
+            {
+                c = &buffer_[head & mask];
+                std::size_t const seq =
+                    c->sequence_.load(std::memory_order_acquire);
+                std::intptr_t const diff = static_cast<std::intptr_t>(seq) -
+                    static_cast<std::intptr_t>(head + 1);
+
+                if (diff == 0)
+                {
+                    if (val == nullptr)
+                    {
+                        return true;
+                    }
+
+                    if (head_.data_.compare_exchange_weak(
+                            head, head + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;    // the channel is empty
+                }
+                else
+                {
+                    head = head_.data_.load(std::memory_order_relaxed);
+                }
+            }
+
+            *val = std::move(c->data_);
+            c->sequence_.store(head + mask + 1, std::memory_order_release);
+
+            notify_waiting(producers_waiting_, not_full_);
+            return true;
+        }
+
+        bool set(T&& t) noexcept
+        {
+            if (closed_.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+
+            std::size_t const mask = size_ - 1;
+            std::size_t tail = tail_.data_.load(std::memory_order_relaxed);
+            cell* c = nullptr;
+
+            for (;;)
+            {
+                c = &buffer_[tail & mask];
+                std::size_t const seq =
+                    c->sequence_.load(std::memory_order_acquire);
+                std::intptr_t const diff = static_cast<std::intptr_t>(seq) -
+                    static_cast<std::intptr_t>(tail);
+
+                if (diff == 0)
+                {
+                    if (tail_.data_.compare_exchange_weak(
+                            tail, tail + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;    // the channel is full
+                }
+                else
+                {
+                    tail = tail_.data_.load(std::memory_order_relaxed);
+                }
+            }
+
+            c->data_ = std::move(t);
+            c->sequence_.store(tail + 1, std::memory_order_release);
+
+            notify_waiting(consumers_waiting_, not_empty_);
+            return true;
+        }
+
+        // Retrieve a value from the channel, suspend the calling thread while
+        // the channel is empty. Returns false if the channel was closed.
+        bool get_wait(T* val = nullptr) const
+        {
+            return wait_for(consumers_waiting_, not_empty_, head_.data_, 1,
+                [this, val]() { return get(val); },
+                "hpx::lcos::local::bounded_channel::get_wait");
+        }
+
+        // Store the given value in the channel, suspend the calling thread
+        // while the channel is full. Returns false if the channel was closed.
+        bool set_wait(T&& t)
+        {
+            return wait_for(producers_waiting_, not_full_, tail_.data_, 0,
+                [this, &t]() { return set(std::move(t)); },
+                "hpx::lcos::local::bounded_channel::set_wait");
+        }
+
+        std::size_t close()
+        {
+            if (closed_.exchange(true, std::memory_order_seq_cst))
+            {
+                HPX_THROW_EXCEPTION(hpx::invalid_status,
+                    "hpx::lcos::local::bounded_channel::close",
+                    "attempting to close an already closed channel");
+            }
+
+            // wake up all waiting threads, they will find the channel closed
+            {
+                std::unique_lock<mutex_type> l(wait_mtx_.data_);
+                not_empty_.notify_all(std::move(l));
+            }
+            {
+                std::unique_lock<mutex_type> l(wait_mtx_.data_);
+                not_full_.notify_all(std::move(l));
+            }
+            return 0;
+        }
+
+        std::size_t capacity() const
+        {
+            return size_;
+        }
+
+    private:
+        // The waiting threads announce themselves before re-checking the
+        // channel while the notifying threads check for waiting threads after
+        // having modified the channel. The sequentially consistent operations
+        // on both ends ensure that at least one of them sees the other.
+        void notify_waiting(std::atomic<std::size_t>& waiting,
+            lcos::local::detail::condition_variable& cond) const noexcept
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (waiting.load(std::memory_order_relaxed) != 0)
+            {
+                std::unique_lock<mutex_type> l(wait_mtx_.data_);
+                cond.notify_one(std::move(l), hpx::throws);
+            }
+        }
+
+        // Returns false if the cell at the given position is known not to be
+        // ready yet, spurious true results just cause another attempt.
+        bool may_be_ready(std::atomic<std::size_t> const& pos,
+            std::size_t offset) const noexcept
+        {
+            std::size_t const p = pos.load(std::memory_order_relaxed);
+            std::size_t const seq = buffer_[p & (size_ - 1)].sequence_.load(
+                std::memory_order_acquire);
+            std::intptr_t const diff = static_cast<std::intptr_t>(seq) -
+                static_cast<std::intptr_t>(p + offset);
+            return diff >= 0;
+        }
+
+        // The operation itself is never invoked while holding the lock as it
+        // may have to notify threads waiting on the opposite end.
+        template <typename F>
+        bool wait_for(std::atomic<std::size_t>& waiting,
+            lcos::local::detail::condition_variable& cond,
+            std::atomic<std::size_t> const& pos, std::size_t offset, F&& f,
+            char const* description) const
+        {
+            while (!f())
+            {
+                if (closed_.load(std::memory_order_acquire))
+                {
+                    return false;
+                }
+
+                std::unique_lock<mutex_type> l(wait_mtx_.data_);
+
+                waiting.fetch_add(1, std::memory_order_seq_cst);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                if (!may_be_ready(pos, offset) &&
+                    !closed_.load(std::memory_order_seq_cst))
+                {
+                    cond.wait(l, description);
+                }
+
+                waiting.fetch_sub(1, std::memory_order_relaxed);
+            }
+            return true;
+        }
+
+    private:
+        // keep the head, and the tail tickets in separate cache lines
+        mutable hpx::util::cache_aligned_data<std::atomic<std::size_t>> head_;
+        hpx::util::cache_aligned_data<std::atomic<std::size_t>> tail_;
+
+        // the number of cells, always a power of two
+        std::size_t size_;
+
+        // channel buffer
+        std::unique_ptr<cell[]> buffer_;
+
+        // this channel was closed, i.e. no further operations are possible
+        std::atomic<bool> closed_;
+
+        // threads blocked in get_wait and set_wait
+        mutable hpx::util::cache_aligned_data<mutex_type> wait_mtx_;
+        mutable std::atomic<std::size_t> consumers_waiting_;
+        mutable std::atomic<std::size_t> producers_waiting_;
+        mutable lcos::local::detail::condition_variable not_empty_;
+        mutable lcos::local::detail::condition_variable not_full_;
+    };
+
     ////////////////////////////////////////////////////////////////////////////
     // For use with HPX threads, the channel_mpmc defined here is the fastest
     // (even faster than the channel_spsc). Using hpx::util::spinlock as the
@@ -213,4 +536,9 @@ namespace hpx { namespace lcos { namespace local {
     template <typename T>
     using channel_mpmc = bounded_channel<T, hpx::lcos::local::spinlock>;
 
+    // The lock-free channel_mpmc scales better than the one above if many
+    // producers and consumers access the channel concurrently.
+    template <typename T>
+    using channel_mpmc_lock_free = bounded_channel<T, lock_free_policy>;
+
 }}}    // namespace hpx::lcos::local
@@ -12,8 +12,14 @@
 #include <hpx/modules/timing.hpp>
 #include <hpx/synchronization/channel_mpmc.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <utility>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
 struct data
@@ -35,7 +41,8 @@ constexpr int NUM_TESTS = 100000000;
 #endif
 
 ///////////////////////////////////////////////////////////////////////////////
-inline data channel_get(hpx::lcos::local::channel_mpmc<data> const& c)
+template <typename Channel>
+inline data channel_get(Channel const& c)
 {
     data result;
     while (!c.get(&result))
@@ -45,7 +52,8 @@ inline data channel_get(hpx::lcos::local::channel_mpmc<data> const& c)
     return result;
 }
 
-inline void channel_set(hpx::lcos::local::channel_mpmc<data>& c, data&& val)
+template <typename Channel>
+inline void channel_set(Channel& c, data&& val)
 {
     while (!c.set(std::move(val)))    // NOLINT
     {
@@ -55,7 +63,8 @@ inline void channel_set(hpx::lcos::local::channel_mpmc<data>& c, data&& val)
 
 ///////////////////////////////////////////////////////////////////////////////
 // Produce
-double thread_func_0(hpx::lcos::local::channel_mpmc<data>& c)
+template <typename Channel>
+double thread_func_0(Channel& c)
 {
     std::uint64_t start = hpx::chrono::high_resolution_clock::now();
 
@@ -70,7 +79,8 @@ double thread_func_0(hpx::lcos::local::channel_mpmc<data>& c)
 }
 
 // Consume
-double thread_func_1(hpx::lcos::local::channel_mpmc<data>& c)
+template <typename Channel>
+double thread_func_1(Channel& c)
 {
     std::uint64_t start = hpx::chrono::high_resolution_clock::now();
 
@@ -88,12 +98,17 @@ double thread_func_1(hpx::lcos::local::channel_mpmc<data>& c)
     return static_cast<double>(end - start) / 1e9;
 }
 
-int main()
+template <typename Channel>
+void test_single_producer_consumer(char const* name)
 {
-    hpx::lcos::local::channel_mpmc<data> c(10000);
+    Channel c(10000);
+
+    hpx::future<double> producer =
+        hpx::async(&thread_func_0<Channel>, std::ref(c));
+    hpx::future<double> consumer =
+        hpx::async(&thread_func_1<Channel>, std::ref(c));
 
-    hpx::future<double> producer = hpx::async(thread_func_0, std::ref(c));
-    hpx::future<double> consumer = hpx::async(thread_func_1, std::ref(c));
+    std::cout << name << ", 1 producer, 1 consumer\n";
 
     auto producer_time = producer.get();
     std::cout << "Producer throughput: " << (NUM_TESTS / producer_time)
@@ -102,6 +117,110 @@ int main()
     auto consumer_time = consumer.get();
     std::cout << "Consumer throughput: " << (NUM_TESTS / consumer_time)
               << " [op/s] (" << (consumer_time / NUM_TESTS) << " [s/op])\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Multiple producers and consumers, each of them handles the same number of
+// items, the consumers verify the sum of the received items.
+template <typename Channel>
+double thread_func_mp(Channel& c, int count)
+{
+    std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i != count; ++i)
+    {
+        channel_set(c, data{i});
+    }
+
+    std::uint64_t end = hpx::chrono::high_resolution_clock::now();
+
+    return static_cast<double>(end - start) / 1e9;
+}
+
+template <typename Channel>
+double thread_func_mc(Channel& c, int count, std::int64_t& sum)
+{
+    std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i != count; ++i)
+    {
+        sum += channel_get(c).data_[0];
+    }
+
+    std::uint64_t end = hpx::chrono::high_resolution_clock::now();
+
+    return static_cast<double>(end - start) / 1e9;
+}
+
+template <typename Channel>
+void test_multiple_producers_consumers(char const* name, int num_producers)
+{
+    Channel c(10000);
+
+    int const count = NUM_TESTS / num_producers;
+    int const num_items = count * num_producers;
+
+    std::vector<std::int64_t> sums(num_producers, 0);
+
+    std::vector<hpx::future<double>> producers;
+    std::vector<hpx::future<double>> consumers;
+    producers.reserve(num_producers);
+    consumers.reserve(num_producers);
+
+    for (int i = 0; i != num_producers; ++i)
+    {
+        producers.push_back(
+            hpx::async(&thread_func_mp<Channel>, std::ref(c), count));
+        consumers.push_back(hpx::async(&thread_func_mc<Channel>, std::ref(c),
+            count, std::ref(sums[i])));
+    }
+
+    std::cout << name << ", " << num_producers << " producers, "
+              << num_producers << " consumers\n";
+
+    double producer_time = 0.0;
+    for (auto&& f : producers)
+    {
+        producer_time = (std::max)(producer_time, f.get());
+    }
+    std::cout << "Producer throughput: " << (num_items / producer_time)
+              << " [op/s] (" << (producer_time / num_items) << " [s/op])\n";
+
+    double consumer_time = 0.0;
+    for (auto&& f : consumers)
+    {
+        consumer_time = (std::max)(consumer_time, f.get());
+    }
+    std::cout << "Consumer throughput: " << (num_items / consumer_time)
+              << " [op/s] (" << (consumer_time / num_items) << " [s/op])\n";
+
+    std::int64_t const expected =
+        std::int64_t(num_producers) * count * (count - 1) / 2;
+    if (std::accumulate(sums.begin(), sums.end(), std::int64_t(0)) != expected)
+    {
+        std::cout << "Error!\n";
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Run with --hpx:threads=16 to measure a pipeline of 8 producers feeding 8
+// consumers.
+int main()
+{
+    using hpx::lcos::local::channel_mpmc;
+    using hpx::lcos::local::channel_mpmc_lock_free;
+
+    test_single_producer_consumer<channel_mpmc<data>>("channel_mpmc");
+    test_single_producer_consumer<channel_mpmc_lock_free<data>>(
+        "channel_mpmc_lock_free");
+
+    int const num_producers =
+        (std::max)(1, int(hpx::get_num_worker_threads() / 2));
+
+    test_multiple_producers_consumers<channel_mpmc<data>>(
+        "channel_mpmc", num_producers);
+    test_multiple_producers_consumers<channel_mpmc_lock_free<data>>(
+        "channel_mpmc_lock_free", num_producers);
 
     return 0;
 }
@@ -0,0 +1,177 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_main.hpp>
+#include <hpx/synchronization/channel_mpmc.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+constexpr int NUM_WORKERS = 1000;
+constexpr int NUM_PRODUCERS = 8;
+constexpr int NUM_CONSUMERS = 8;
+constexpr int NUM_VALUES = 10000;
+
+using channel_type = hpx::lcos::local::channel_mpmc_lock_free<int>;
+
+///////////////////////////////////////////////////////////////////////////////
+int thread_func(int i, channel_type& channel, channel_type& next)
+{
+    HPX_TEST(channel.set_wait(std::move(i)));
+
+    int result = 0;
+    HPX_TEST(next.get_wait(&result));
+    return result;
+}
+
+void test_shift()
+{
+    std::vector<channel_type> channels;
+    channels.reserve(NUM_WORKERS);
+
+    std::vector<hpx::future<int>> workers;
+    workers.reserve(NUM_WORKERS);
+
+    for (int i = 0; i != NUM_WORKERS; ++i)
+    {
+        channels.emplace_back(std::size_t(1));
+    }
+
+    for (int i = 0; i != NUM_WORKERS; ++i)
+    {
+        workers.push_back(hpx::async(&thread_func, i, std::ref(channels[i]),
+            std::ref(channels[(i + 1) % NUM_WORKERS])));
+    }
+
+    hpx::wait_all(workers);
+
+    for (int i = 0; i != NUM_WORKERS; ++i)
+    {
+        HPX_TEST_EQ((i + 1) % NUM_WORKERS, workers[i].get());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_non_blocking()
+{
+    channel_type c(3);
+    HPX_TEST_EQ(c.capacity(), std::size_t(4));
+
+    HPX_TEST(!c.get());
+    for (int i = 0; i != 4; ++i)
+    {
+        HPX_TEST(c.set(std::move(i)));
+    }
+    HPX_TEST(!c.set(42));
+    HPX_TEST(c.get());
+
+    for (int i = 0; i != 4; ++i)
+    {
+        int value = -1;
+        HPX_TEST(c.get(&value));
+        HPX_TEST_EQ(value, i);
+    }
+    HPX_TEST(!c.get());
+
+    c.close();
+    HPX_TEST(!c.set(42));
+
+    bool caught_exception = false;
+    try
+    {
+        c.close();
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_multiple_producers_consumers()
+{
+    channel_type c(16);
+
+    std::vector<hpx::future<void>> producers;
+    producers.reserve(NUM_PRODUCERS);
+    for (int p = 0; p != NUM_PRODUCERS; ++p)
+    {
+        producers.push_back(hpx::async([&c]() {
+            for (int i = 1; i <= NUM_VALUES; ++i)
+            {
+                HPX_TEST(c.set_wait(std::move(i)));
+            }
+        }));
+    }
+
+    std::vector<hpx::future<std::int64_t>> consumers;
+    consumers.reserve(NUM_CONSUMERS);
+    for (int p = 0; p != NUM_CONSUMERS; ++p)
+    {
+        consumers.push_back(hpx::async([&c]() {
+            std::int64_t sum = 0;
+            int value = 0;
+            while (c.get_wait(&value))
+            {
+                sum += value;
+            }
+            return sum;
+        }));
+    }
+
+    hpx::wait_all(producers);
+
+    // wait for the consumers to drain the channel before closing it
+    while (c.get())
+    {
+        hpx::this_thread::yield();
+    }
+    c.close();
+
+    std::int64_t sum = 0;
+    for (auto&& f : consumers)
+    {
+        sum += f.get();
+    }
+
+    std::int64_t const expected = std::int64_t(NUM_PRODUCERS) * NUM_VALUES *
+        (NUM_VALUES + 1) / 2;
+    HPX_TEST_EQ(sum, expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_close_wakes_waiting()
+{
+    channel_type c(1);
+
+    hpx::future<bool> consumer = hpx::async([&c]() {
+        int value = 0;
+        return c.get_wait(&value);
+    });
+
+    hpx::this_thread::yield();
+    c.close();
+
+    HPX_TEST(!consumer.get());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_shift();
+    test_non_blocking();
+    test_multiple_producers_consumers();
+    test_close_wakes_waiting();
+
+    return hpx::util::report_errors();
+}
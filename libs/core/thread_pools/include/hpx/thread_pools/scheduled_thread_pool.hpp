@@ -15,6 +15,7 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/thread_pools/scheduling_loop.hpp>
 #include <hpx/threading_base/callback_notifier.hpp>
+#include <hpx/threading_base/latency_histogram.hpp>
 #include <hpx/threading_base/network_background_callback.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
@@ -76,6 +77,9 @@ namespace hpx { namespace threads { namespace detail {
 
         void create_work(thread_init_data& data, error_code& ec) override;
 
+        void create_work_bulk(thread_init_data* data, std::size_t count,
+            error_code& ec) override;
+
         thread_state set_state(thread_id_type const& id,
             thread_schedule_state new_state, thread_restart_state new_state_ex,
             thread_priority priority, error_code& ec) override;
@@ -234,6 +238,15 @@ namespace hpx { namespace threads { namespace detail {
         }
 #endif
 
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+        std::vector<std::int64_t> get_queue_wait_time_histogram(
+            std::size_t, bool) override;
+        std::vector<std::int64_t> get_thread_phase_duration_histogram(
+            std::size_t, bool) override;
+        std::vector<std::int64_t> get_resume_latency_histogram(
+            std::size_t, bool) override;
+#endif
+
         std::int64_t get_executed_threads() const;
 
 #if defined(HPX_HAVE_THREAD_CUMULATIVE_COUNTS)
@@ -305,6 +318,12 @@ namespace hpx { namespace threads { namespace detail {
         void resume_internal(bool blocking, error_code& ec);
         void suspend_internal(error_code& ec);
 
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+        std::vector<std::int64_t> get_latency_histogram(
+            latency_histogram thread_latency_histograms::*histogram,
+            std::size_t num, bool reset);
+#endif
+
         void remove_processing_unit_internal(
             std::size_t virt_core, error_code& = hpx::throws);
         void add_processing_unit_internal(std::size_t virt_core,
@@ -400,6 +419,11 @@ namespace hpx { namespace threads { namespace detail {
 
             // scheduler utilization data
             bool tasks_active_;
+
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+            // scheduling latency histograms
+            thread_latency_histograms latency_histograms_;
+#endif
         };
 
         std::vector<scheduling_counter_data> counter_data_;
@@ -193,7 +193,7 @@ namespace hpx { namespace threads { namespace detail {
             sched_->Scheduler::set_all_states_at_least(state_stopping);
 
             // make sure we're not waiting
-            sched_->Scheduler::do_some_work(std::size_t(-1));
+            sched_->Scheduler::wake_up_all_idle_threads();
 
             if (blocking)
             {
@@ -206,7 +206,7 @@ namespace hpx { namespace threads { namespace detail {
                     // make sure no OS thread is waiting
                     LTM_(info) << "stop: " << id_.name() << " notify_all";
 
-                    sched_->Scheduler::do_some_work(std::size_t(-1));
+                    sched_->Scheduler::wake_up_all_idle_threads();
 
                     LTM_(info) << "stop: " << id_.name() << " join:" << i;
 
@@ -487,6 +487,11 @@ namespace hpx { namespace threads { namespace detail {
                     counter_data.tasks_active_);
 #endif    // HPX_HAVE_BACKGROUND_THREAD_COUNTERS
 
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+                counters.latency_histograms_ =
+                    &counter_data.latency_histograms_;
+#endif
+
                 detail::scheduling_callbacks callbacks(
                     util::deferred_call(    //-V107
                         &policies::scheduler_base::idle_callback, sched_.get(),
@@ -612,6 +617,26 @@ namespace hpx { namespace threads { namespace detail {
         ++tasks_scheduled_;
     }
 
+    template <typename Scheduler>
+    void scheduled_thread_pool<Scheduler>::create_work_bulk(
+        thread_init_data* data, std::size_t count, error_code& ec)
+    {
+        // verify state
+        if (thread_count_ == 0 && !sched_->Scheduler::is_state(state_running))
+        {
+            // thread-manager is not currently running
+            HPX_THROWS_IF(ec, invalid_status,
+                "thread_pool<Scheduler>::create_work_bulk",
+                "invalid state: thread pool is not running");
+            return;
+        }
+
+        detail::create_work_bulk(sched_.get(), data, count, ec);    //-V601
+
+        // update statistics
+        tasks_scheduled_ += static_cast<std::int64_t>(count);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Scheduler>
     thread_state scheduled_thread_pool<Scheduler>::set_state(
@@ -1770,6 +1795,55 @@ namespace hpx { namespace threads { namespace detail {
         return counter_data_[num].busy_loop_counts_;
     }
 
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+    template <typename Scheduler>
+    std::vector<std::int64_t>
+    scheduled_thread_pool<Scheduler>::get_latency_histogram(
+        latency_histogram thread_latency_histograms::*histogram,
+        std::size_t num, bool reset)
+    {
+        std::vector<std::int64_t> counts(latency_histogram::num_buckets, 0);
+        if (num == std::size_t(-1))
+        {
+            for (auto& data : counter_data_)
+                (data.latency_histograms_.*histogram).add_to(counts, reset);
+        }
+        else
+        {
+            (counter_data_[num].latency_histograms_.*histogram)
+                .add_to(counts, reset);
+        }
+        return counts;
+    }
+
+    template <typename Scheduler>
+    std::vector<std::int64_t>
+    scheduled_thread_pool<Scheduler>::get_queue_wait_time_histogram(
+        std::size_t num, bool reset)
+    {
+        return get_latency_histogram(
+            &thread_latency_histograms::queue_wait_time_, num, reset);
+    }
+
+    template <typename Scheduler>
+    std::vector<std::int64_t>
+    scheduled_thread_pool<Scheduler>::get_thread_phase_duration_histogram(
+        std::size_t num, bool reset)
+    {
+        return get_latency_histogram(
+            &thread_latency_histograms::phase_duration_, num, reset);
+    }
+
+    template <typename Scheduler>
+    std::vector<std::int64_t>
+    scheduled_thread_pool<Scheduler>::get_resume_latency_histogram(
+        std::size_t num, bool reset)
+    {
+        return get_latency_histogram(
+            &thread_latency_histograms::resume_latency_, num, reset);
+    }
+#endif
+
     template <typename Scheduler>
     std::int64_t scheduled_thread_pool<Scheduler>::get_scheduler_utilization()
         const
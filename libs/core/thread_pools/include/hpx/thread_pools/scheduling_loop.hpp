@@ -13,6 +13,7 @@
 #include <hpx/hardware/timestamp.hpp>
 #include <hpx/modules/itt_notify.hpp>
 #include <hpx/modules/logging.hpp>
+#include <hpx/threading_base/latency_histogram.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
 #include <hpx/threading_base/thread_data.hpp>
@@ -26,6 +27,10 @@
 #include <hpx/threading_base/external_timer.hpp>
 #endif
 
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+#include <hpx/timing/high_resolution_clock.hpp>
+#endif
+
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
@@ -318,6 +323,49 @@ namespace hpx { namespace threads { namespace detail {
         bool& is_active_;
     };
 
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+    ///////////////////////////////////////////////////////////////////////////
+    // Record the scheduling latency of the thread about to be run and the
+    // duration of its activation
+    struct latency_histograms_wrapper
+    {
+        latency_histograms_wrapper(
+            thread_latency_histograms* histograms, thread_data* thrd)
+          : histograms_(nullptr)
+          , start_(0)
+        {
+            if (histograms == nullptr || !get_latency_histograms_enabled())
+                return;
+
+            histograms_ = histograms;
+            start_ = hpx::chrono::high_resolution_clock::now();
+
+            std::uint64_t const ready_time = thrd->get_ready_time();
+            bool const activated = thrd->set_activated();
+            if (ready_time != 0 && ready_time <= start_)
+            {
+                if (activated)
+                    histograms_->resume_latency_.record(start_ - ready_time);
+                else
+                    histograms_->queue_wait_time_.record(start_ - ready_time);
+            }
+            thrd->set_ready_time(0);
+        }
+
+        ~latency_histograms_wrapper()
+        {
+            if (histograms_ != nullptr)
+            {
+                histograms_->phase_duration_.record(
+                    hpx::chrono::high_resolution_clock::now() - start_);
+            }
+        }
+
+        thread_latency_histograms* histograms_;
+        std::uint64_t start_;
+    };
+#endif
+
     ///////////////////////////////////////////////////////////////////////////
 #if defined(HPX_HAVE_BACKGROUND_THREAD_COUNTERS) &&                            \
     defined(HPX_HAVE_THREAD_IDLE_RATES)
@@ -353,6 +401,9 @@ namespace hpx { namespace threads { namespace detail {
         std::int64_t& background_send_duration_;
         std::int64_t& background_receive_duration_;
         bool& is_active_;
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+        thread_latency_histograms* latency_histograms_ = nullptr;
+#endif
     };
 #else
     struct scheduling_counters
@@ -378,6 +429,9 @@ namespace hpx { namespace threads { namespace detail {
         std::int64_t& idle_loop_count_;
         std::int64_t& busy_loop_count_;
         bool& is_active_;
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+        thread_latency_histograms* latency_histograms_ = nullptr;
+#endif
     };
 
 #endif    // HPX_HAVE_BACKGROUND_THREAD_COUNTERS
@@ -690,6 +744,10 @@ namespace hpx { namespace threads { namespace detail {
                                 // and add to aggregate execution time.
                                 exec_time_wrapper exec_time_collector(
                                     idle_rate);
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+                                latency_histograms_wrapper latency_collector(
+                                    counters.latency_histograms_, thrd);
+#endif
 
 #if defined(HPX_HAVE_APEX)
                                 // get the APEX data pointer, in case we are resuming the
@@ -69,3 +69,11 @@ template class HPX_CORE_EXPORT
 template class HPX_CORE_EXPORT hpx::threads::detail::scheduled_thread_pool<
     hpx::threads::policies::shared_priority_queue_scheduler<>>;
 #endif
+
+#if defined(HPX_HAVE_WORK_STEALING_SCHEDULER)
+#include <hpx/schedulers/work_stealing_queue_scheduler.hpp>
+template class HPX_CORE_EXPORT
+    hpx::threads::policies::work_stealing_queue_scheduler<>;
+template class HPX_CORE_EXPORT hpx::threads::detail::scheduled_thread_pool<
+    hpx::threads::policies::work_stealing_queue_scheduler<>>;
+#endif
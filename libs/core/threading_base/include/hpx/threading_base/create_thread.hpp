@@ -9,6 +9,7 @@
 #include <hpx/config.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/logging.hpp>
+#include <hpx/threading_base/latency_histogram.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
@@ -88,6 +89,10 @@ namespace hpx { namespace threads { namespace detail {
             data.priority = thread_priority::normal;
 
         // create the new thread
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+        data.ready_time = get_ready_time_stamp();
+#endif
+
         scheduler->create_thread(data, &id, ec);
 
         // NOLINTNEXTLINE(bugprone-branch-clone)
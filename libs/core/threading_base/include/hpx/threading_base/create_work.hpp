@@ -9,15 +9,21 @@
 #include <hpx/config.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/logging.hpp>
+#include <hpx/threading_base/latency_histogram.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
+#include <hpx/threading_base/thread_pool_base.hpp>
 
+#include <algorithm>
+#include <cstddef>
 #include <sstream>
 
 namespace hpx { namespace threads { namespace detail {
-    inline void create_work(policies::scheduler_base* scheduler,
-        thread_init_data& data, error_code& ec = throws)
+    // verify the parameters of a new work item and fill in the defaults,
+    // returns false if the parameters are invalid
+    inline bool prepare_work(policies::scheduler_base* scheduler,
+        thread_init_data& data, error_code& ec)
     {
         // verify parameters
         switch (data.initial_state)
@@ -35,7 +41,7 @@ namespace hpx { namespace threads { namespace detail {
                  << get_thread_state_name(data.initial_state);
             HPX_THROWS_IF(
                 ec, bad_parameter, "thread::detail::create_work", strm.str());
-            return;
+            return false;
         }
         }
 
@@ -44,7 +50,7 @@ namespace hpx { namespace threads { namespace detail {
         {
             HPX_THROWS_IF(ec, bad_parameter, "thread::detail::create_work",
                 "description is nullptr");
-            return;
+            return false;
         }
 #endif
 
@@ -94,10 +100,48 @@ namespace hpx { namespace threads { namespace detail {
             thread_priority::high_recursive == data.priority ||
             thread_priority::boost == data.priority);
 
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+        data.ready_time = get_ready_time_stamp();
+#endif
+
+        return true;
+    }
+
+    inline void create_work(policies::scheduler_base* scheduler,
+        thread_init_data& data, error_code& ec = throws)
+    {
+        if (!prepare_work(scheduler, data, ec))
+            return;
+
         scheduler->create_thread(data, nullptr, ec);
 
         // NOTE: Don't care if the hint is a NUMA hint, just want to wake up a
         // thread.
         scheduler->do_some_work(data.schedulehint.hint);
     }
+
+    // Create a batch of work items at once, letting the scheduler
+    // distribute them over its queues in one go.
+    inline void create_work_bulk(policies::scheduler_base* scheduler,
+        thread_init_data* data, std::size_t count, error_code& ec = throws)
+    {
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            if (!prepare_work(scheduler, data[i], ec))
+                return;
+        }
+
+        scheduler->create_threads(data, count, ec);
+        if (ec)
+            return;
+
+        // wake up as many (possibly idling) worker threads as there are new
+        // work items
+        std::size_t const num_threads =
+            scheduler->get_parent_pool()->get_os_thread_count();
+        for (std::size_t i = 0; i != (std::min)(count, num_threads); ++i)
+        {
+            scheduler->do_some_work(std::size_t(-1));
+        }
+    }
 }}}    // namespace hpx::threads::detail
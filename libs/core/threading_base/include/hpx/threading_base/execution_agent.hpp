@@ -15,6 +15,7 @@
 #include <hpx/execution_base/agent_base.hpp>
 #include <hpx/execution_base/context_base.hpp>
 #include <hpx/execution_base/resource_base.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
 #include <hpx/timing/steady_clock.hpp>
 
 #include <cstddef>
@@ -66,6 +67,39 @@ namespace hpx { namespace threads {
 
         execution_context context_;
     };
+
+    /// The execution agent of threads created without a stack of their own
+    /// (thread_stacksize::nostack). Those run to completion on the stack of
+    /// the worker thread, any attempt to suspend them is reported as an
+    /// error. Spinning (yield_k) backs off on the worker thread instead.
+    struct HPX_CORE_EXPORT stackless_execution_agent
+      : hpx::execution_base::agent_base
+    {
+        explicit stackless_execution_agent(thread_data* thrd) noexcept;
+
+        std::string description() const override;
+
+        execution_context const& context() const override
+        {
+            return context_;
+        }
+
+        void yield(char const* desc) override;
+        void yield_k(std::size_t k, char const* desc) override;
+        void suspend(char const* desc) override;
+        void resume(char const* desc) override;
+        void abort(char const* desc) override;
+        void sleep_for(hpx::chrono::steady_duration const& sleep_duration,
+            char const* desc) override;
+        void sleep_until(hpx::chrono::steady_time_point const& sleep_time,
+            char const* desc) override;
+
+    private:
+        HPX_NORETURN void throw_not_suspendable(char const* desc) const;
+
+        thread_data* thrd_;
+        execution_context context_;
+    };
 }}    // namespace hpx::threads
 
 #include <hpx/config/warnings_suffix.hpp>
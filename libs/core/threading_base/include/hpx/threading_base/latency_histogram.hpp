@@ -0,0 +1,186 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+#include <hpx/assert.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace hpx { namespace threads {
+    ///////////////////////////////////////////////////////////////////////////
+    // Latency histograms are recorded only after the first corresponding
+    // performance counter has been created.
+    HPX_CORE_EXPORT void set_latency_histograms_enabled(bool enabled);
+    HPX_CORE_EXPORT bool get_latency_histograms_enabled();
+
+    // Return the time stamp to store for a thread which is being made ready
+    // to run, zero if latencies are not being recorded
+    inline std::uint64_t get_ready_time_stamp()
+    {
+        return get_latency_histograms_enabled() ?
+            hpx::chrono::high_resolution_clock::now() :
+            0;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A latency_histogram collects durations (in nanoseconds) into log-linear
+    // buckets (as HDR histograms do): values smaller than sub_bucket_count
+    // have a bucket of their own, larger values are grouped by their most
+    // significant bit into sub_bucket_count linearly spaced buckets each.
+    // This keeps the relative error of each bucket below
+    // 1/sub_bucket_count while covering values up to 2^(max_exponent+1)
+    // with a fixed number of buckets. Larger values are accounted for in the
+    // last bucket.
+    //
+    // A histogram is updated by one worker thread only, but may be read (and
+    // reset) concurrently by the performance counters.
+    class latency_histogram
+    {
+    public:
+        static constexpr std::size_t sub_bucket_bits = 4;
+        static constexpr std::size_t sub_bucket_count = std::size_t(1)
+            << sub_bucket_bits;
+        static constexpr std::size_t max_exponent = 40;
+        static constexpr std::size_t num_buckets =
+            sub_bucket_count * (max_exponent - sub_bucket_bits + 2);
+
+        latency_histogram() noexcept
+        {
+            for (auto& bucket : buckets_)
+                bucket.store(0, std::memory_order_relaxed);
+        }
+
+        // required for histograms to be stored in a std::vector
+        latency_histogram(latency_histogram const& rhs) noexcept
+        {
+            for (std::size_t i = 0; i != num_buckets; ++i)
+            {
+                buckets_[i].store(
+                    rhs.buckets_[i].load(std::memory_order_relaxed),
+                    std::memory_order_relaxed);
+            }
+        }
+
+        latency_histogram& operator=(latency_histogram const&) = delete;
+
+        // Return the index of the bucket the given value is accounted for
+        static std::size_t bucket_index(std::uint64_t value) noexcept
+        {
+            if (value < sub_bucket_count)
+                return static_cast<std::size_t>(value);
+
+            std::size_t exponent = most_significant_bit(value);
+            if (exponent > max_exponent)
+                return num_buckets - 1;
+
+            std::size_t const sub_bucket =
+                static_cast<std::size_t>(
+                    value >> (exponent - sub_bucket_bits)) -
+                sub_bucket_count;
+            return sub_bucket_count +
+                (exponent - sub_bucket_bits) * sub_bucket_count + sub_bucket;
+        }
+
+        // Return the smallest value accounted for in the given bucket
+        static std::uint64_t bucket_lower_bound(std::size_t index) noexcept
+        {
+            HPX_ASSERT(index < num_buckets);
+
+            if (index < sub_bucket_count)
+                return index;
+
+            std::size_t const shift =
+                (index - sub_bucket_count) / sub_bucket_count;
+            std::size_t const sub_bucket =
+                (index - sub_bucket_count) % sub_bucket_count;
+            return std::uint64_t(sub_bucket_count + sub_bucket) << shift;
+        }
+
+        void record(std::uint64_t value) noexcept
+        {
+            buckets_[bucket_index(value)].fetch_add(
+                1, std::memory_order_relaxed);
+        }
+
+        // Add the bucket counts of this histogram to the given ones,
+        // optionally resetting this histogram
+        void add_to(std::vector<std::int64_t>& counts, bool reset) noexcept
+        {
+            HPX_ASSERT(counts.size() == num_buckets);
+            for (std::size_t i = 0; i != num_buckets; ++i)
+            {
+                counts[i] += reset ?
+                    buckets_[i].exchange(0, std::memory_order_relaxed) :
+                    buckets_[i].load(std::memory_order_relaxed);
+            }
+        }
+
+        // Convert raw bucket counts into the representation exposed by the
+        // performance counters: the number of sub-bucket bits, the overall
+        // number of recorded values, and the bucket counts (with trailing
+        // empty buckets removed).
+        static std::vector<std::int64_t> get_counter_values(
+            std::vector<std::int64_t> const& counts)
+        {
+            std::size_t size = counts.size();
+            while (size != 0 && counts[size - 1] == 0)
+                --size;
+
+            std::vector<std::int64_t> result;
+            result.reserve(size + 2);
+            result.push_back(std::int64_t(sub_bucket_bits));
+            result.push_back(0);
+            for (std::size_t i = 0; i != size; ++i)
+            {
+                result[1] += counts[i];
+                result.push_back(counts[i]);
+            }
+            return result;
+        }
+
+    private:
+        static std::size_t most_significant_bit(std::uint64_t value) noexcept
+        {
+            HPX_ASSERT(value != 0);
+#if defined(__GNUC__) || defined(__clang__)
+            return 63 - static_cast<std::size_t>(__builtin_clzll(value));
+#else
+            std::size_t result = 0;
+            while (value >>= 1)
+                ++result;
+            return result;
+#endif
+        }
+
+        std::atomic<std::int64_t> buckets_[num_buckets];
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The latency histograms maintained for each worker thread
+    struct thread_latency_histograms
+    {
+        // time pending threads have waited before being run for the first
+        // time
+        latency_histogram queue_wait_time_;
+
+        // duration of each activation (phase) of a thread
+        latency_histogram phase_duration_;
+
+        // time threads have waited after being resumed from suspension
+        // before being run again
+        latency_histogram resume_latency_;
+    };
+}}    // namespace hpx::threads
+
+#endif
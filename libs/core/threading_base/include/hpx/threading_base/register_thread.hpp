@@ -223,6 +223,34 @@ namespace hpx { namespace threads {
         register_work(data, detail::get_self_or_default_pool(), ec);
     }
 
+    /// \brief Create new work items for all of the given data at once.
+    ///
+    /// \param data       [in] The data to use for creating the threads.
+    /// \param count      [in] The number of elements in \a data.
+    /// \param pool       [in] The thread pool to use for launching the work.
+    /// \param ec         [in,out] This represents the error status on exit,
+    ///                   if this is pre-initialized to \a hpx#throws
+    ///                   the function will throw on error instead.
+    ///
+    /// \throws invalid_status if the runtime system has not been started yet.
+    ///
+    /// \note             This is equivalent to calling \a register_work for
+    ///                   each of the elements of \a data, except that the
+    ///                   scheduler distributes all work items over its
+    ///                   queues in one go, acquiring each queue's lock at
+    ///                   most once.
+    inline void register_work_bulk(threads::thread_init_data* data,
+        std::size_t count, threads::thread_pool_base* pool,
+        error_code& ec = throws)
+    {
+        HPX_ASSERT(pool);
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            data[i].run_now = false;
+        }
+        pool->create_work_bulk(data, count, ec);
+    }
+
 #if defined(HPX_HAVE_REGISTER_THREAD_OVERLOADS_COMPATIBILITY)
     inline threads::thread_id_type register_thread_plain(
         threads::thread_pool_base* pool, threads::thread_init_data& data,
@@ -9,6 +9,7 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/concurrency/event_count.hpp>
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/format.hpp>
@@ -88,6 +89,10 @@ namespace hpx { namespace threads { namespace policies {
         /// possibly idling OS threads
         void do_some_work(std::size_t);
 
+        /// This function gets called whenever all idling OS threads have to
+        /// be reactivated (for instance while stopping the scheduler)
+        void wake_up_all_idle_threads();
+
         virtual void suspend(std::size_t num_thread);
         virtual void resume(std::size_t num_thread);
 
@@ -210,6 +215,13 @@ namespace hpx { namespace threads { namespace policies {
         virtual void create_thread(
             thread_init_data& data, thread_id_type* id, error_code& ec) = 0;
 
+        // Create threads for all of the given work items at once. The
+        // default implementation creates them one by one, schedulers may
+        // override this to amortize the cost of selecting the target queues
+        // and of acquiring their locks over the whole batch.
+        virtual void create_threads(
+            thread_init_data* data, std::size_t count, error_code& ec);
+
         virtual bool get_next_thread(std::size_t num_thread, bool running,
             threads::thread_data*& thrd, bool enable_stealing) = 0;
 
@@ -330,6 +342,9 @@ namespace hpx { namespace threads { namespace policies {
         std::vector<util::cache_line_data<idle_backoff_data>> wait_counts_;
 #endif
 
+        // support for parking OS threads on idle queues
+        util::cache_line_data<util::event_count> idle_event_;
+
         // support for suspension of pus
         std::vector<pu_mutex_type> suspend_mtxs_;
         std::vector<std::condition_variable> suspend_conds_;
@@ -58,6 +58,11 @@ namespace hpx { namespace threads { namespace policies {
         /// This option allows for certain schedulers to explicitly disable
         /// exponential idle-back off
         enable_idle_backoff = 0x0800,
+        /// This option makes idle OS threads park on an event count (a futex
+        /// where available) instead of sleeping with exponential back-off.
+        /// Parked threads are woken up one at a time whenever new work is
+        /// made available.
+        enable_idle_parking = 0x1000,
 
         // clang-format off
         /// This option represents the default mode.
@@ -83,7 +88,8 @@ namespace hpx { namespace threads { namespace policies {
             assign_work_thread_parent |
             steal_high_priority_first |
             steal_after_local |
-            enable_idle_backoff
+            enable_idle_backoff |
+            enable_idle_parking
         // clang-format on
     };
 }}}    // namespace hpx::threads::policies
@@ -16,6 +16,7 @@
 #include <hpx/modules/logging.hpp>
 #include <hpx/threading_base/create_thread.hpp>
 #include <hpx/threading_base/create_work.hpp>
+#include <hpx/threading_base/latency_histogram.hpp>
 #include <hpx/threading_base/register_thread.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 
@@ -285,6 +286,9 @@ namespace hpx { namespace threads { namespace detail {
 
             auto* thrd_data = get_thread_id_data(thrd);
             auto* scheduler = thrd_data->get_scheduler_base();
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+            thrd_data->set_ready_time(get_ready_time_stamp());
+#endif
             scheduler->schedule_thread(
                 thrd_data, schedulehint, false, thrd_data->get_priority());
             // NOTE: Don't care if the hint is a NUMA hint, just want to wake up
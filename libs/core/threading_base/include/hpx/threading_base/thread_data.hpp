@@ -532,12 +532,58 @@ namespace hpx { namespace threads {
             return stacksize_enum_;
         }
 
+        // stackless threads run on the stack of the worker thread and can't
+        // be suspended
+        bool is_stackless() const noexcept
+        {
+            return is_stackless_;
+        }
+
         template <typename ThreadQueue>
         ThreadQueue& get_queue() noexcept
         {
             return *static_cast<ThreadQueue*>(queue_);
         }
 
+        // Intrusive list hook allowing for the queue owning this thread to
+        // keep track of it without allocating (see policies::thread_registry).
+        // The hook is accessed only while holding the owning queue's lock.
+        struct registry_hook
+        {
+            thread_data* prev = nullptr;
+            thread_data* next = nullptr;
+        };
+
+        registry_hook& get_registry_hook() noexcept
+        {
+            return registry_hook_;
+        }
+        registry_hook const& get_registry_hook() const noexcept
+        {
+            return registry_hook_;
+        }
+
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+        // Time stamp of when this thread was made ready to run (zero if not
+        // known), used for recording the scheduling latencies.
+        std::uint64_t get_ready_time() const noexcept
+        {
+            return ready_time_;
+        }
+        void set_ready_time(std::uint64_t ready_time) noexcept
+        {
+            ready_time_ = ready_time;
+        }
+
+        // Return whether this thread has been run before, marking it as such
+        bool set_activated() noexcept
+        {
+            bool activated = activated_;
+            activated_ = true;
+            return activated;
+        }
+#endif
+
         /// \brief Execute the thread function
         ///
         /// \returns        This function returns the thread state the thread
@@ -645,6 +691,12 @@ namespace hpx { namespace threads {
         thread_stacksize stacksize_enum_;
 
         void* queue_;
+        registry_hook registry_hook_;
+
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+        std::uint64_t ready_time_;
+        bool activated_;
+#endif
 
     public:
 #if defined(HPX_HAVE_APEX)
@@ -745,7 +797,8 @@ namespace hpx { namespace threads {
     {
         if (is_stackless_)
         {
-            return static_cast<thread_data_stackless*>(this)->call();
+            return static_cast<thread_data_stackless*>(this)->call(
+                agent_storage);
         }
         return static_cast<thread_data_stackful*>(this)->call(agent_storage);
     }
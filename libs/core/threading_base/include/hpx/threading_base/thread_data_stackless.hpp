@@ -14,7 +14,9 @@
 #include <hpx/coroutines/stackless_coroutine.hpp>
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/functional/function.hpp>
+#include <hpx/execution_base/this_thread.hpp>
 #include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/execution_agent.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
 
@@ -55,11 +57,15 @@ namespace hpx { namespace threads {
         static util::internal_allocator<thread_data_stackless> thread_alloc_;
 
     public:
-        stackless_coroutine_type::result_type call()
+        stackless_coroutine_type::result_type call(
+            hpx::execution_base::this_thread::detail::agent_storage*
+                agent_storage)
         {
             HPX_ASSERT(get_state().state() == thread_schedule_state::active);
             HPX_ASSERT(this == coroutine_.get_thread_id().get());
 
+            hpx::execution_base::this_thread::reset_agent ctx(
+                agent_storage, agent_);
             return coroutine_(this->thread_data::set_state_ex(
                 thread_restart_state::signaled));
         }
@@ -134,6 +140,7 @@ namespace hpx { namespace threads {
             thread_init_data& init_data, void* queue, std::ptrdiff_t stacksize)
           : thread_data(init_data, queue, stacksize, true)
           , coroutine_(std::move(init_data.func), thread_id_type(this_()))
+          , agent_(this_())
         {
             HPX_ASSERT(coroutine_.is_ready());
         }
@@ -151,6 +158,7 @@ namespace hpx { namespace threads {
 
     private:
         stackless_coroutine_type coroutine_;
+        stackless_execution_agent agent_;
     };
 
     ////////////////////////////////////////////////////////////////////////////
@@ -45,6 +45,9 @@ namespace hpx { namespace threads {
           , initial_state(thread_schedule_state::pending)
           , run_now(false)
           , scheduler_base(nullptr)
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+          , ready_time(0)
+#endif
         {
         }
 
@@ -57,6 +60,9 @@ namespace hpx { namespace threads {
             initial_state = rhs.initial_state;
             run_now = rhs.run_now;
             scheduler_base = rhs.scheduler_base;
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+            ready_time = rhs.ready_time;
+#endif
 #if defined(HPX_HAVE_THREAD_DESCRIPTION)
             description = rhs.description;
 #endif
@@ -95,6 +101,9 @@ namespace hpx { namespace threads {
           , initial_state(rhs.initial_state)
           , run_now(rhs.run_now)
           , scheduler_base(rhs.scheduler_base)
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+          , ready_time(rhs.ready_time)
+#endif
         {
         }
 
@@ -128,6 +137,9 @@ namespace hpx { namespace threads {
           , initial_state(initial_state_)
           , run_now(run_now_)
           , scheduler_base(scheduler_base_)
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+          , ready_time(0)
+#endif
         {
             HPX_UNUSED(desc);
         }
@@ -155,5 +167,11 @@ namespace hpx { namespace threads {
         bool run_now;
 
         policies::scheduler_base* scheduler_base;
+
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+        // time stamp of when the new thread was made ready to run (zero if
+        // latencies are not being recorded)
+        std::uint64_t ready_time;
+#endif
     };
 }}    // namespace hpx::threads
@@ -235,6 +235,8 @@ namespace hpx { namespace threads {
         virtual void create_thread(
             thread_init_data& data, thread_id_type& id, error_code& ec) = 0;
         virtual void create_work(thread_init_data& data, error_code& ec) = 0;
+        virtual void create_work_bulk(
+            thread_init_data* data, std::size_t count, error_code& ec);
 
         virtual thread_state set_state(thread_id_type const& id,
             thread_schedule_state new_state, thread_restart_state new_state_ex,
@@ -384,6 +386,26 @@ namespace hpx { namespace threads {
             return 0;
         }
 
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+        // The latency histograms return the raw bucket counts as collected
+        // by latency_histogram
+        virtual std::vector<std::int64_t> get_queue_wait_time_histogram(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return std::vector<std::int64_t>();
+        }
+        virtual std::vector<std::int64_t> get_thread_phase_duration_histogram(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return std::vector<std::int64_t>();
+        }
+        virtual std::vector<std::int64_t> get_resume_latency_histogram(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return std::vector<std::int64_t>();
+        }
+#endif
+
 #if defined(HPX_HAVE_THREAD_QUEUE_WAITTIME)
         virtual std::int64_t get_average_thread_wait_time(
             std::size_t /*thread_num*/, bool /*reset*/)
@@ -29,6 +29,7 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <utility>
 
 namespace hpx { namespace threads {
@@ -298,4 +299,81 @@ namespace hpx { namespace threads {
             scheduler->do_some_work(hint.hint);
         }
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    stackless_execution_agent::stackless_execution_agent(
+        thread_data* thrd) noexcept
+      : thrd_(thrd)
+    {
+    }
+
+    std::string stackless_execution_agent::description() const
+    {
+        return hpx::util::format(
+            "{}: {}", thrd_->get_thread_id(), thrd_->get_description());
+    }
+
+    void stackless_execution_agent::throw_not_suspendable(
+        char const* desc) const
+    {
+        HPX_THROW_EXCEPTION(invalid_status, desc,
+            hpx::util::format("thread({}) was created without a stack "
+                              "(thread_stacksize::nostack) and can't be "
+                              "suspended",
+                description()));
+    }
+
+    void stackless_execution_agent::yield(char const* desc)
+    {
+        throw_not_suspendable(desc);
+    }
+
+    void stackless_execution_agent::yield_k(
+        std::size_t k, char const* /* desc */)
+    {
+        // spinning threads back off on the worker thread, they are never
+        // suspended
+        if (k < 4)    //-V112
+        {
+        }
+#if defined(HPX_SMT_PAUSE)
+        else if (k < 16)
+        {
+            HPX_SMT_PAUSE;
+        }
+#endif
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    void stackless_execution_agent::suspend(char const* desc)
+    {
+        throw_not_suspendable(desc);
+    }
+
+    void stackless_execution_agent::resume(char const* desc)
+    {
+        throw_not_suspendable(desc);
+    }
+
+    void stackless_execution_agent::abort(char const* desc)
+    {
+        throw_not_suspendable(desc);
+    }
+
+    void stackless_execution_agent::sleep_for(
+        hpx::chrono::steady_duration const& /* sleep_duration */,
+        char const* desc)
+    {
+        throw_not_suspendable(desc);
+    }
+
+    void stackless_execution_agent::sleep_until(
+        hpx::chrono::steady_time_point const& /* sleep_time */,
+        char const* desc)
+    {
+        throw_not_suspendable(desc);
+    }
 }}    // namespace hpx::threads
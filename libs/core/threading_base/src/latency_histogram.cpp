@@ -0,0 +1,26 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/threading_base/latency_histogram.hpp>
+
+#include <atomic>
+
+namespace hpx { namespace threads {
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+    static std::atomic<bool> latency_histograms_enabled(false);
+
+    void set_latency_histograms_enabled(bool enabled)
+    {
+        latency_histograms_enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool get_latency_histograms_enabled()
+    {
+        return latency_histograms_enabled.load(std::memory_order_relaxed);
+    }
+#endif
+}}    // namespace hpx::threads
@@ -6,6 +6,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/coroutines/detail/stack_pool.hpp>
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
@@ -67,6 +68,42 @@ namespace hpx { namespace threads { namespace policies {
 
     void scheduler_base::idle_callback(std::size_t num_thread)
     {
+#if defined(HPX_HAVE_THREAD_STACK_POOL)
+        // release the memory of surplus idle stacks while there is nothing
+        // else to do
+        if (coroutines::detail::posix::use_stack_pool)
+        {
+            coroutines::detail::posix::stack_pool::trim();
+        }
+#endif
+
+        if (mode_.data_.load(std::memory_order_relaxed) &
+            policies::enable_idle_parking)
+        {
+            // Park this thread until new work is made available. The thread
+            // announces its intent to wait before re-checking the queues, thus
+            // work added concurrently is guaranteed to either be seen here or
+            // to wake up this thread.
+            util::event_count& ec = idle_event_.data_;
+            util::event_count::key_type key = ec.prepare_wait();
+
+            HPX_ASSERT(num_thread < states_.size());
+            if (states_[num_thread].load(std::memory_order_relaxed) !=
+                    state_running ||
+                get_queue_length(std::size_t(-1)) != 0)
+            {
+                ec.cancel_wait();
+                return;
+            }
+
+            // wake up periodically nevertheless to allow for background work
+            // and polling to make progress
+            ec.wait(key,
+                std::chrono::milliseconds(std::lround(
+                    thread_queue_init_.max_idle_backoff_time_)));
+            return;
+        }
+
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
         if (mode_.data_.load(std::memory_order_relaxed) &
             policies::enable_idle_backoff)
@@ -102,6 +139,15 @@ namespace hpx { namespace threads { namespace policies {
     /// possibly idling OS threads
     void scheduler_base::do_some_work(std::size_t)
     {
+        if (mode_.data_.load(std::memory_order_relaxed) &
+            policies::enable_idle_parking)
+        {
+            // one parked thread is sufficient to pick up the new work, this
+            // is a no-op if no thread is parked
+            idle_event_.data_.notify_one();
+            return;
+        }
+
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
         if (mode_.data_.load(std::memory_order_relaxed) &
             policies::enable_idle_backoff)
@@ -111,6 +157,28 @@ namespace hpx { namespace threads { namespace policies {
 #endif
     }
 
+    void scheduler_base::create_threads(
+        thread_init_data* data, std::size_t count, error_code& ec)
+    {
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            create_thread(data[i], nullptr, ec);
+            if (ec)
+                return;
+        }
+    }
+
+    void scheduler_base::wake_up_all_idle_threads()
+    {
+        // the scheduler mode might have changed since the threads started
+        // waiting, wake up all of them regardless
+        idle_event_.data_.notify_all();
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        cond_.notify_all();
+#endif
+    }
+
     void scheduler_base::suspend(std::size_t num_thread)
     {
         HPX_ASSERT(num_thread < suspend_conds_.size());
@@ -315,7 +383,7 @@ namespace hpx { namespace threads { namespace policies {
     {
         // distribute the same value across all cores
         mode_.data_.store(mode, std::memory_order_release);
-        do_some_work(std::size_t(-1));
+        wake_up_all_idle_threads();
     }
 
     void scheduler_base::add_scheduler_mode(scheduler_mode mode)
@@ -72,6 +72,10 @@ namespace hpx { namespace threads {
       , stacksize_(stacksize)
       , stacksize_enum_(init_data.stacksize)
       , queue_(queue)
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+      , ready_time_(init_data.ready_time)
+      , activated_(false)
+#endif
       , is_stackless_(is_stackless)
     {
         LTM_(debug) << "thread::thread(" << this << "), description("
@@ -207,6 +211,10 @@ namespace hpx { namespace threads {
         exit_funcs_.clear();
         scheduler_base_ = init_data.scheduler_base;
         last_worker_thread_num_ = std::size_t(-1);
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+        ready_time_ = init_data.ready_time;
+        activated_ = false;
+#endif
 
         HPX_ASSERT(stacksize_ == get_stack_size());
         HPX_ASSERT(stacksize_ != 0);
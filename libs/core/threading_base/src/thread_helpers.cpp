@@ -422,6 +422,26 @@ namespace hpx { namespace threads {
 }}    // namespace hpx::threads
 
 namespace hpx { namespace this_thread {
+    namespace {
+        // Stackless threads run to completion on the stack of the worker
+        // thread, suspending them would require to unwind that stack.
+        bool verify_suspendable(
+            threads::thread_id_type const& id, error_code& ec)
+        {
+            if (HPX_UNLIKELY(get_thread_id_data(id)->is_stackless()))
+            {
+                std::ostringstream strm;
+                strm << "thread(" << id << ", "
+                     << threads::get_thread_description(id)
+                     << ") was created without a stack "
+                        "(thread_stacksize::nostack) and can't be suspended";
+                HPX_THROWS_IF(ec, invalid_status,
+                    "hpx::this_thread::suspend", strm.str());
+                return false;
+            }
+            return true;
+        }
+    }    // namespace
 
     /// The function \a suspend will return control to the thread manager
     /// (suspends the current thread). It sets the new state of this thread
@@ -442,6 +462,9 @@ namespace hpx { namespace this_thread {
         if (ec)
             return threads::thread_restart_state::unknown;
 
+        if (!verify_suspendable(id, ec))
+            return threads::thread_restart_state::unknown;
+
         threads::thread_restart_state statex =
             threads::thread_restart_state::unknown;
 
@@ -512,6 +535,9 @@ namespace hpx { namespace this_thread {
         if (ec)
             return threads::thread_restart_state::unknown;
 
+        if (!verify_suspendable(id, ec))
+            return threads::thread_restart_state::unknown;
+
         // let the thread manager do other things while waiting
         threads::thread_restart_state statex =
             threads::thread_restart_state::unknown;
@@ -0,0 +1,98 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/threading_base/latency_histogram.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using hpx::threads::latency_histogram;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_bucket_boundaries()
+{
+    // small values have a bucket of their own
+    for (std::uint64_t v = 0; v != latency_histogram::sub_bucket_count; ++v)
+    {
+        HPX_TEST_EQ(latency_histogram::bucket_index(v), std::size_t(v));
+        HPX_TEST_EQ(latency_histogram::bucket_lower_bound(std::size_t(v)), v);
+    }
+
+    // each value falls into the bucket spanning it
+    std::uint64_t const max_value =
+        (std::uint64_t(2) << latency_histogram::max_exponent) - 1;
+    for (std::uint64_t v = 1; v < max_value; v = v * 3 + 1)
+    {
+        std::size_t const i = latency_histogram::bucket_index(v);
+        HPX_TEST_LT(i, latency_histogram::num_buckets);
+        HPX_TEST_LTE(latency_histogram::bucket_lower_bound(i), v);
+        if (i + 1 != latency_histogram::num_buckets)
+        {
+            HPX_TEST_LT(v, latency_histogram::bucket_lower_bound(i + 1));
+
+            // the relative error is bounded by the sub-bucket resolution
+            std::uint64_t const width =
+                latency_histogram::bucket_lower_bound(i + 1) -
+                latency_histogram::bucket_lower_bound(i);
+            HPX_TEST_LTE(width * latency_histogram::sub_bucket_count,
+                (std::max)(latency_histogram::bucket_lower_bound(i),
+                    std::uint64_t(latency_histogram::sub_bucket_count)));
+        }
+    }
+
+    // values beyond the covered range end up in the last bucket
+    HPX_TEST_EQ(latency_histogram::bucket_index(max_value),
+        latency_histogram::num_buckets - 1);
+    HPX_TEST_EQ(latency_histogram::bucket_index(~std::uint64_t(0)),
+        latency_histogram::num_buckets - 1);
+}
+
+void test_record_and_reset()
+{
+    latency_histogram h;
+    h.record(3);
+    h.record(3);
+    h.record(1000);
+    h.record(1000000);
+
+    std::vector<std::int64_t> counts(latency_histogram::num_buckets, 0);
+    h.add_to(counts, false);
+    HPX_TEST_EQ(counts[3], 2);
+    HPX_TEST_EQ(counts[latency_histogram::bucket_index(1000)], 1);
+    HPX_TEST_EQ(counts[latency_histogram::bucket_index(1000000)], 1);
+
+    std::vector<std::int64_t> values =
+        latency_histogram::get_counter_values(counts);
+    HPX_TEST_EQ(values[0], std::int64_t(latency_histogram::sub_bucket_bits));
+    HPX_TEST_EQ(values[1], 4);
+    HPX_TEST_EQ(values.size(),
+        latency_histogram::bucket_index(1000000) + std::size_t(3));
+
+    // reading with reset returns the same counts once
+    std::vector<std::int64_t> reset_counts(
+        latency_histogram::num_buckets, 0);
+    h.add_to(reset_counts, true);
+    HPX_TEST(reset_counts == counts);
+
+    std::vector<std::int64_t> empty_counts(
+        latency_histogram::num_buckets, 0);
+    h.add_to(empty_counts, false);
+    values = latency_histogram::get_counter_values(empty_counts);
+    HPX_TEST_EQ(values.size(), std::size_t(2));
+    HPX_TEST_EQ(values[1], 0);
+}
+
+int main()
+{
+    test_bucket_boundaries();
+    test_record_and_reset();
+
+    return hpx::util::report_errors();
+}
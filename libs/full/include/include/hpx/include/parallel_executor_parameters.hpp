@@ -8,6 +8,7 @@
 
 #include <hpx/execution/executors/execution_parameters.hpp>
 
+#include <hpx/execution/executors/adaptive_chunk_size.hpp>
 #include <hpx/execution/executors/auto_chunk_size.hpp>
 #include <hpx/execution/executors/dynamic_chunk_size.hpp>
 #include <hpx/execution/executors/guided_chunk_size.hpp>
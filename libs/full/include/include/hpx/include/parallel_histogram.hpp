@@ -0,0 +1,16 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/parallel/algorithms/bucket_by_key.hpp>
+#include <hpx/parallel/algorithms/histogram.hpp>
+
+#if defined(HPX_HAVE_DISTRIBUTED_RUNTIME)
+#include <hpx/parallel/segmented_algorithms/bucket_by_key.hpp>
+#include <hpx/parallel/segmented_algorithms/histogram.hpp>
+#endif
@@ -12,6 +12,7 @@
 #include <hpx/assert.hpp>
 #include <hpx/command_line_handling/command_line_handling.hpp>
 #include <hpx/coroutines/detail/context_impl.hpp>
+#include <hpx/coroutines/detail/stack_pool.hpp>
 #include <hpx/execution/detail/execution_parameter_callbacks.hpp>
 #include <hpx/execution_base/register_locks.hpp>
 #include <hpx/executors/exception_list.hpp>
@@ -366,6 +367,16 @@ namespace hpx {
     defined(__FreeBSD__)
             threads::coroutines::detail::posix::use_guard_pages =
                 cmdline.rtcfg_.use_stack_guard_pages();
+#if defined(HPX_HAVE_THREAD_STACK_POOL)
+            threads::coroutines::detail::posix::use_stack_pool =
+                cmdline.rtcfg_.use_stack_pool();
+            threads::coroutines::detail::posix::use_huge_pages =
+                cmdline.rtcfg_.use_huge_pages_for_stacks();
+            threads::coroutines::detail::posix::stack_pool_prefault =
+                cmdline.rtcfg_.prefault_pooled_stacks();
+            threads::coroutines::detail::posix::stack_pool_max_idle =
+                cmdline.rtcfg_.get_stack_pool_max_idle();
+#endif
 #endif
 #ifdef HPX_HAVE_VERIFY_LOCKS
             if (cmdline.rtcfg_.enable_lock_detection())
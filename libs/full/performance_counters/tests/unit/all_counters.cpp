@@ -83,6 +83,7 @@ char const* const locality_counter_names[] = {
     "/threads/count/stack-unbinds",
 #endif
 #endif
+    "/threads/allocator-cache/hits", "/threads/allocator-cache/misses",
     "/scheduler/utilization/instantaneous", nullptr};
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,134 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/thread_pool_base.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace resource {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Parameters controlling the decisions of the \a pool_rebalancer
+    struct pool_rebalancer_parameters
+    {
+        /// Time between two consecutive samples of the pool loads
+        std::chrono::milliseconds interval{100};
+
+        /// A pool is considered busy if the number of pending threads per
+        /// active processing unit is at least this large
+        double busy_queue_length = 4.0;
+
+        /// A pool is considered idle if the number of pending threads per
+        /// active processing unit is at most this large
+        double idle_queue_length = 0.5;
+
+#if defined(HPX_HAVE_THREAD_IDLE_RATES)
+        /// A pool is considered idle only if its idle rate (in 0.01%) is at
+        /// least this large
+        std::int64_t idle_rate = 5000;
+#endif
+
+        /// Number of consecutive samples a pool has to be busy (or idle)
+        /// before processing units are moved to (or from) it
+        std::size_t hysteresis = 3;
+
+        /// Minimal number of active processing units left to each pool
+        std::size_t min_active_pus = 1;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The pool_rebalancer periodically samples the load of the given thread
+    /// pools and moves processing units from idle pools to busy ones.
+    ///
+    /// Only processing units which have been added to more than one of the
+    /// given pools (i.e. using non-exclusive resources) can be moved. A
+    /// processing unit is moved by suspending it on the idle pool and
+    /// resuming it on the busy one, at any time each processing unit is
+    /// active on at most one of the pools. All pools have to support
+    /// suspending processing units (\a threads::policies::enable_elasticity).
+    ///
+    /// The rebalancer has to be stopped before the runtime is stopped.
+    class HPX_EXPORT pool_rebalancer
+    {
+    public:
+        pool_rebalancer(std::vector<threads::thread_pool_base*> const& pools,
+            pool_rebalancer_parameters const& params = {});
+        ~pool_rebalancer();
+
+        pool_rebalancer(pool_rebalancer const&) = delete;
+        pool_rebalancer& operator=(pool_rebalancer const&) = delete;
+
+        /// Start sampling the pools on a separate (OS) thread. Processing
+        /// units active on more than one pool are suspended on all but the
+        /// first pool they belong to.
+        void start(error_code& ec = throws);
+
+        /// Stop sampling the pools, this leaves the current distribution of
+        /// the processing units untouched.
+        void stop();
+
+        /// Sample the pools once and move (at most) one processing unit,
+        /// returns whether a processing unit has been moved. This must not
+        /// be called while the rebalancer is running on its own thread.
+        bool rebalance(error_code& ec = throws);
+
+        /// Return the number of processing units moved so far
+        std::size_t get_num_moves() const
+        {
+            return num_moves_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        // a processing unit which is shared between pools
+        struct shared_pu
+        {
+            std::size_t pu_num_;
+
+            // the virtual core of this processing unit in each of the pools,
+            // std::size_t(-1) if it doesn't belong to the pool
+            std::vector<std::size_t> virt_cores_;
+        };
+
+        struct pool_data
+        {
+            threads::thread_pool_base* pool_;
+            std::size_t busy_count_ = 0;
+            std::size_t idle_count_ = 0;
+        };
+
+        bool is_active(std::size_t pool, std::size_t virt_core) const;
+        std::size_t get_active_pus(std::size_t pool) const;
+
+        void move_pu(shared_pu const& pu, std::size_t from, std::size_t to,
+            error_code& ec);
+
+        void run();
+
+        pool_rebalancer_parameters params_;
+        std::vector<pool_data> pools_;
+        std::vector<shared_pu> shared_pus_;
+        std::atomic<std::size_t> num_moves_;
+
+        std::mutex mtx_;
+        std::condition_variable cond_;
+        bool stop_;
+        std::thread thread_;
+    };
+}}    // namespace hpx::resource
+
+#include <hpx/config/warnings_suffix.hpp>
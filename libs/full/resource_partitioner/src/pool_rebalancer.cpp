@@ -0,0 +1,320 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/resource_partitioner/detail/partitioner.hpp>
+#include <hpx/resource_partitioner/partitioner_fwd.hpp>
+#include <hpx/resource_partitioner/pool_rebalancer.hpp>
+#include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/scheduler_mode.hpp>
+#include <hpx/threading_base/scheduler_state.hpp>
+#include <hpx/threading_base/thread_pool_base.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace hpx { namespace resource {
+    ///////////////////////////////////////////////////////////////////////////
+    pool_rebalancer::pool_rebalancer(
+        std::vector<threads::thread_pool_base*> const& pools,
+        pool_rebalancer_parameters const& params)
+      : params_(params)
+      , num_moves_(0)
+      , stop_(false)
+    {
+        pools_.reserve(pools.size());
+        for (threads::thread_pool_base* pool : pools)
+        {
+            HPX_ASSERT(pool);
+            if (!pool->get_scheduler()->has_scheduler_mode(
+                    threads::policies::enable_elasticity))
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "pool_rebalancer::pool_rebalancer",
+                    "thread pool '" + pool->get_pool_name() +
+                        "' does not support suspending processing units");
+            }
+            pools_.push_back(pool_data{pool});
+        }
+
+        // find all processing units which belong to more than one pool
+        detail::partitioner& rp = get_partitioner();
+
+        std::map<std::size_t, shared_pu> pus;
+        for (std::size_t i = 0; i != pools_.size(); ++i)
+        {
+            threads::thread_pool_base* pool = pools_[i].pool_;
+            std::size_t const num_threads = pool->get_os_thread_count();
+            for (std::size_t virt_core = 0; virt_core != num_threads;
+                 ++virt_core)
+            {
+                std::size_t const pu_num =
+                    rp.get_pu_num(pool->get_thread_offset() + virt_core);
+
+                shared_pu& pu = pus[pu_num];
+                if (pu.virt_cores_.empty())
+                {
+                    pu.pu_num_ = pu_num;
+                    pu.virt_cores_.resize(pools_.size(), std::size_t(-1));
+                }
+                pu.virt_cores_[i] = virt_core;
+            }
+        }
+
+        for (auto const& pu : pus)
+        {
+            std::size_t num_pools = 0;
+            for (std::size_t virt_core : pu.second.virt_cores_)
+            {
+                if (virt_core != std::size_t(-1))
+                    ++num_pools;
+            }
+
+            if (num_pools > 1)
+                shared_pus_.push_back(pu.second);
+        }
+    }
+
+    pool_rebalancer::~pool_rebalancer()
+    {
+        stop();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void pool_rebalancer::start(error_code& ec)
+    {
+        if (thread_.joinable())
+        {
+            HPX_THROWS_IF(ec, invalid_status, "pool_rebalancer::start",
+                "the rebalancer has already been started");
+            return;
+        }
+
+        // make sure each shared processing unit is active on one pool only
+        for (shared_pu const& pu : shared_pus_)
+        {
+            bool found_active = false;
+            for (std::size_t i = 0; i != pools_.size(); ++i)
+            {
+                std::size_t const virt_core = pu.virt_cores_[i];
+                if (virt_core == std::size_t(-1) || !is_active(i, virt_core))
+                    continue;
+
+                if (found_active)
+                {
+                    pools_[i].pool_->suspend_processing_unit_direct(
+                        virt_core, ec);
+                    if (ec)
+                        return;
+                }
+                found_active = true;
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> l(mtx_);
+            stop_ = false;
+        }
+        thread_ = std::thread(&pool_rebalancer::run, this);
+
+        if (&ec != &throws)
+            ec = make_success_code();
+    }
+
+    void pool_rebalancer::stop()
+    {
+        if (!thread_.joinable())
+            return;
+
+        {
+            std::lock_guard<std::mutex> l(mtx_);
+            stop_ = true;
+        }
+        cond_.notify_all();
+
+        thread_.join();
+    }
+
+    void pool_rebalancer::run()
+    {
+        std::unique_lock<std::mutex> l(mtx_);
+        while (!cond_.wait_for(l, params_.interval, [this] { return stop_; }))
+        {
+            l.unlock();
+
+            // errors (e.g. if the runtime is being stopped) are ignored, the
+            // next sample will be taken as usual
+            error_code ec(lightweight);
+            rebalance(ec);
+
+            l.lock();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool pool_rebalancer::is_active(
+        std::size_t pool, std::size_t virt_core) const
+    {
+        return pools_[pool].pool_->get_state(virt_core) == state_running;
+    }
+
+    std::size_t pool_rebalancer::get_active_pus(std::size_t pool) const
+    {
+        std::size_t active = 0;
+        std::size_t const num_threads =
+            pools_[pool].pool_->get_os_thread_count();
+        for (std::size_t virt_core = 0; virt_core != num_threads; ++virt_core)
+        {
+            if (is_active(pool, virt_core))
+                ++active;
+        }
+        return active;
+    }
+
+    void pool_rebalancer::move_pu(shared_pu const& pu, std::size_t from,
+        std::size_t to, error_code& ec)
+    {
+        // suspend first to never have the processing unit being used by both
+        // pools
+        pools_[from].pool_->suspend_processing_unit_direct(
+            pu.virt_cores_[from], ec);
+        if (ec)
+            return;
+
+        error_code ec_resume;
+        pools_[to].pool_->resume_processing_unit_direct(
+            pu.virt_cores_[to], ec_resume);
+        if (ec_resume)
+        {
+            // don't lose the processing unit, give it back to the pool it
+            // was taken from
+            error_code ec_rollback(lightweight);
+            pools_[from].pool_->resume_processing_unit_direct(
+                pu.virt_cores_[from], ec_rollback);
+
+            HPX_THROWS_IF(ec, static_cast<hpx::error>(ec_resume.value()),
+                "pool_rebalancer::move_pu", ec_resume.get_message());
+            return;
+        }
+
+        if (&ec != &throws)
+            ec = make_success_code();
+    }
+
+    bool pool_rebalancer::rebalance(error_code& ec)
+    {
+        std::size_t const num_pools = pools_.size();
+
+        // sample the load of all pools and update how long they have been
+        // busy or idle
+        std::vector<double> loads(num_pools);
+        std::vector<std::size_t> active_pus(num_pools);
+        for (std::size_t i = 0; i != num_pools; ++i)
+        {
+            pool_data& data = pools_[i];
+
+            active_pus[i] = get_active_pus(i);
+            double const queue_length = static_cast<double>(
+                data.pool_->get_queue_length(std::size_t(-1), false));
+
+            if (active_pus[i] != 0)
+            {
+                loads[i] = queue_length / static_cast<double>(active_pus[i]);
+            }
+            else
+            {
+                loads[i] = queue_length != 0 ?
+                    (std::numeric_limits<double>::max)() :
+                    0.0;
+            }
+
+            bool const busy = loads[i] >= params_.busy_queue_length;
+            bool idle = loads[i] <= params_.idle_queue_length;
+#if defined(HPX_HAVE_THREAD_IDLE_RATES)
+            idle = data.pool_->avg_idle_rate_all(true) >= params_.idle_rate &&
+                idle;
+#endif
+
+            data.busy_count_ = busy ? data.busy_count_ + 1 : 0;
+            data.idle_count_ = idle ? data.idle_count_ + 1 : 0;
+        }
+
+        // select the busiest pool which has been busy for long enough
+        std::size_t to = std::size_t(-1);
+        for (std::size_t i = 0; i != num_pools; ++i)
+        {
+            if (pools_[i].busy_count_ >= params_.hysteresis &&
+                (to == std::size_t(-1) || loads[i] > loads[to]))
+            {
+                to = i;
+            }
+        }
+
+        if (to == std::size_t(-1))
+        {
+            if (&ec != &throws)
+                ec = make_success_code();
+            return false;
+        }
+
+        // select the least loaded idle pool which can give away a processing
+        // unit to the busy pool
+        shared_pu const* selected_pu = nullptr;
+        std::size_t from = std::size_t(-1);
+        for (shared_pu const& pu : shared_pus_)
+        {
+            std::size_t const virt_core_to = pu.virt_cores_[to];
+            if (virt_core_to == std::size_t(-1) || is_active(to, virt_core_to))
+                continue;
+
+            for (std::size_t i = 0; i != num_pools; ++i)
+            {
+                std::size_t const virt_core = pu.virt_cores_[i];
+                if (i == to || virt_core == std::size_t(-1) ||
+                    pools_[i].idle_count_ < params_.hysteresis ||
+                    active_pus[i] <= params_.min_active_pus ||
+                    !is_active(i, virt_core))
+                {
+                    continue;
+                }
+
+                if (from == std::size_t(-1) || loads[i] < loads[from])
+                {
+                    from = i;
+                    selected_pu = &pu;
+                }
+            }
+        }
+
+        if (selected_pu == nullptr)
+        {
+            if (&ec != &throws)
+                ec = make_success_code();
+            return false;
+        }
+
+        move_pu(*selected_pu, from, to, ec);
+        if (ec)
+            return false;
+
+        // start over measuring the loads of both pools
+        pools_[from].idle_count_ = 0;
+        pools_[to].busy_count_ = 0;
+
+        ++num_moves_;
+
+        if (&ec != &throws)
+            ec = make_success_code();
+        return true;
+    }
+}}    // namespace hpx::resource
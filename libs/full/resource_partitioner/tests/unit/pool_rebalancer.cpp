@@ -0,0 +1,166 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the pool_rebalancer moves shared processing units from an idle
+// pool to a busy one
+
+#include <hpx/hpx_init.hpp>
+
+#include <hpx/async_combinators/when_all.hpp>
+#include <hpx/include/parallel_executors.hpp>
+#include <hpx/include/resource_partitioner.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/modules/async_local.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/resource_partitioner/pool_rebalancer.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+const std::size_t max_threads = 4;
+std::size_t num_threads = max_threads;
+
+std::atomic<std::size_t> count(0);
+
+void busy_task()
+{
+    auto const start = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - start <
+        std::chrono::microseconds(200))
+    {
+    }
+    ++count;
+}
+
+int hpx_main()
+{
+    // the io pool is created only if there are processing units to share
+    if (!hpx::resource::pool_exists("io"))
+    {
+        std::cout << "pool_rebalancer test skipped, at least two threads are "
+                     "required"
+                  << std::endl;
+        return hpx::finalize();
+    }
+
+    hpx::threads::thread_pool_base& default_pool =
+        hpx::resource::get_thread_pool("default");
+    hpx::threads::thread_pool_base& io_pool =
+        hpx::resource::get_thread_pool("io");
+
+    {
+        hpx::resource::pool_rebalancer_parameters params;
+        params.interval = std::chrono::milliseconds(10);
+        params.hysteresis = 1;
+
+        hpx::resource::pool_rebalancer rebalancer(
+            {&default_pool, &io_pool}, params);
+
+        // all shared processing units are initially given to the default
+        // pool, the io pool has no active processing units left
+        rebalancer.start();
+
+        std::size_t active = 0;
+        for (std::size_t i = 0; i != io_pool.get_os_thread_count(); ++i)
+        {
+            if (io_pool.get_state(i) == hpx::state_running)
+                ++active;
+        }
+        HPX_TEST_EQ(active, std::size_t(0));
+
+        // the work scheduled on the io pool can make progress only after
+        // the rebalancer has moved processing units to it
+        hpx::execution::parallel_executor exec(&io_pool);
+
+        std::size_t const num_tasks = 1000;
+        std::vector<hpx::future<void>> futures;
+        futures.reserve(num_tasks);
+        for (std::size_t i = 0; i != num_tasks; ++i)
+        {
+            futures.push_back(hpx::async(exec, &busy_task));
+        }
+
+        hpx::wait_all(futures);
+        rebalancer.stop();
+
+        HPX_TEST_EQ(count.load(), num_tasks);
+        HPX_TEST_LT(std::size_t(0), rebalancer.get_num_moves());
+    }
+
+    // make sure all processing units are active before shutting down
+    for (std::size_t i = 0; i != io_pool.get_os_thread_count(); ++i)
+    {
+        io_pool.resume_processing_unit_direct(i, hpx::throws);
+    }
+
+    return hpx::finalize();
+}
+
+void init_resource_partitioner_handler(hpx::resource::partitioner& rp)
+{
+    num_threads = (std::min)(rp.get_number_requested_threads(), max_threads);
+    if (num_threads < 2)
+        return;
+
+    rp.create_thread_pool(
+        "io", hpx::resource::scheduling_policy::local_priority_fifo);
+
+    // the first processing unit belongs to the default pool only, all
+    // others are shared between both pools
+    std::size_t thread_count = 0;
+    for (const hpx::resource::numa_domain& d : rp.numa_domains())
+    {
+        for (const hpx::resource::core& c : d.cores())
+        {
+            for (const hpx::resource::pu& p : c.pus())
+            {
+                if (thread_count == 0)
+                {
+                    rp.add_resource(p, "default");
+                }
+                else if (thread_count < num_threads)
+                {
+                    rp.add_resource(p, "default", false);
+                    rp.add_resource(p, "io", false);
+                }
+                ++thread_count;
+            }
+        }
+    }
+}
+
+// this test uses up to 4 threads, it is skipped if less than 2 are available
+int main(int argc, char* argv[])
+{
+    if (hpx::threads::hardware_concurrency() < 2)
+    {
+        std::cout << "pool_rebalancer test skipped, at least two processing "
+                     "units are required"
+                  << std::endl;
+        return hpx::util::report_errors();
+    }
+
+    num_threads =
+        (std::min)(std::size_t(hpx::threads::hardware_concurrency()),
+            max_threads);
+
+    hpx::init_params init_args;
+    init_args.cfg = {"hpx.os_threads=" + std::to_string(num_threads)};
+    init_args.rp_callback = &init_resource_partitioner_handler;
+    init_args.rp_mode = static_cast<hpx::resource::partitioner_mode>(
+        hpx::resource::mode_allow_oversubscription |
+        hpx::resource::mode_allow_dynamic_pools);
+
+    HPX_TEST_EQ(hpx::init(argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
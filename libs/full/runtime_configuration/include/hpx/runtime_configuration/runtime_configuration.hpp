@@ -82,6 +82,9 @@ namespace hpx { namespace util {
         std::size_t get_agas_local_cache_size(
             std::size_t dflt = HPX_AGAS_LOCAL_CACHE_SIZE) const;
 
+        // Get number of shards the AGAS client-side local cache is split into
+        std::size_t get_agas_local_cache_shards() const;
+
         bool get_agas_caching_mode() const;
 
         bool get_agas_range_caching_mode() const;
@@ -110,6 +113,14 @@ namespace hpx { namespace util {
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
         bool use_stack_guard_pages() const;
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP)
+        // Get the settings of the process-wide coroutine stack pool
+        bool use_stack_pool() const;
+        bool use_huge_pages_for_stacks() const;
+        bool prefault_pooled_stacks() const;
+        std::size_t get_stack_pool_max_idle() const;
+#endif
 #endif
 
         // return trace_depth for stack-backtraces
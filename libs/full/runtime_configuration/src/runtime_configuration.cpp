@@ -186,6 +186,7 @@ namespace hpx { namespace util {
             "${HPX_MAX_IDLE_BACKOFF_TIME:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_IDLE_BACKOFF_TIME_MAX)) "}",
 #endif
+            "idle_parking = ${HPX_IDLE_PARKING:0}",
             "default_scheduler_mode = ${HPX_DEFAULT_SCHEDULER_MODE}",
 
         /// If HPX_HAVE_ATTACH_DEBUGGER_ON_TEST_FAILURE is set,
@@ -226,6 +227,12 @@ namespace hpx { namespace util {
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
             "use_guard_pages = ${HPX_USE_GUARD_PAGES:1}",
+#if defined(HPX_HAVE_THREAD_STACK_MMAP)
+            "use_pool = ${HPX_USE_STACK_POOL:0}",
+            "use_huge_pages = ${HPX_USE_HUGE_PAGES_FOR_STACKS:0}",
+            "pool_prefault = ${HPX_STACK_POOL_PREFAULT:0}",
+            "pool_max_idle = ${HPX_STACK_POOL_MAX_IDLE:1024}",
+#endif
 #endif
 
             "[hpx.threadpools]",
@@ -316,6 +323,7 @@ namespace hpx { namespace util {
             "service_mode = hosted",
             "local_cache_size = ${HPX_AGAS_LOCAL_CACHE_SIZE:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_AGAS_LOCAL_CACHE_SIZE)) "}",
+            "local_cache_shards = ${HPX_AGAS_LOCAL_CACHE_SHARDS:0}",
             "use_range_caching = ${HPX_AGAS_USE_RANGE_CACHING:1}",
             "use_caching = ${HPX_AGAS_USE_CACHING:1}",
 
@@ -925,6 +933,26 @@ namespace hpx { namespace util {
         return cache_size;
     }
 
+    std::size_t runtime_configuration::get_agas_local_cache_shards() const
+    {
+        std::size_t num_shards = 0;
+
+        if (has_section("hpx.agas"))
+        {
+            util::section const* sec = get_section("hpx.agas");
+            if (nullptr != sec)
+            {
+                num_shards = hpx::util::get_entry_as<std::size_t>(
+                    *sec, "local_cache_shards", num_shards);
+            }
+        }
+
+        // default to one shard per worker thread
+        if (num_shards == 0)
+            num_shards = get_os_thread_count();
+        return num_shards;
+    }
+
     bool runtime_configuration::get_agas_caching_mode() const
     {
         if (has_section("hpx.agas"))
@@ -1208,6 +1236,63 @@ namespace hpx { namespace util {
         }
         return true;    // default is true
     }
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP)
+    bool runtime_configuration::use_stack_pool() const
+    {
+        if (has_section("hpx"))
+        {
+            util::section const* sec = get_section("hpx.stacks");
+            if (nullptr != sec)
+            {
+                return hpx::util::get_entry_as<int>(*sec, "use_pool", 0) != 0;
+            }
+        }
+        return false;    // default is false
+    }
+
+    bool runtime_configuration::use_huge_pages_for_stacks() const
+    {
+        if (has_section("hpx"))
+        {
+            util::section const* sec = get_section("hpx.stacks");
+            if (nullptr != sec)
+            {
+                return hpx::util::get_entry_as<int>(
+                           *sec, "use_huge_pages", 0) != 0;
+            }
+        }
+        return false;    // default is false
+    }
+
+    bool runtime_configuration::prefault_pooled_stacks() const
+    {
+        if (has_section("hpx"))
+        {
+            util::section const* sec = get_section("hpx.stacks");
+            if (nullptr != sec)
+            {
+                return hpx::util::get_entry_as<int>(
+                           *sec, "pool_prefault", 0) != 0;
+            }
+        }
+        return false;    // default is false
+    }
+
+    std::size_t runtime_configuration::get_stack_pool_max_idle() const
+    {
+        if (has_section("hpx"))
+        {
+            util::section const* sec = get_section("hpx.stacks");
+            if (nullptr != sec)
+            {
+                return hpx::util::get_entry_as<std::size_t>(
+                    *sec, "pool_max_idle", 1024);
+            }
+        }
+        return 1024;
+    }
+#endif
 #endif
 
     std::ptrdiff_t runtime_configuration::init_small_stack_size() const
@@ -190,6 +190,13 @@ namespace hpx { namespace util {
             return bt.trace();
         }
 
+        // stackless threads can't wait for the new thread, they run on the
+        // stack of the worker thread anyways
+        if (threads::get_self_id_data()->is_stackless())
+        {
+            return bt.trace();
+        }
+
         lcos::local::futures_factory<std::string()> p(
             [&bt]() { return bt.trace(); });
 
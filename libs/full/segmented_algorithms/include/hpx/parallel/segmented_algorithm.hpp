@@ -12,12 +12,14 @@
 #include <hpx/parallel/segmented_algorithms/adjacent_difference.hpp>
 #include <hpx/parallel/segmented_algorithms/adjacent_find.hpp>
 #include <hpx/parallel/segmented_algorithms/all_any_none.hpp>
+#include <hpx/parallel/segmented_algorithms/bucket_by_key.hpp>
 #include <hpx/parallel/segmented_algorithms/count.hpp>
 #include <hpx/parallel/segmented_algorithms/exclusive_scan.hpp>
 #include <hpx/parallel/segmented_algorithms/fill.hpp>
 #include <hpx/parallel/segmented_algorithms/find.hpp>
 #include <hpx/parallel/segmented_algorithms/for_each.hpp>
 #include <hpx/parallel/segmented_algorithms/generate.hpp>
+#include <hpx/parallel/segmented_algorithms/histogram.hpp>
 #include <hpx/parallel/segmented_algorithms/inclusive_scan.hpp>
 #include <hpx/parallel/segmented_algorithms/minmax.hpp>
 #include <hpx/parallel/segmented_algorithms/reduce.hpp>
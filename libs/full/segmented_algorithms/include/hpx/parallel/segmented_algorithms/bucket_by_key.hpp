@@ -0,0 +1,277 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/bucket_by_key.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_bucket_by_key
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // Write the offsets of the buckets of a segment relative to the
+        // beginning of the overall destination range, return the offset of
+        // the end of the segment
+        template <typename OutIter>
+        std::size_t segmented_bucket_by_key_offsets(
+            std::vector<std::size_t> const& segment_offsets, std::size_t base,
+            OutIter& offsets)
+        {
+            for (std::size_t offset : segment_offsets)
+            {
+                *offsets++ = base + offset;
+            }
+            return base + segment_offsets.back();
+        }
+
+        // The elements of each segment are grouped separately and copied
+        // into the corresponding segment of the destination range.
+
+        // sequential remote implementation
+        template <typename Algo, typename ExPolicy, typename SegIter,
+            typename DestIter, typename Key, typename OutIter>
+        static typename util::detail::algorithm_result<ExPolicy,
+            DestIter>::type
+        segmented_bucket_by_key(Algo&& algo, ExPolicy const& policy,
+            SegIter first, SegIter last, DestIter dest,
+            std::size_t num_buckets, Key&& key, OutIter offsets,
+            std::true_type)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits1;
+            typedef hpx::traits::segmented_iterator_traits<DestIter> traits2;
+            typedef typename traits1::segment_iterator segment_iterator1;
+            typedef typename traits1::local_iterator local_iterator_type1;
+            typedef typename traits2::segment_iterator segment_iterator2;
+            typedef typename traits2::local_iterator local_iterator_type2;
+
+            typedef util::detail::algorithm_result<ExPolicy, DestIter> result;
+
+            segment_iterator1 sit = traits1::segment(first);
+            segment_iterator1 send = traits1::segment(last);
+            segment_iterator2 sdest = traits2::segment(dest);
+
+            std::size_t base = 0;
+
+            if (sit == send)
+            {
+                // all elements are on the same partition
+                local_iterator_type1 beg = traits1::local(first);
+                local_iterator_type1 end = traits1::local(last);
+                local_iterator_type2 ldest = traits2::local(dest);
+                if (beg != end)
+                {
+                    base = segmented_bucket_by_key_offsets(
+                        dispatch(traits2::get_id(sdest), algo, policy,
+                            std::true_type(), beg, end, ldest, num_buckets,
+                            key),
+                        base, offsets);
+                }
+            }
+            else
+            {
+                // handle the remaining part of the first partition
+                local_iterator_type1 beg = traits1::local(first);
+                local_iterator_type1 end = traits1::end(sit);
+                local_iterator_type2 ldest = traits2::local(dest);
+                if (beg != end)
+                {
+                    base = segmented_bucket_by_key_offsets(
+                        dispatch(traits2::get_id(sdest), algo, policy,
+                            std::true_type(), beg, end, ldest, num_buckets,
+                            key),
+                        base, offsets);
+                }
+
+                // handle all of the full partitions
+                for (++sit, ++sdest; sit != send; ++sit, ++sdest)
+                {
+                    beg = traits1::begin(sit);
+                    end = traits1::end(sit);
+                    ldest = traits2::begin(sdest);
+                    if (beg != end)
+                    {
+                        base = segmented_bucket_by_key_offsets(
+                            dispatch(traits2::get_id(sdest), algo, policy,
+                                std::true_type(), beg, end, ldest, num_buckets,
+                                key),
+                            base, offsets);
+                    }
+                }
+
+                // handle the beginning of the last partition
+                beg = traits1::begin(sit);
+                end = traits1::local(last);
+                ldest = traits2::begin(sdest);
+                if (beg != end)
+                {
+                    base = segmented_bucket_by_key_offsets(
+                        dispatch(traits2::get_id(sdest), algo, policy,
+                            std::true_type(), beg, end, ldest, num_buckets,
+                            key),
+                        base, offsets);
+                }
+            }
+
+            return result::get(std::next(dest, base));
+        }
+
+        // parallel remote implementation
+        template <typename Algo, typename ExPolicy, typename SegIter,
+            typename DestIter, typename Key, typename OutIter>
+        static typename util::detail::algorithm_result<ExPolicy,
+            DestIter>::type
+        segmented_bucket_by_key(Algo&& algo, ExPolicy const& policy,
+            SegIter first, SegIter last, DestIter dest,
+            std::size_t num_buckets, Key&& key, OutIter offsets,
+            std::false_type)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits1;
+            typedef hpx::traits::segmented_iterator_traits<DestIter> traits2;
+            typedef typename traits1::segment_iterator segment_iterator1;
+            typedef typename traits1::local_iterator local_iterator_type1;
+            typedef typename traits2::segment_iterator segment_iterator2;
+            typedef typename traits2::local_iterator local_iterator_type2;
+
+            typedef util::detail::algorithm_result<ExPolicy, DestIter> result;
+
+            typedef std::integral_constant<bool,
+                !hpx::traits::is_forward_iterator<SegIter>::value>
+                forced_seq;
+
+            segment_iterator1 sit = traits1::segment(first);
+            segment_iterator1 send = traits1::segment(last);
+            segment_iterator2 sdest = traits2::segment(dest);
+
+            typedef std::vector<future<std::vector<std::size_t>>> segment_type;
+            segment_type segments;
+            segments.reserve(detail::distance(sit, send));
+
+            if (sit == send)
+            {
+                // all elements are on the same partition
+                local_iterator_type1 beg = traits1::local(first);
+                local_iterator_type1 end = traits1::local(last);
+                local_iterator_type2 ldest = traits2::local(dest);
+                if (beg != end)
+                {
+                    segments.push_back(dispatch_async(traits2::get_id(sdest),
+                        algo, policy, forced_seq(), beg, end, ldest,
+                        num_buckets, key));
+                }
+            }
+            else
+            {
+                // handle the remaining part of the first partition
+                local_iterator_type1 beg = traits1::local(first);
+                local_iterator_type1 end = traits1::end(sit);
+                local_iterator_type2 ldest = traits2::local(dest);
+                if (beg != end)
+                {
+                    segments.push_back(dispatch_async(traits2::get_id(sdest),
+                        algo, policy, forced_seq(), beg, end, ldest,
+                        num_buckets, key));
+                }
+
+                // handle all of the full partitions
+                for (++sit, ++sdest; sit != send; ++sit, ++sdest)
+                {
+                    beg = traits1::begin(sit);
+                    end = traits1::end(sit);
+                    ldest = traits2::begin(sdest);
+                    if (beg != end)
+                    {
+                        segments.push_back(
+                            dispatch_async(traits2::get_id(sdest), algo,
+                                policy, forced_seq(), beg, end, ldest,
+                                num_buckets, key));
+                    }
+                }
+
+                // handle the beginning of the last partition
+                beg = traits1::begin(sit);
+                end = traits1::local(last);
+                ldest = traits2::begin(sdest);
+                if (beg != end)
+                {
+                    segments.push_back(dispatch_async(traits2::get_id(sdest),
+                        algo, policy, forced_seq(), beg, end, ldest,
+                        num_buckets, key));
+                }
+            }
+
+            return result::get(dataflow(
+                [=](segment_type&& r) mutable -> DestIter {
+                    // handle any remote exceptions, will throw on error
+                    std::list<std::exception_ptr> errors;
+                    parallel::util::detail::handle_remote_exceptions<
+                        ExPolicy>::call(r, errors);
+
+                    std::size_t base = 0;
+                    for (auto& f : r)
+                    {
+                        base = segmented_bucket_by_key_offsets(
+                            f.get(), base, offsets);
+                    }
+                    return std::next(dest, base);
+                },
+                std::move(segments)));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename SegIter, typename DestIter,
+            typename Key, typename OutIter>
+        typename util::detail::algorithm_result<ExPolicy, DestIter>::type
+        bucket_by_key_(ExPolicy&& policy, SegIter first, SegIter last,
+            DestIter dest, std::size_t num_buckets, Key&& key, OutIter offsets,
+            std::true_type)
+        {
+            using is_seq = hpx::is_sequenced_execution_policy<ExPolicy>;
+
+            if (first == last)
+            {
+                std::fill_n(offsets, num_buckets + 1, std::size_t(0));
+                return util::detail::algorithm_result<ExPolicy,
+                    DestIter>::get(std::move(dest));
+            }
+
+            return segmented_bucket_by_key(bucket_by_key(),
+                std::forward<ExPolicy>(policy), first, last, dest, num_buckets,
+                std::forward<Key>(key), offsets, is_seq());
+        }
+
+        // forward declare the non-segmented version of this algorithm
+        template <typename ExPolicy, typename FwdIter, typename RandIter,
+            typename Key, typename OutIter>
+        typename util::detail::algorithm_result<ExPolicy, RandIter>::type
+        bucket_by_key_(ExPolicy&& policy, FwdIter first, FwdIter last,
+            RandIter dest, std::size_t num_buckets, Key&& key, OutIter offsets,
+            std::false_type);
+
+        /// \endcond
+    }    // namespace detail
+}}}      // namespace hpx::parallel::v1
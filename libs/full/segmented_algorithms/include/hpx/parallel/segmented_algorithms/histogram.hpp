@@ -0,0 +1,232 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/histogram.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_histogram
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // add the counts of a segment to the overall counts
+        inline void segmented_histogram_add(std::vector<std::size_t>& counts,
+            std::vector<std::size_t> const& segment_counts)
+        {
+            HPX_ASSERT(counts.size() == segment_counts.size());
+            for (std::size_t b = 0; b != counts.size(); ++b)
+            {
+                counts[b] += segment_counts[b];
+            }
+        }
+
+        // sequential remote implementation
+        template <typename Algo, typename ExPolicy, typename SegIter,
+            typename Bins, typename OutIter>
+        static typename util::detail::algorithm_result<ExPolicy, OutIter>::type
+        segmented_histogram(Algo&& algo, ExPolicy const& policy, SegIter first,
+            SegIter last, Bins const& bins, OutIter dest, std::true_type)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::segment_iterator segment_iterator;
+            typedef typename traits::local_iterator local_iterator_type;
+            typedef util::detail::algorithm_result<ExPolicy, OutIter> result;
+
+            segment_iterator sit = traits::segment(first);
+            segment_iterator send = traits::segment(last);
+
+            std::vector<std::size_t> counts(bins.size(), 0);
+
+            if (sit == send)
+            {
+                // all elements are on the same partition
+                local_iterator_type beg = traits::local(first);
+                local_iterator_type end = traits::local(last);
+                if (beg != end)
+                {
+                    segmented_histogram_add(counts,
+                        dispatch(traits::get_id(sit), algo, policy,
+                            std::true_type(), beg, end, bins));
+                }
+            }
+            else
+            {
+                // handle the remaining part of the first partition
+                local_iterator_type beg = traits::local(first);
+                local_iterator_type end = traits::end(sit);
+                if (beg != end)
+                {
+                    segmented_histogram_add(counts,
+                        dispatch(traits::get_id(sit), algo, policy,
+                            std::true_type(), beg, end, bins));
+                }
+
+                // handle all of the full partitions
+                for (++sit; sit != send; ++sit)
+                {
+                    beg = traits::begin(sit);
+                    end = traits::end(sit);
+                    if (beg != end)
+                    {
+                        segmented_histogram_add(counts,
+                            dispatch(traits::get_id(sit), algo, policy,
+                                std::true_type(), beg, end, bins));
+                    }
+                }
+
+                // handle the beginning of the last partition
+                beg = traits::begin(sit);
+                end = traits::local(last);
+                if (beg != end)
+                {
+                    segmented_histogram_add(counts,
+                        dispatch(traits::get_id(sit), algo, policy,
+                            std::true_type(), beg, end, bins));
+                }
+            }
+
+            return result::get(std::copy(counts.begin(), counts.end(), dest));
+        }
+
+        // parallel remote implementation
+        template <typename Algo, typename ExPolicy, typename SegIter,
+            typename Bins, typename OutIter>
+        static typename util::detail::algorithm_result<ExPolicy, OutIter>::type
+        segmented_histogram(Algo&& algo, ExPolicy const& policy, SegIter first,
+            SegIter last, Bins const& bins, OutIter dest, std::false_type)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::segment_iterator segment_iterator;
+            typedef typename traits::local_iterator local_iterator_type;
+            typedef util::detail::algorithm_result<ExPolicy, OutIter> result;
+
+            typedef std::integral_constant<bool,
+                !hpx::traits::is_forward_iterator<SegIter>::value>
+                forced_seq;
+
+            segment_iterator sit = traits::segment(first);
+            segment_iterator send = traits::segment(last);
+
+            typedef std::vector<future<std::vector<std::size_t>>> segment_type;
+            segment_type segments;
+            segments.reserve(detail::distance(sit, send));
+
+            if (sit == send)
+            {
+                // all elements are on the same partition
+                local_iterator_type beg = traits::local(first);
+                local_iterator_type end = traits::local(last);
+                if (beg != end)
+                {
+                    segments.push_back(dispatch_async(traits::get_id(sit), algo,
+                        policy, forced_seq(), beg, end, bins));
+                }
+            }
+            else
+            {
+                // handle the remaining part of the first partition
+                local_iterator_type beg = traits::local(first);
+                local_iterator_type end = traits::end(sit);
+                if (beg != end)
+                {
+                    segments.push_back(dispatch_async(traits::get_id(sit), algo,
+                        policy, forced_seq(), beg, end, bins));
+                }
+
+                // handle all of the full partitions
+                for (++sit; sit != send; ++sit)
+                {
+                    beg = traits::begin(sit);
+                    end = traits::end(sit);
+                    if (beg != end)
+                    {
+                        segments.push_back(dispatch_async(traits::get_id(sit),
+                            algo, policy, forced_seq(), beg, end, bins));
+                    }
+                }
+
+                // handle the beginning of the last partition
+                beg = traits::begin(sit);
+                end = traits::local(last);
+                if (beg != end)
+                {
+                    segments.push_back(dispatch_async(traits::get_id(sit), algo,
+                        policy, forced_seq(), beg, end, bins));
+                }
+            }
+
+            std::size_t const num_bins = bins.size();
+            return result::get(dataflow(
+                [=](segment_type&& r) -> OutIter {
+                    // handle any remote exceptions, will throw on error
+                    std::list<std::exception_ptr> errors;
+                    parallel::util::detail::handle_remote_exceptions<
+                        ExPolicy>::call(r, errors);
+
+                    std::vector<std::size_t> counts(num_bins, 0);
+                    for (auto& f : r)
+                    {
+                        segmented_histogram_add(counts, f.get());
+                    }
+                    return std::copy(counts.begin(), counts.end(), dest);
+                },
+                std::move(segments)));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename SegIter, typename Bins,
+            typename OutIter>
+        typename util::detail::algorithm_result<ExPolicy, OutIter>::type
+        histogram_(ExPolicy&& policy, SegIter first, SegIter last,
+            Bins const& bins, OutIter dest, std::true_type)
+        {
+            using is_seq = hpx::is_sequenced_execution_policy<ExPolicy>;
+
+            if (first == last)
+            {
+                return util::detail::algorithm_result<ExPolicy, OutIter>::get(
+                    std::fill_n(dest, bins.size(), std::size_t(0)));
+            }
+
+            return segmented_histogram(histogram(),
+                std::forward<ExPolicy>(policy), first, last, bins, dest,
+                is_seq());
+        }
+
+        // forward declare the non-segmented version of this algorithm
+        template <typename ExPolicy, typename FwdIter, typename Bins,
+            typename OutIter>
+        typename util::detail::algorithm_result<ExPolicy, OutIter>::type
+        histogram_(ExPolicy&& policy, FwdIter first, FwdIter last,
+            Bins const& bins, OutIter dest, std::false_type);
+
+        /// \endcond
+    }    // namespace detail
+}}}      // namespace hpx::parallel::v1
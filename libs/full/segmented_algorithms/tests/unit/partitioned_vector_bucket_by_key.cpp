@@ -0,0 +1,147 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_histogram.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double);
+// HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+std::size_t const num_buckets = 5;
+
+struct get_bucket
+{
+    template <typename T>
+    std::size_t operator()(T const& v) const
+    {
+        return std::size_t(v) % num_buckets;
+    }
+
+    template <typename Archive>
+    void serialize(Archive&, unsigned)
+    {
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void fill_vector(hpx::partitioned_vector<T>& v)
+{
+    std::size_t i = 0;
+    typename hpx::partitioned_vector<T>::iterator it = v.begin(), end = v.end();
+    for (/**/; it != end; ++it, ++i)
+        *it = T((i * 7) % 13);
+}
+
+template <typename T>
+std::vector<T> to_vector(hpx::partitioned_vector<T> const& v)
+{
+    std::vector<T> result;
+    typename hpx::partitioned_vector<T>::const_iterator it = v.begin(),
+                                                        end = v.end();
+    for (/**/; it != end; ++it)
+        result.push_back(*it);
+    return result;
+}
+
+// every segment has been grouped into the corresponding part of the
+// destination, the offsets of the buckets are relative to its beginning
+template <typename T>
+void verify_buckets(hpx::partitioned_vector<T> const& src,
+    hpx::partitioned_vector<T> const& dest,
+    std::vector<std::size_t> const& offsets)
+{
+    std::vector<T> s = to_vector(src);
+    std::vector<T> d = to_vector(dest);
+
+    HPX_TEST_EQ(offsets.size() % (num_buckets + 1), std::size_t(0));
+    HPX_TEST(!offsets.empty());
+    HPX_TEST_EQ(offsets.front(), std::size_t(0));
+    HPX_TEST_EQ(offsets.back(), s.size());
+
+    std::vector<std::size_t> src_counts(num_buckets, 0);
+    for (T const& v : s)
+        ++src_counts[get_bucket()(v)];
+
+    std::vector<std::size_t> dest_counts(num_buckets, 0);
+    for (std::size_t k = 0; k != offsets.size(); k += num_buckets + 1)
+    {
+        for (std::size_t b = 0; b != num_buckets; ++b)
+        {
+            for (std::size_t j = offsets[k + b]; j != offsets[k + b + 1]; ++j)
+            {
+                HPX_TEST_EQ(get_bucket()(d[j]), b);
+                ++dest_counts[b];
+            }
+        }
+    }
+
+    HPX_TEST(src_counts == dest_counts);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename T>
+void test_bucket_by_key(ExPolicy&& policy,
+    hpx::partitioned_vector<T> const& src, hpx::partitioned_vector<T>& dest)
+{
+    std::vector<std::size_t> offsets;
+    auto result = hpx::experimental::bucket_by_key(policy, src.begin(),
+        src.end(), dest.begin(), num_buckets, get_bucket(),
+        std::back_inserter(offsets));
+
+    HPX_TEST(result == dest.end());
+    verify_buckets(src, dest, offsets);
+}
+
+template <typename ExPolicy, typename T>
+void test_bucket_by_key_async(ExPolicy&& policy,
+    hpx::partitioned_vector<T> const& src, hpx::partitioned_vector<T>& dest)
+{
+    std::vector<std::size_t> offsets;
+    auto f = hpx::experimental::bucket_by_key(policy, src.begin(), src.end(),
+        dest.begin(), num_buckets, get_bucket(), std::back_inserter(offsets));
+
+    HPX_TEST(f.get() == dest.end());
+    verify_buckets(src, dest, offsets);
+}
+
+template <typename T>
+void bucket_by_key_tests(std::vector<hpx::id_type>& localities)
+{
+    std::size_t const num = 10007;
+    hpx::partitioned_vector<T> src(num, hpx::container_layout(localities));
+    hpx::partitioned_vector<T> dest(num, hpx::container_layout(localities));
+    fill_vector(src);
+
+    test_bucket_by_key(hpx::execution::seq, src, dest);
+    test_bucket_by_key(hpx::execution::par, src, dest);
+
+    test_bucket_by_key_async(
+        hpx::execution::seq(hpx::execution::task), src, dest);
+    test_bucket_by_key_async(
+        hpx::execution::par(hpx::execution::task), src, dest);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+    bucket_by_key_tests<int>(localities);
+    bucket_by_key_tests<double>(localities);
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,108 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_histogram.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double);
+// HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+// element i holds the value i % 10, every 12th element is out of range
+template <typename T>
+void fill_vector(hpx::partitioned_vector<T>& v)
+{
+    std::size_t i = 0;
+    typename hpx::partitioned_vector<T>::iterator it = v.begin(), end = v.end();
+    for (/**/; it != end; ++it, ++i)
+        *it = (i % 12 == 11) ? T(-1) : T(i % 10);
+}
+
+std::vector<std::size_t> expected_counts(std::size_t num)
+{
+    std::vector<std::size_t> counts(10, 0);
+    for (std::size_t i = 0; i != num; ++i)
+    {
+        if (i % 12 != 11)
+            ++counts[i % 10];
+    }
+    return counts;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename T>
+void test_histogram(ExPolicy&& policy, hpx::partitioned_vector<T> const& v,
+    std::vector<std::size_t> const& expected)
+{
+    std::vector<std::size_t> counts(10);
+    auto result = hpx::experimental::histogram(policy, v.begin(), v.end(),
+        std::size_t(10), T(0), T(10), counts.begin());
+
+    HPX_TEST(result == counts.end());
+    HPX_TEST(counts == expected);
+
+    // the edges [0, 5) and [5, 10)
+    std::vector<T> edges = {T(0), T(5), T(10)};
+    std::vector<std::size_t> edge_counts(2);
+    hpx::experimental::histogram(policy, v.begin(), v.end(), edges.begin(),
+        edges.end(), edge_counts.begin());
+
+    HPX_TEST_EQ(edge_counts[0],
+        expected[0] + expected[1] + expected[2] + expected[3] + expected[4]);
+    HPX_TEST_EQ(edge_counts[1],
+        expected[5] + expected[6] + expected[7] + expected[8] + expected[9]);
+}
+
+template <typename ExPolicy, typename T>
+void test_histogram_async(ExPolicy&& policy,
+    hpx::partitioned_vector<T> const& v,
+    std::vector<std::size_t> const& expected)
+{
+    std::vector<std::size_t> counts(10);
+    auto f = hpx::experimental::histogram(policy, v.begin(), v.end(),
+        std::size_t(10), T(0), T(10), counts.begin());
+
+    HPX_TEST(f.get() == counts.end());
+    HPX_TEST(counts == expected);
+}
+
+template <typename T>
+void histogram_tests(std::vector<hpx::id_type>& localities)
+{
+    std::size_t const num = 10007;
+    hpx::partitioned_vector<T> v(num, hpx::container_layout(localities));
+    fill_vector(v);
+
+    std::vector<std::size_t> const expected = expected_counts(num);
+
+    test_histogram(hpx::execution::seq, v, expected);
+    test_histogram(hpx::execution::par, v, expected);
+
+    test_histogram_async(
+        hpx::execution::seq(hpx::execution::task), v, expected);
+    test_histogram_async(
+        hpx::execution::par(hpx::execution::task), v, expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+    histogram_tests<int>(localities);
+    histogram_tests<double>(localities);
+    return hpx::util::report_errors();
+}
+#endif
@@ -316,6 +316,12 @@ namespace hpx { namespace threads {
         std::int64_t get_average_thread_wait_time(bool reset);
         std::int64_t get_average_task_wait_time(bool reset);
 #endif
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+        std::vector<std::int64_t> get_queue_wait_time_histogram(bool reset);
+        std::vector<std::int64_t> get_thread_phase_duration_histogram(
+            bool reset);
+        std::vector<std::int64_t> get_resume_latency_histogram(bool reset);
+#endif
 #if defined(HPX_HAVE_BACKGROUND_THREAD_COUNTERS) &&                            \
     defined(HPX_HAVE_THREAD_IDLE_RATES)
         std::int64_t get_background_work_duration(bool reset);
@@ -392,6 +398,14 @@ namespace hpx { namespace threads {
 #endif
 
     private:
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+        // sum up the given latency histogram over all pools
+        std::vector<std::int64_t> get_latency_histogram(
+            std::vector<std::int64_t> (thread_pool_base::*histogram)(
+                std::size_t, bool),
+            bool reset);
+#endif
+
         mutable mutex_type mtx_;    // mutex protecting the members
 
         util::runtime_configuration& rtcfg_;
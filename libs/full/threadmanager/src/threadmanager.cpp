@@ -22,6 +22,7 @@
 #include <hpx/runtime/threads/thread_pool_suspension_helpers.hpp>
 #include <hpx/runtime_configuration/runtime_configuration.hpp>
 #include <hpx/thread_pools/scheduled_thread_pool.hpp>
+#include <hpx/threading_base/latency_histogram.hpp>
 #include <hpx/threading_base/set_thread_state.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
@@ -140,6 +141,8 @@ namespace hpx { namespace threads {
                 HPX_THREAD_QUEUE_MAX_TERMINATED_THREADS);
         double const max_idle_backoff_time = hpx::util::get_entry_as<double>(
             rtcfg_, "hpx.max_idle_backoff_time", HPX_IDLE_BACKOFF_TIME_MAX);
+        bool const idle_parking =
+            hpx::util::get_entry_as<int>(rtcfg_, "hpx.idle_parking", 0) != 0;
 
         std::ptrdiff_t small_stacksize =
             rtcfg_.get_stack_size(thread_stacksize::small_);
@@ -169,6 +172,11 @@ namespace hpx { namespace threads {
             resource::scheduling_policy sched_type = rp.which_scheduler(name);
             std::size_t num_threads_in_pool = rp.get_num_threads(i);
             policies::scheduler_mode scheduler_mode = rp.get_scheduler_mode(i);
+            if (idle_parking)
+            {
+                scheduler_mode = policies::scheduler_mode(
+                    scheduler_mode | policies::enable_idle_parking);
+            }
 
             // make sure the first thread-pool that gets instantiated is the default one
             if (i == 0)
@@ -538,6 +546,41 @@ namespace hpx { namespace threads {
 #endif
                 break;
             }
+
+            case resource::work_stealing:
+            {
+#if defined(HPX_HAVE_WORK_STEALING_SCHEDULER)
+                // instantiate the scheduler
+                using local_sched_type =
+                    hpx::threads::policies::work_stealing_queue_scheduler<>;
+
+                local_sched_type::init_parameter_type init(
+                    thread_pool_init.num_threads_,
+                    thread_pool_init.affinity_data_, thread_queue_init,
+                    "core-work_stealing_queue_scheduler");
+
+                std::unique_ptr<local_sched_type> sched(
+                    new local_sched_type(init));
+
+                // set the default scheduler flags
+                sched->set_scheduler_mode(thread_pool_init.mode_);
+                // conditionally set/unset this flag
+                sched->update_scheduler_mode(
+                    policies::enable_stealing_numa, !numa_sensitive);
+
+                // instantiate the pool
+                std::unique_ptr<thread_pool_base> pool(
+                    new hpx::threads::detail::scheduled_thread_pool<
+                        local_sched_type>(std::move(sched), thread_pool_init));
+                pools_.push_back(std::move(pool));
+#else
+                throw hpx::detail::command_line_error(
+                    "Command line option --hpx:queuing=work-stealing "
+                    "is not configured in this build. Please rebuild with "
+                    "'cmake -DHPX_WITH_THREAD_SCHEDULERS=work-stealing'.");
+#endif
+                break;
+            }
             }
 
             // update the thread_offset for the next pool
@@ -824,6 +867,45 @@ namespace hpx { namespace threads {
     }
 #endif
 
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+    std::vector<std::int64_t> threadmanager::get_latency_histogram(
+        std::vector<std::int64_t> (thread_pool_base::*histogram)(
+            std::size_t, bool),
+        bool reset)
+    {
+        std::vector<std::int64_t> result(latency_histogram::num_buckets, 0);
+        for (auto const& pool_iter : pools_)
+        {
+            std::vector<std::int64_t> counts =
+                ((*pool_iter).*histogram)(all_threads, reset);
+            for (std::size_t i = 0; i != counts.size(); ++i)
+                result[i] += counts[i];
+        }
+        return result;
+    }
+
+    std::vector<std::int64_t> threadmanager::get_queue_wait_time_histogram(
+        bool reset)
+    {
+        return get_latency_histogram(
+            &thread_pool_base::get_queue_wait_time_histogram, reset);
+    }
+
+    std::vector<std::int64_t>
+    threadmanager::get_thread_phase_duration_histogram(bool reset)
+    {
+        return get_latency_histogram(
+            &thread_pool_base::get_thread_phase_duration_histogram, reset);
+    }
+
+    std::vector<std::int64_t> threadmanager::get_resume_latency_histogram(
+        bool reset)
+    {
+        return get_latency_histogram(
+            &thread_pool_base::get_resume_latency_histogram, reset);
+    }
+#endif
+
     std::int64_t threadmanager::get_cumulative_duration(bool reset)
     {
         std::int64_t result = 0;
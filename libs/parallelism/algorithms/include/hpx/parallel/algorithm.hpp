@@ -33,7 +33,9 @@
 #include <hpx/parallel/algorithms/minmax.hpp>
 #include <hpx/parallel/algorithms/mismatch.hpp>
 #include <hpx/parallel/algorithms/move.hpp>
+#include <hpx/parallel/algorithms/nth_element.hpp>
 #include <hpx/parallel/algorithms/partial_sort.hpp>
+#include <hpx/parallel/algorithms/partial_sort_copy.hpp>
 #include <hpx/parallel/algorithms/partition.hpp>
 #include <hpx/parallel/algorithms/remove.hpp>
 #include <hpx/parallel/algorithms/remove_copy.hpp>
@@ -52,3 +54,7 @@
 
 // Parallelism TS V2
 #include <hpx/parallel/algorithms/for_loop.hpp>
+
+// Extensions
+#include <hpx/parallel/algorithms/bucket_by_key.hpp>
+#include <hpx/parallel/algorithms/histogram.hpp>
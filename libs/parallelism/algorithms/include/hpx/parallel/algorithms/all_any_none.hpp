@@ -240,7 +240,6 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/algorithms/detail/find.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
-#include <hpx/parallel/util/invoke_projected.hpp>
 #include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
 #include <hpx/type_support/unused.hpp>
@@ -268,11 +267,12 @@ namespace hpx { namespace parallel { inline namespace v1 {
             template <typename ExPolicy, typename Iter, typename Sent,
                 typename F, typename Proj>
             static bool sequential(
-                ExPolicy, Iter first, Sent last, F&& f, Proj&& proj)
+                ExPolicy&& policy, Iter first, Sent last, F&& f, Proj&& proj)
             {
-                return detail::sequential_find_if(first, last,
-                           util::invoke_projected<F, Proj>(std::forward<F>(f),
-                               std::forward<Proj>(proj))) == last;
+                return detail::sequential_find_if(
+                           std::forward<ExPolicy>(policy), first, last,
+                           std::forward<F>(f),
+                           std::forward<Proj>(proj)) == last;
             }
 
             template <typename ExPolicy, typename FwdIter, typename Sent,
@@ -289,17 +289,11 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 util::cancellation_token<> tok;
                 auto f1 = [op = std::forward<F>(op), tok,
-                              proj = std::forward<Proj>(proj)](
+                              proj = std::forward<Proj>(proj), policy](
                               FwdIter part_begin,
                               std::size_t part_count) mutable -> bool {
-                    util::loop_n<ExPolicy>(part_begin, part_count, tok,
-                        [&op, &tok, &proj](FwdIter const& curr) {
-                            if (hpx::util::invoke(
-                                    op, hpx::util::invoke(proj, *curr)))
-                            {
-                                tok.cancel();
-                            }
-                        });
+                    detail::sequential_find_if(
+                        policy, part_begin, part_count, tok, op, proj);
 
                     return !tok.was_cancelled();
                 };
@@ -386,11 +380,12 @@ namespace hpx { namespace parallel { inline namespace v1 {
             template <typename ExPolicy, typename Iter, typename Sent,
                 typename F, typename Proj>
             static bool sequential(
-                ExPolicy, Iter first, Sent last, F&& f, Proj&& proj)
+                ExPolicy&& policy, Iter first, Sent last, F&& f, Proj&& proj)
             {
-                return detail::sequential_find_if(first, last,
-                           util::invoke_projected<F, Proj>(std::forward<F>(f),
-                               std::forward<Proj>(proj))) != last;
+                return detail::sequential_find_if(
+                           std::forward<ExPolicy>(policy), first, last,
+                           std::forward<F>(f),
+                           std::forward<Proj>(proj)) != last;
             }
 
             template <typename ExPolicy, typename FwdIter, typename Sent,
@@ -407,17 +402,11 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 util::cancellation_token<> tok;
                 auto f1 = [op = std::forward<F>(op), tok,
-                              proj = std::forward<Proj>(proj)](
+                              proj = std::forward<Proj>(proj), policy](
                               FwdIter part_begin,
                               std::size_t part_count) mutable -> bool {
-                    util::loop_n<ExPolicy>(part_begin, part_count, tok,
-                        [&op, &tok, &proj](FwdIter const& curr) {
-                            if (hpx::util::invoke(
-                                    op, hpx::util::invoke(proj, *curr)))
-                            {
-                                tok.cancel();
-                            }
-                        });
+                    detail::sequential_find_if(
+                        policy, part_begin, part_count, tok, op, proj);
 
                     return tok.was_cancelled();
                 };
@@ -504,9 +493,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
             template <typename ExPolicy, typename Iter, typename Sent,
                 typename F, typename Proj>
             static bool sequential(
-                ExPolicy, Iter first, Sent last, F&& f, Proj&& proj)
+                ExPolicy&& policy, Iter first, Sent last, F&& f, Proj&& proj)
             {
-                return detail::sequential_find_if_not(first, last,
+                return detail::sequential_find_if_not(
+                           std::forward<ExPolicy>(policy), first, last,
                            std::forward<F>(f),
                            std::forward<Proj>(proj)) == last;
             }
@@ -525,17 +515,11 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 util::cancellation_token<> tok;
                 auto f1 = [op = std::forward<F>(op), tok,
-                              proj = std::forward<Proj>(proj)](
+                              proj = std::forward<Proj>(proj), policy](
                               FwdIter part_begin,
                               std::size_t part_count) mutable -> bool {
-                    util::loop_n<ExPolicy>(part_begin, part_count, tok,
-                        [&op, &tok, &proj](FwdIter const& curr) {
-                            if (!hpx::util::invoke(
-                                    op, hpx::util::invoke(proj, *curr)))
-                            {
-                                tok.cancel();
-                            }
-                        });
+                    detail::sequential_find_if_not(
+                        policy, part_begin, part_count, tok, op, proj);
 
                     return !tok.was_cancelled();
                 };
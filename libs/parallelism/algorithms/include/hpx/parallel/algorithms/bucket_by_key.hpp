@@ -0,0 +1,304 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/bucket_by_key.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+namespace hpx { namespace experimental {
+    // clang-format off
+
+    /// Copies the elements in the range [first, last) to the range beginning
+    /// at \a dest, grouped by the bucket the function \a key returns for each
+    /// of them. The elements of bucket 0 are copied first, followed by the
+    /// elements of bucket 1, and so on. The relative order of the elements
+    /// within each bucket is preserved. The offsets of the buckets relative
+    /// to \a dest are written to \a offsets (\a num_buckets + 1 values, the
+    /// last one being the number of copied elements).
+    ///
+    /// \note   Complexity: Performs exactly 2 * (\a last - \a first)
+    ///         applications of \a key and exactly \a last - \a first
+    ///         assignments.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam FwdIter     The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam RandIter    The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Key         The type of the function/function object to use
+    ///                     (deduced). Unlike its sequential form, the parallel
+    ///                     overload of \a bucket_by_key requires \a Key to
+    ///                     meet the requirements of \a CopyConstructible.
+    /// \tparam OutIter     The type of the iterator the offsets of the buckets
+    ///                     are written to (deduced). This iterator type must
+    ///                     meet the requirements of an output iterator.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param dest         Refers to the beginning of the destination range.
+    /// \param num_buckets  The number of buckets.
+    /// \param key          Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements to
+    ///                     compute its bucket. The signature of this function
+    ///                     should be equivalent to:
+    ///                     \code
+    ///                     std::size_t key(const Type &a);
+    ///                     \endcode \n
+    ///                     The returned bucket must be smaller than
+    ///                     \a num_buckets.
+    /// \param offsets      Refers to the beginning of the range the offsets of
+    ///                     the buckets are written to.
+    ///
+    /// The assignments in the parallel \a bucket_by_key algorithm invoked with
+    /// an execution policy object of type \a sequenced_policy execute in
+    /// sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a bucket_by_key algorithm invoked with
+    /// an execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// If \a first and \a last are segmented iterators the elements of each
+    /// segment are grouped separately, they are copied into the
+    /// corresponding part of the destination range which has to be
+    /// partitioned in the same way. In this case \a num_buckets + 1 offsets
+    /// are written for each of the segments, all of them relative to
+    /// \a dest.
+    ///
+    /// \returns  The \a bucket_by_key algorithm returns a
+    ///           \a hpx::future<RandIter> if the execution policy is of type
+    ///           \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a RandIter otherwise.
+    ///           The \a bucket_by_key algorithm returns the output iterator to
+    ///           the element in the destination range, one past the last
+    ///           element copied.
+    ///
+    template <typename ExPolicy, typename FwdIter, typename RandIter,
+        typename Key, typename OutIter>
+    typename util::detail::algorithm_result<ExPolicy, RandIter>::type
+    bucket_by_key(ExPolicy&& policy, FwdIter first, FwdIter last,
+        RandIter dest, std::size_t num_buckets, Key&& key, OutIter offsets);
+
+    // clang-format on
+}}    // namespace hpx::experimental
+
+#else    // DOXYGEN
+
+#include <hpx/config.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/functional/traits/is_invocable.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/modules/futures.hpp>
+
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/histogram.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+    ///////////////////////////////////////////////////////////////////////////
+    // bucket_by_key
+    namespace detail {
+        /// \cond NOINTERNAL
+        struct bucket_by_key
+          : public detail::algorithm<bucket_by_key, std::vector<std::size_t>>
+        {
+            bucket_by_key()
+              : bucket_by_key::algorithm("bucket_by_key")
+            {
+            }
+
+            template <typename ExPolicy, typename FwdIter, typename RandIter,
+                typename Key>
+            static std::vector<std::size_t> sequential(ExPolicy&&,
+                FwdIter first, FwdIter last, RandIter dest,
+                std::size_t num_buckets, Key&& key)
+            {
+                hpx::execution::sequenced_policy seq_policy;
+                return bucket_by_key_n(seq_policy, first,
+                    detail::distance(first, last), dest, num_buckets, key);
+            }
+
+            template <typename ExPolicy, typename FwdIter, typename RandIter,
+                typename Key>
+            static typename util::detail::algorithm_result<ExPolicy,
+                std::vector<std::size_t>>::type
+            parallel(ExPolicy&& policy, FwdIter first, FwdIter last,
+                RandIter dest, std::size_t num_buckets, Key&& key)
+            {
+                using result = util::detail::algorithm_result<ExPolicy,
+                    std::vector<std::size_t>>;
+                using policy_type = typename std::decay<ExPolicy>::type;
+
+                if (first == last)
+                {
+                    return result::get(
+                        std::vector<std::size_t>(num_buckets + 1));
+                }
+
+                try
+                {
+                    return result::get(execution::async_execute(
+                        policy.executor(),
+                        [first, last, dest, num_buckets,
+                            key = std::forward<Key>(key)](
+                            policy_type policy) mutable {
+                            return bucket_by_key_n(policy, first,
+                                detail::distance(first, last), dest,
+                                num_buckets, key);
+                        },
+                        policy_type(std::forward<ExPolicy>(policy))));
+                }
+                catch (...)
+                {
+                    return result::get(detail::handle_exception<ExPolicy,
+                        std::vector<std::size_t>>::call(
+                        std::current_exception()));
+                }
+            }
+        };
+
+        // Write the offsets of the buckets, return the end of the
+        // destination range
+        template <typename RandIter, typename OutIter>
+        RandIter bucket_by_key_copy(std::vector<std::size_t>&& offsets,
+            RandIter dest, OutIter offsets_dest)
+        {
+            std::copy(offsets.begin(), offsets.end(), offsets_dest);
+            return std::next(dest, offsets.back());
+        }
+
+        template <typename RandIter, typename OutIter>
+        hpx::future<RandIter> bucket_by_key_copy(
+            hpx::future<std::vector<std::size_t>>&& offsets, RandIter dest,
+            OutIter offsets_dest)
+        {
+            return offsets.then(
+                [dest, offsets_dest](
+                    hpx::future<std::vector<std::size_t>>&& f) -> RandIter {
+                    return bucket_by_key_copy(f.get(), dest, offsets_dest);
+                });
+        }
+
+        template <typename ExPolicy, typename FwdIter, typename RandIter,
+            typename Key, typename OutIter>
+        typename util::detail::algorithm_result<ExPolicy, RandIter>::type
+        bucket_by_key_(ExPolicy&& policy, FwdIter first, FwdIter last,
+            RandIter dest, std::size_t num_buckets, Key&& key, OutIter offsets,
+            std::false_type)
+        {
+            using is_seq = hpx::is_sequenced_execution_policy<ExPolicy>;
+
+            return bucket_by_key_copy(
+                bucket_by_key().call(std::forward<ExPolicy>(policy), is_seq(),
+                    first, last, dest, num_buckets, std::forward<Key>(key)),
+                dest, offsets);
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename FwdIter, typename RandIter,
+            typename Key, typename OutIter>
+        typename util::detail::algorithm_result<ExPolicy, RandIter>::type
+        bucket_by_key_(ExPolicy&& policy, FwdIter first, FwdIter last,
+            RandIter dest, std::size_t num_buckets, Key&& key, OutIter offsets,
+            std::true_type);
+        /// \endcond
+    }    // namespace detail
+}}}      // namespace hpx::parallel::v1
+
+namespace hpx { namespace experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for hpx::experimental::bucket_by_key
+    HPX_INLINE_CONSTEXPR_VARIABLE struct bucket_by_key_t final
+      : hpx::functional::tag<bucket_by_key_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter, typename RandIter,
+            typename Key, typename OutIter,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy<ExPolicy>::value &&
+                hpx::traits::is_iterator<FwdIter>::value &&
+                hpx::traits::is_iterator<RandIter>::value &&
+                hpx::traits::is_iterator<OutIter>::value &&
+                hpx::is_invocable_v<Key,
+                    typename std::iterator_traits<FwdIter>::value_type
+                >
+            )>
+        // clang-format on
+        friend typename hpx::parallel::util::detail::algorithm_result<ExPolicy,
+            RandIter>::type
+        tag_invoke(bucket_by_key_t, ExPolicy&& policy, FwdIter first,
+            FwdIter last, RandIter dest, std::size_t num_buckets, Key&& key,
+            OutIter offsets)
+        {
+            static_assert((hpx::traits::is_forward_iterator<FwdIter>::value),
+                "Requires at least forward iterator.");
+            static_assert(
+                (hpx::traits::is_random_access_iterator<RandIter>::value),
+                "Requires a random access iterator.");
+
+            using is_segmented = hpx::traits::is_segmented_iterator<FwdIter>;
+
+            return hpx::parallel::v1::detail::bucket_by_key_(
+                std::forward<ExPolicy>(policy), first, last, dest, num_buckets,
+                std::forward<Key>(key), offsets, is_segmented());
+        }
+
+        // clang-format off
+        template <typename FwdIter, typename RandIter, typename Key,
+            typename OutIter,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_iterator<FwdIter>::value &&
+                hpx::traits::is_iterator<RandIter>::value &&
+                hpx::traits::is_iterator<OutIter>::value &&
+                hpx::is_invocable_v<Key,
+                    typename std::iterator_traits<FwdIter>::value_type
+                >
+            )>
+        // clang-format on
+        friend RandIter tag_invoke(bucket_by_key_t, FwdIter first,
+            FwdIter last, RandIter dest, std::size_t num_buckets, Key&& key,
+            OutIter offsets)
+        {
+            static_assert((hpx::traits::is_forward_iterator<FwdIter>::value),
+                "Requires at least forward iterator.");
+            static_assert(
+                (hpx::traits::is_random_access_iterator<RandIter>::value),
+                "Requires a random access iterator.");
+
+            return hpx::parallel::v1::detail::bucket_by_key_(
+                hpx::execution::seq, first, last, dest, num_buckets,
+                std::forward<Key>(key), offsets, std::false_type());
+        }
+    } bucket_by_key{};
+}}    // namespace hpx::experimental
+
+#endif    // DOXYGEN
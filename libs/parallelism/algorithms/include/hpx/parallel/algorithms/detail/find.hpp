@@ -8,9 +8,17 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
 #include <hpx/functional/invoke.hpp>
+#include <hpx/parallel/util/cancellation_token.hpp>
+#include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/projection_identity.hpp>
 
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
 namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
 
     // provide implementation of std::find supporting iterators/sentinels
@@ -60,4 +68,138 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
         }
         return last;
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Execution policy aware versions of the functions above. The overloads
+    // taking a range are used for the sequential execution of the find family
+    // of algorithms, the overloads taking a cancellation token are used for
+    // each of the partitions of their parallel execution. The data-parallel
+    // execution policies provide vectorized implementations of these (see
+    // hpx/parallel/datapar/find.hpp).
+    template <typename ExPolicy, typename Iterator, typename Sentinel,
+        typename T, typename Proj>
+    inline constexpr typename std::enable_if<
+        !hpx::is_vectorpack_execution_policy<ExPolicy>::value, Iterator>::type
+    sequential_find(
+        ExPolicy&&, Iterator first, Sentinel last, T const& value, Proj proj)
+    {
+        return sequential_find(first, last, value, std::move(proj));
+    }
+
+    template <typename ExPolicy, typename Iterator, typename Token,
+        typename T, typename Proj>
+    inline typename std::enable_if<
+        !hpx::is_vectorpack_execution_policy<ExPolicy>::value>::type
+    sequential_find(ExPolicy&&, std::size_t base_idx, Iterator part_begin,
+        std::size_t part_count, Token& tok, T const& value, Proj&& proj)
+    {
+        typedef typename std::iterator_traits<Iterator>::reference reference;
+
+        util::loop_idx_n(base_idx, part_begin, part_count, tok,
+            [&value, &proj, &tok](reference v, std::size_t i) -> void {
+                if (hpx::util::invoke(proj, v) == value)
+                {
+                    tok.cancel(i);
+                }
+            });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iterator, typename Sentinel,
+        typename Pred, typename Proj>
+    inline constexpr typename std::enable_if<
+        !hpx::is_vectorpack_execution_policy<ExPolicy>::value, Iterator>::type
+    sequential_find_if(
+        ExPolicy&&, Iterator first, Sentinel last, Pred pred, Proj proj)
+    {
+        return sequential_find_if(
+            first, last, std::move(pred), std::move(proj));
+    }
+
+    template <typename ExPolicy, typename Iterator, typename Token,
+        typename Pred, typename Proj>
+    inline typename std::enable_if<
+        !hpx::is_vectorpack_execution_policy<ExPolicy>::value>::type
+    sequential_find_if(ExPolicy&&, std::size_t base_idx, Iterator part_begin,
+        std::size_t part_count, Token& tok, Pred&& pred, Proj&& proj)
+    {
+        typedef typename std::iterator_traits<Iterator>::reference reference;
+
+        util::loop_idx_n(base_idx, part_begin, part_count, tok,
+            [&pred, &proj, &tok](reference v, std::size_t i) -> void {
+                if (hpx::util::invoke(pred, hpx::util::invoke(proj, v)))
+                {
+                    tok.cancel(i);
+                }
+            });
+    }
+
+    template <typename ExPolicy, typename Iterator, typename Pred,
+        typename Proj>
+    inline typename std::enable_if<
+        !hpx::is_vectorpack_execution_policy<ExPolicy>::value>::type
+    sequential_find_if(ExPolicy&&, Iterator part_begin,
+        std::size_t part_count, util::cancellation_token<>& tok, Pred&& pred,
+        Proj&& proj)
+    {
+        util::loop_n<ExPolicy>(part_begin, part_count, tok,
+            [&pred, &proj, &tok](Iterator const& curr) -> void {
+                if (hpx::util::invoke(pred, hpx::util::invoke(proj, *curr)))
+                {
+                    tok.cancel();
+                }
+            });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iterator, typename Sentinel,
+        typename Pred, typename Proj>
+    inline constexpr typename std::enable_if<
+        !hpx::is_vectorpack_execution_policy<ExPolicy>::value, Iterator>::type
+    sequential_find_if_not(
+        ExPolicy&&, Iterator first, Sentinel last, Pred pred, Proj proj)
+    {
+        return sequential_find_if_not(
+            first, last, std::move(pred), std::move(proj));
+    }
+
+    template <typename ExPolicy, typename Iterator, typename Token,
+        typename Pred, typename Proj>
+    inline typename std::enable_if<
+        !hpx::is_vectorpack_execution_policy<ExPolicy>::value>::type
+    sequential_find_if_not(ExPolicy&&, std::size_t base_idx,
+        Iterator part_begin, std::size_t part_count, Token& tok, Pred&& pred,
+        Proj&& proj)
+    {
+        typedef typename std::iterator_traits<Iterator>::reference reference;
+
+        util::loop_idx_n(base_idx, part_begin, part_count, tok,
+            [&pred, &proj, &tok](reference v, std::size_t i) -> void {
+                if (!hpx::util::invoke(pred, hpx::util::invoke(proj, v)))
+                {
+                    tok.cancel(i);
+                }
+            });
+    }
+
+    template <typename ExPolicy, typename Iterator, typename Pred,
+        typename Proj>
+    inline typename std::enable_if<
+        !hpx::is_vectorpack_execution_policy<ExPolicy>::value>::type
+    sequential_find_if_not(ExPolicy&&, Iterator part_begin,
+        std::size_t part_count, util::cancellation_token<>& tok, Pred&& pred,
+        Proj&& proj)
+    {
+        util::loop_n<ExPolicy>(part_begin, part_count, tok,
+            [&pred, &proj, &tok](Iterator const& curr) -> void {
+                if (!hpx::util::invoke(pred, hpx::util::invoke(proj, *curr)))
+                {
+                    tok.cancel();
+                }
+            });
+    }
 }}}}    // namespace hpx::parallel::v1::detail
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/parallel/datapar/find.hpp>
+#endif
@@ -0,0 +1,502 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_information.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/iterator_support/counting_iterator.hpp>
+#include <hpx/iterator_support/iterator_range.hpp>
+#include <hpx/modules/async_combinators.hpp>
+#include <hpx/modules/futures.hpp>
+#include <hpx/parallel/util/detail/chunk_size.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    /// \cond NOINTERNAL
+
+    // we should not get smaller than this per chunk of elements
+    static constexpr std::size_t histogram_limit_per_task = 16384;
+
+    // Histograms with more bins than this are accumulated in one set of
+    // atomic counters instead of in private bins per worker as the private
+    // bins would not fit into the cache of a core anymore.
+    static constexpr std::size_t histogram_max_private_bins = 65536;
+
+    // The per-chunk tables of the bucketing are scanned in parallel for
+    // ranges of buckets once they have at least this many entries.
+    static constexpr std::size_t histogram_parallel_scan_size = 65536;
+    static constexpr std::size_t histogram_parallel_scan_ranges = 16;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Bins of equal width covering [lower, upper). The bins are computed in
+    // double precision.
+    template <typename T>
+    class histogram_uniform_bins
+    {
+    public:
+        histogram_uniform_bins() = default;
+
+        histogram_uniform_bins(std::size_t num_bins, T lower, T upper)
+          : num_bins_(num_bins)
+          , lower_(static_cast<double>(lower))
+          , upper_(static_cast<double>(upper))
+          , scale_(num_bins == 0 || !(lower_ < upper_) ?
+                    0.0 :
+                    static_cast<double>(num_bins) / (upper_ - lower_))
+        {
+        }
+
+        std::size_t size() const noexcept
+        {
+            return num_bins_;
+        }
+
+        // Return the bin of the given value, size() if the value does not
+        // belong to any of the bins.
+        template <typename U>
+        HPX_FORCEINLINE std::size_t operator()(U const& value) const
+        {
+            double const v = static_cast<double>(value);
+
+            // the comparisons are false for NaN
+            if (!(v >= lower_ && v < upper_))
+                return num_bins_;
+
+            // guard against rounding for values close to the upper bound
+            return (std::min)(
+                static_cast<std::size_t>((v - lower_) * scale_), num_bins_ - 1);
+        }
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned)
+        {
+            // clang-format off
+            ar & num_bins_ & lower_ & upper_ & scale_;
+            // clang-format on
+        }
+
+    private:
+        std::size_t num_bins_ = 0;
+        double lower_ = 0.0;
+        double upper_ = 0.0;
+        double scale_ = 0.0;
+    };
+
+    // Bins given by their sorted edges, bin i covers [edges[i], edges[i+1]).
+    template <typename T>
+    class histogram_edge_bins
+    {
+    public:
+        histogram_edge_bins() = default;
+
+        template <typename Iter>
+        histogram_edge_bins(Iter first, Iter last)
+          : edges_(first, last)
+        {
+            HPX_ASSERT(std::is_sorted(edges_.begin(), edges_.end()));
+        }
+
+        std::size_t size() const noexcept
+        {
+            return edges_.size() < 2 ? 0 : edges_.size() - 1;
+        }
+
+        template <typename U>
+        HPX_FORCEINLINE std::size_t operator()(U const& value) const
+        {
+            // values below the first edge, at or above the last edge and NaN
+            // don't belong to any of the bins
+            auto it = std::upper_bound(edges_.begin(), edges_.end(), value);
+            if (it == edges_.begin() || it == edges_.end())
+                return size();
+
+            return static_cast<std::size_t>(it - edges_.begin()) - 1;
+        }
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned)
+        {
+            // clang-format off
+            ar & edges_;
+            // clang-format on
+        }
+
+    private:
+        std::vector<T> edges_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Rows of counters, the rows start on separate cache lines to avoid
+    // false sharing between the workers updating them.
+    class histogram_padded_rows
+    {
+        static constexpr std::size_t line_size =
+            threads::get_cache_line_size() / sizeof(std::size_t);
+
+    public:
+        histogram_padded_rows(std::size_t num_rows, std::size_t row_size)
+          : stride_((row_size + line_size - 1) / line_size * line_size)
+          , data_(num_rows * stride_ + line_size, 0)
+          , offset_(0)
+        {
+            std::size_t const misalignment =
+                reinterpret_cast<std::uintptr_t>(data_.data()) %
+                threads::get_cache_line_size();
+            if (misalignment != 0)
+            {
+                offset_ = (threads::get_cache_line_size() - misalignment) /
+                    sizeof(std::size_t);
+            }
+        }
+
+        std::size_t* operator[](std::size_t row) noexcept
+        {
+            return data_.data() + offset_ + row * stride_;
+        }
+
+    private:
+        std::size_t stride_;
+        std::vector<std::size_t> data_;
+        std::size_t offset_;
+    };
+
+    // The beginning and the size of the chunks of a sequence
+    template <typename FwdIter>
+    class histogram_chunks
+    {
+    public:
+        histogram_chunks(FwdIter first, std::size_t count, std::size_t size)
+          : count_(count)
+          , size_(size)
+        {
+            HPX_ASSERT(size != 0);
+
+            std::size_t const num_chunks = (count + size - 1) / size;
+            starts_.reserve(num_chunks);
+            for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+            {
+                starts_.push_back(first);
+                if (chunk + 1 != num_chunks)
+                    std::advance(first, size);
+            }
+        }
+
+        std::size_t size() const noexcept
+        {
+            return starts_.size();
+        }
+
+        FwdIter begin(std::size_t chunk) const
+        {
+            return starts_[chunk];
+        }
+
+        std::size_t count(std::size_t chunk) const noexcept
+        {
+            return (std::min)(size_, count_ - chunk * size_);
+        }
+
+    private:
+        std::vector<FwdIter> starts_;
+        std::size_t count_;
+        std::size_t size_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Return the number of elements per chunk to use for the given number of
+    // elements
+    template <typename ExPolicy>
+    std::size_t histogram_chunk_size(ExPolicy& policy, std::size_t count)
+    {
+        if (hpx::is_sequenced_execution_policy<ExPolicy>::value ||
+            count < 2 * histogram_limit_per_task)
+        {
+            return (std::max)(count, std::size_t(1));
+        }
+
+        std::size_t const cores = execution::processing_units_count(
+            policy.parameters(), policy.executor());
+
+        std::size_t max_chunks = execution::maximal_number_of_chunks(
+            policy.parameters(), policy.executor(), cores, count);
+
+        std::size_t chunk_size = execution::get_chunk_size(policy.parameters(),
+            policy.executor(), [](std::size_t) { return 0; }, cores, count);
+
+        util::detail::adjust_chunk_size_and_max_chunks(
+            cores, count, max_chunks, chunk_size);
+
+        return (std::max)(chunk_size, histogram_limit_per_task);
+    }
+
+    // Invoke f(i) for i in [0, count) concurrently, rethrow the exceptions
+    // as an exception_list
+    template <typename ExPolicy, typename F>
+    void histogram_for_each(ExPolicy& policy, std::size_t count, F&& f)
+    {
+        using policy_type = typename std::decay<ExPolicy>::type;
+
+        if (count == 1)
+        {
+            try
+            {
+                f(std::size_t(0));
+            }
+            catch (...)
+            {
+                util::detail::handle_local_exceptions<policy_type>::call(
+                    std::current_exception());
+            }
+            return;
+        }
+
+        auto shape = hpx::util::make_iterator_range(
+            hpx::util::make_counting_iterator(std::size_t(0)),
+            hpx::util::make_counting_iterator(count));
+
+        auto futures = execution::bulk_async_execute(
+            policy.executor(), std::forward<F>(f), shape);
+
+        hpx::wait_all(futures);
+
+        std::list<std::exception_ptr> errors;
+        util::detail::handle_local_exceptions<policy_type>::call(
+            futures, errors);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Add the bins of count elements starting at first to the counters. The
+    // counters have one additional entry for the values outside of the bins.
+    template <typename FwdIter, typename Bins>
+    void histogram_count(
+        FwdIter first, std::size_t count, Bins const& bins, std::size_t* counts)
+    {
+        for (/**/; count != 0; (void) ++first, --count)
+        {
+            ++counts[bins(*first)];
+        }
+    }
+
+    template <typename FwdIter, typename Bins>
+    std::vector<std::size_t> histogram_sequential(
+        FwdIter first, std::size_t count, Bins const& bins)
+    {
+        std::vector<std::size_t> counts(bins.size() + 1, 0);
+        histogram_count(first, count, bins, counts.data());
+        counts.pop_back();
+        return counts;
+    }
+
+    // Return the number of elements of [first, first + count) in each of the
+    // bins. Every worker counts the elements of the chunks it takes into its
+    // own set of bins, the bins of all workers are added up pairwise in a
+    // tree. Large numbers of bins are counted using atomic counters instead.
+    template <typename ExPolicy, typename FwdIter, typename Bins>
+    std::vector<std::size_t> histogram_n(
+        ExPolicy& policy, FwdIter first, std::size_t count, Bins const& bins)
+    {
+        std::size_t const num_bins = bins.size();
+
+        std::size_t const chunk_size = histogram_chunk_size(policy, count);
+        if (chunk_size >= count)
+        {
+            // count on the calling thread, report errors like for the chunks
+            std::vector<std::size_t> result;
+            histogram_for_each(policy, 1, [&](std::size_t) {
+                result = histogram_sequential(first, count, bins);
+            });
+            return result;
+        }
+
+        histogram_chunks<FwdIter> chunks(first, count, chunk_size);
+
+        std::size_t const cores = execution::processing_units_count(
+            policy.parameters(), policy.executor());
+        std::size_t const num_workers = (std::min)(cores, chunks.size());
+
+        std::atomic<std::size_t> next_chunk(0);
+
+        if (num_bins > histogram_max_private_bins ||
+            num_workers * (num_bins + 1) > count)
+        {
+            std::vector<std::atomic<std::size_t>> counts(num_bins + 1);
+            histogram_for_each(policy, num_workers, [&](std::size_t) {
+                for (std::size_t chunk = next_chunk++; chunk < chunks.size();
+                     chunk = next_chunk++)
+                {
+                    FwdIter it = chunks.begin(chunk);
+                    for (std::size_t n = chunks.count(chunk); n != 0;
+                         (void) ++it, --n)
+                    {
+                        counts[bins(*it)].fetch_add(
+                            1, std::memory_order_relaxed);
+                    }
+                }
+            });
+
+            std::vector<std::size_t> result(num_bins);
+            for (std::size_t b = 0; b != num_bins; ++b)
+            {
+                result[b] = counts[b].load(std::memory_order_relaxed);
+            }
+            return result;
+        }
+
+        histogram_padded_rows counts(num_workers, num_bins + 1);
+        histogram_for_each(policy, num_workers, [&](std::size_t worker) {
+            std::size_t* h = counts[worker];
+            for (std::size_t chunk = next_chunk++; chunk < chunks.size();
+                 chunk = next_chunk++)
+            {
+                histogram_count(
+                    chunks.begin(chunk), chunks.count(chunk), bins, h);
+            }
+        });
+
+        // merge the bins of the workers pairwise, the sum ends up in the
+        // bins of the first worker
+        for (std::size_t stride = 1; stride < num_workers; stride *= 2)
+        {
+            std::size_t const num_pairs =
+                (num_workers - stride + 2 * stride - 1) / (2 * stride);
+
+            histogram_for_each(policy, num_pairs, [&](std::size_t pair) {
+                std::size_t* h = counts[2 * stride * pair];
+                std::size_t const* other = counts[2 * stride * pair + stride];
+                for (std::size_t b = 0; b != num_bins; ++b)
+                {
+                    h[b] += other[b];
+                }
+            });
+        }
+
+        return std::vector<std::size_t>(counts[0], counts[0] + num_bins);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Copy the elements of [first, first + count) to dest, grouped by the
+    // bucket key(element) returns for them. The order of the elements within
+    // each of the buckets is preserved. Return the offsets of the buckets
+    // relative to dest (num_buckets + 1 values, the last one being count).
+    //
+    // The sequence is divided into chunks, the elements of each chunk are
+    // counted per bucket, an exclusive scan over the (bucket, chunk) table
+    // gives the output positions of each chunk, and all chunks are scattered
+    // concurrently. The number of chunks is limited such that the table
+    // doesn't get much larger than the sequence.
+    template <typename ExPolicy, typename FwdIter, typename RandIter,
+        typename Key>
+    std::vector<std::size_t> bucket_by_key_n(ExPolicy& policy, FwdIter first,
+        std::size_t count, RandIter dest, std::size_t num_buckets, Key& key)
+    {
+        std::vector<std::size_t> offsets(num_buckets + 1, 0);
+        if (count == 0)
+            return offsets;
+
+        std::size_t chunk_size = histogram_chunk_size(policy, count);
+        std::size_t const max_chunks =
+            (std::max)(std::size_t(1), 2 * count / (num_buckets + 1));
+        if ((count + chunk_size - 1) / chunk_size > max_chunks)
+        {
+            chunk_size = (count + max_chunks - 1) / max_chunks;
+        }
+
+        histogram_chunks<FwdIter> chunks(first, count, chunk_size);
+        std::size_t const num_chunks = chunks.size();
+
+        auto get_bucket = [&](FwdIter it) -> std::size_t {
+            std::size_t const bucket =
+                static_cast<std::size_t>(hpx::util::invoke(key, *it));
+            HPX_ASSERT(bucket < num_buckets);
+            return bucket;
+        };
+
+        histogram_padded_rows table(num_chunks, num_buckets);
+        histogram_for_each(policy, num_chunks, [&](std::size_t chunk) {
+            std::size_t* h = table[chunk];
+            FwdIter it = chunks.begin(chunk);
+            for (std::size_t n = chunks.count(chunk); n != 0; (void) ++it, --n)
+            {
+                ++h[get_bucket(it)];
+            }
+        });
+
+        // Replace the counts of each chunk by the offsets of its elements
+        // relative to the beginning of each bucket
+        auto scan = [&](std::size_t first_bucket, std::size_t last_bucket) {
+            for (std::size_t b = first_bucket; b != last_bucket; ++b)
+            {
+                std::size_t sum = 0;
+                for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+                {
+                    std::size_t const n = table[chunk][b];
+                    table[chunk][b] = sum;
+                    sum += n;
+                }
+                offsets[b] = sum;
+            }
+        };
+
+        if (num_chunks == 1 ||
+            num_chunks * num_buckets < histogram_parallel_scan_size)
+        {
+            scan(0, num_buckets);
+        }
+        else
+        {
+            std::size_t const num_ranges = histogram_parallel_scan_ranges;
+            histogram_for_each(policy, num_ranges, [&](std::size_t range) {
+                scan(range * num_buckets / num_ranges,
+                    (range + 1) * num_buckets / num_ranges);
+            });
+        }
+
+        std::size_t sum = 0;
+        for (std::size_t b = 0; b != num_buckets + 1; ++b)
+        {
+            std::size_t const n = offsets[b];
+            offsets[b] = sum;
+            sum += n;
+        }
+        HPX_ASSERT(offsets[num_buckets] == count);
+
+        histogram_for_each(policy, num_chunks, [&](std::size_t chunk) {
+            std::size_t* pos = table[chunk];
+            for (std::size_t b = 0; b != num_buckets; ++b)
+            {
+                pos[b] += offsets[b];
+            }
+
+            FwdIter it = chunks.begin(chunk);
+            for (std::size_t n = chunks.count(chunk); n != 0; (void) ++it, --n)
+            {
+                dest[pos[get_bucket(it)]++] = *it;
+            }
+        });
+
+        return offsets;
+    }
+    /// \endcond
+}}}}    // namespace hpx::parallel::v1::detail
@@ -0,0 +1,596 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_information.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/iterator_support/counting_iterator.hpp>
+#include <hpx/iterator_support/iterator_range.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/modules/async_combinators.hpp>
+#include <hpx/modules/futures.hpp>
+#include <hpx/parallel/util/detail/chunk_size.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    /// \cond NOINTERNAL
+
+    // The keys are sorted by digits of 8 bits, starting with the least
+    // significant digit.
+    static constexpr std::size_t radix_sort_digit_bits = 8;
+    static constexpr std::size_t radix_sort_buckets = std::size_t(1)
+        << radix_sort_digit_bits;
+
+    // Sequences shorter than this are sorted by comparison
+    static constexpr std::size_t radix_sort_min_size = 4096;
+
+    // we should not get smaller than this per chunk of elements
+    static constexpr std::size_t radix_sort_limit_per_task = 65536;
+
+    // The exclusive scan over the per-chunk histograms is run in parallel
+    // for ranges of buckets once there are at least this many chunks.
+    static constexpr std::size_t radix_sort_parallel_scan_chunks = 16;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Maps arithmetic keys onto unsigned integers of the same size whose
+    // order is the same as the order of the keys.
+    template <typename T, typename Enable = void>
+    struct radix_sort_key_traits
+    {
+        static constexpr bool is_supported = false;
+    };
+
+    template <typename T>
+    struct radix_sort_key_traits<T,
+        typename std::enable_if<std::is_integral<T>::value &&
+            !std::is_same<T, bool>::value>::type>
+    {
+        static constexpr bool is_supported = true;
+
+        using type = typename std::make_unsigned<T>::type;
+
+        static type to_unsigned(T value) noexcept
+        {
+            // flipping the sign bit moves the negative values in front of the
+            // positive ones
+            type const sign = std::is_signed<T>::value ?
+                type(type(1) << (sizeof(type) * CHAR_BIT - 1)) :
+                type(0);
+            return type(type(value) ^ sign);
+        }
+    };
+
+    template <typename T>
+    struct radix_sort_key_traits<T,
+        typename std::enable_if<std::is_floating_point<T>::value &&
+            std::numeric_limits<T>::is_iec559 &&
+            (sizeof(T) == sizeof(std::uint32_t) ||
+                sizeof(T) == sizeof(std::uint64_t))>::type>
+    {
+        static constexpr bool is_supported = true;
+
+        using type = typename std::conditional<sizeof(T) ==
+                sizeof(std::uint32_t),
+            std::uint32_t, std::uint64_t>::type;
+
+        static type to_unsigned(T value) noexcept
+        {
+            type bits;
+            std::memcpy(&bits, &value, sizeof(T));
+
+            // negative values are ordered by their inverted bit pattern, the
+            // positive values follow all of the negative ones
+            type const sign = type(1) << (sizeof(type) * CHAR_BIT - 1);
+            return (bits & sign) ? type(~bits) : type(bits | sign);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Only comparison function objects which are known to compare the keys
+    // using their operator<() or operator>() can be replaced by the radix
+    // sort. Note that std::less<U> compares values converted to U, which is
+    // why only std::less<T> for the key type T is accepted.
+    template <typename Comp, typename T>
+    struct is_radix_sort_less : std::false_type
+    {
+    };
+
+    template <typename T>
+    struct is_radix_sort_less<detail::less, T> : std::true_type
+    {
+    };
+
+    template <typename T>
+    struct is_radix_sort_less<std::less<>, T> : std::true_type
+    {
+    };
+
+    template <typename T>
+    struct is_radix_sort_less<std::less<T>, T> : std::true_type
+    {
+    };
+
+    template <typename Comp, typename T>
+    struct is_radix_sort_greater : std::false_type
+    {
+    };
+
+    template <typename T>
+    struct is_radix_sort_greater<detail::greater, T> : std::true_type
+    {
+    };
+
+    template <typename T>
+    struct is_radix_sort_greater<std::greater<>, T> : std::true_type
+    {
+    };
+
+    template <typename T>
+    struct is_radix_sort_greater<std::greater<T>, T> : std::true_type
+    {
+    };
+
+    template <typename KeyIter, typename Comp>
+    struct use_radix_sort_for_keys
+      : std::integral_constant<bool,
+            hpx::traits::is_random_access_iterator<KeyIter>::value &&
+                radix_sort_key_traits<typename std::iterator_traits<
+                    KeyIter>::value_type>::is_supported &&
+                (is_radix_sort_less<typename std::decay<Comp>::type,
+                     typename std::iterator_traits<KeyIter>::value_type>::
+                        value ||
+                    is_radix_sort_greater<typename std::decay<Comp>::type,
+                        typename std::iterator_traits<
+                            KeyIter>::value_type>::value)>
+    {
+    };
+
+    // sort(first, last, comp, proj)
+    template <typename Iter, typename Comp, typename Proj>
+    struct use_radix_sort
+      : std::integral_constant<bool,
+            std::is_same<typename std::decay<Proj>::type,
+                util::projection_identity>::value &&
+                use_radix_sort_for_keys<Iter, Comp>::value>
+    {
+    };
+
+    // sort_by_key(key_first, key_last, value_first, comp), the values are
+    // moved through a temporary buffer
+    template <typename KeyIter, typename ValueIter, typename Comp>
+    struct use_radix_sort_by_key
+      : std::integral_constant<bool,
+            use_radix_sort_for_keys<KeyIter, Comp>::value &&
+                hpx::traits::is_random_access_iterator<ValueIter>::value &&
+                std::is_default_constructible<typename std::iterator_traits<
+                    ValueIter>::value_type>::value &&
+                std::is_move_assignable<typename std::iterator_traits<
+                    ValueIter>::value_type>::value>
+    {
+    };
+
+    template <typename KeyIter, typename Comp>
+    struct is_radix_sort_descending
+      : is_radix_sort_greater<typename std::decay<Comp>::type,
+            typename std::iterator_traits<KeyIter>::value_type>
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Placeholder for the values if only the keys are sorted
+    struct radix_sort_no_values
+    {
+    };
+
+    template <typename Src, typename Dest>
+    HPX_FORCEINLINE void radix_sort_move_value(
+        Src src, Dest dest, std::size_t from, std::size_t to)
+    {
+        dest[to] = std::move(src[from]);
+    }
+
+    HPX_FORCEINLINE void radix_sort_move_value(radix_sort_no_values,
+        radix_sort_no_values, std::size_t, std::size_t) noexcept
+    {
+    }
+
+    // The temporary buffer the elements are scattered into on every other
+    // pass
+    template <typename Iter>
+    struct radix_sort_buffer
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+
+        explicit radix_sort_buffer(std::size_t count)
+          : data_(new value_type[count])
+        {
+        }
+
+        value_type* get() const noexcept
+        {
+            return data_.get();
+        }
+
+        std::unique_ptr<value_type[]> data_;
+    };
+
+    template <>
+    struct radix_sort_buffer<radix_sort_no_values>
+    {
+        explicit radix_sort_buffer(std::size_t) noexcept {}
+
+        radix_sort_no_values get() const noexcept
+        {
+            return radix_sort_no_values();
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Parallel LSD radix sort. The sequence is divided into chunks of
+    // consecutive elements. Every pass computes the histogram of the
+    // current digit for each of the chunks, turns the histograms into the
+    // output positions of the elements of each chunk and bucket using an
+    // exclusive scan over the buckets, and finally scatters the elements of
+    // all chunks concurrently. As the elements of each chunk are scattered
+    // in order, every pass is stable.
+    template <typename ExPolicy, typename KeyIter, typename ValueIter>
+    class radix_sorter
+    {
+        using key_type = typename std::iterator_traits<KeyIter>::value_type;
+        using key_traits = radix_sort_key_traits<key_type>;
+        using unsigned_type = typename key_traits::type;
+        using histogram = std::array<std::size_t, radix_sort_buckets>;
+
+        static constexpr std::size_t num_digits =
+            sizeof(unsigned_type) * CHAR_BIT / radix_sort_digit_bits;
+
+    public:
+        radix_sorter(ExPolicy& policy, KeyIter keys, ValueIter values,
+            std::size_t count, std::size_t chunk_size, bool descending)
+          : policy_(policy)
+          , keys_(keys)
+          , values_(values)
+          , count_(count)
+          , chunk_size_(chunk_size)
+          , num_chunks_((count + chunk_size - 1) / chunk_size)
+          , descending_(descending)
+        {
+            HPX_ASSERT(chunk_size != 0);
+        }
+
+        void operator()()
+        {
+            // The number of keys per bucket for each digit doesn't depend on
+            // the order of the keys, count all of them at once to skip
+            // the passes for digits which are the same for all keys.
+            std::vector<histogram> counts(num_chunks_ * num_digits);
+            for_each(num_chunks_, [&](std::size_t chunk) {
+                histogram* h = &counts[chunk * num_digits];
+                for (std::size_t d = 0; d != num_digits; ++d)
+                {
+                    h[d].fill(0);
+                }
+
+                std::size_t const last = chunk_last(chunk);
+                for (std::size_t i = chunk_first(chunk); i != last; ++i)
+                {
+                    unsigned_type const key = get_key(keys_[i]);
+                    for (std::size_t d = 0; d != num_digits; ++d)
+                    {
+                        ++h[d][digit(key, d)];
+                    }
+                }
+            });
+
+            std::vector<histogram> offsets(num_chunks_);
+            radix_sort_buffer<KeyIter> key_buffer(count_);
+            radix_sort_buffer<ValueIter> value_buffer(count_);
+
+            bool in_buffer = false;
+            bool first_pass = true;
+            for (std::size_t d = 0; d != num_digits; ++d)
+            {
+                if (is_trivial_digit(counts, d))
+                    continue;
+
+                if (first_pass)
+                {
+                    // the keys were not moved yet
+                    for (std::size_t chunk = 0; chunk != num_chunks_; ++chunk)
+                    {
+                        offsets[chunk] = counts[chunk * num_digits + d];
+                    }
+                    first_pass = false;
+                }
+                else if (in_buffer)
+                {
+                    count_digits(key_buffer.get(), offsets, d);
+                }
+                else
+                {
+                    count_digits(keys_, offsets, d);
+                }
+
+                histogram const bases = scan_buckets(offsets);
+
+                if (in_buffer)
+                {
+                    scatter(key_buffer.get(), value_buffer.get(), keys_,
+                        values_, offsets, bases, d);
+                }
+                else
+                {
+                    scatter(keys_, values_, key_buffer.get(),
+                        value_buffer.get(), offsets, bases, d);
+                }
+                in_buffer = !in_buffer;
+            }
+
+            // move the elements back into the input sequence
+            if (in_buffer)
+            {
+                auto keys = key_buffer.get();
+                auto values = value_buffer.get();
+                for_each(num_chunks_, [&](std::size_t chunk) {
+                    std::size_t const last = chunk_last(chunk);
+                    for (std::size_t i = chunk_first(chunk); i != last; ++i)
+                    {
+                        keys_[i] = keys[i];
+                        radix_sort_move_value(values, values_, i, i);
+                    }
+                });
+            }
+        }
+
+    private:
+        HPX_FORCEINLINE unsigned_type get_key(key_type key) const noexcept
+        {
+            unsigned_type const k = key_traits::to_unsigned(key);
+            return descending_ ? unsigned_type(~k) : k;
+        }
+
+        static HPX_FORCEINLINE std::size_t digit(
+            unsigned_type key, std::size_t d) noexcept
+        {
+            return std::size_t(key >> (d * radix_sort_digit_bits)) &
+                (radix_sort_buckets - 1);
+        }
+
+        std::size_t chunk_first(std::size_t chunk) const noexcept
+        {
+            return chunk * chunk_size_;
+        }
+
+        std::size_t chunk_last(std::size_t chunk) const noexcept
+        {
+            return (std::min)(count_, (chunk + 1) * chunk_size_);
+        }
+
+        template <typename F>
+        void for_each(std::size_t count, F&& f)
+        {
+            if (count == 1)
+            {
+                f(std::size_t(0));
+                return;
+            }
+
+            auto shape = hpx::util::make_iterator_range(
+                hpx::util::make_counting_iterator(std::size_t(0)),
+                hpx::util::make_counting_iterator(count));
+
+            auto futures = execution::bulk_async_execute(
+                policy_.executor(), std::forward<F>(f), shape);
+
+            hpx::wait_all(futures);
+            for (auto& f : futures)
+            {
+                f.get();    // rethrow exceptions
+            }
+        }
+
+        // Return whether all keys fall into the same bucket for the given
+        // digit, in which case the pass can be skipped.
+        bool is_trivial_digit(
+            std::vector<histogram> const& counts, std::size_t d) const
+        {
+            std::size_t const bucket = digit(get_key(keys_[0]), d);
+
+            std::size_t total = 0;
+            for (std::size_t chunk = 0; chunk != num_chunks_; ++chunk)
+            {
+                total += counts[chunk * num_digits + d][bucket];
+            }
+            return total == count_;
+        }
+
+        template <typename Keys>
+        void count_digits(
+            Keys keys, std::vector<histogram>& offsets, std::size_t d)
+        {
+            for_each(num_chunks_, [&](std::size_t chunk) {
+                histogram& h = offsets[chunk];
+                h.fill(0);
+
+                std::size_t const last = chunk_last(chunk);
+                for (std::size_t i = chunk_first(chunk); i != last; ++i)
+                {
+                    ++h[digit(get_key(keys[i]), d)];
+                }
+            });
+        }
+
+        // Replace the per-chunk histograms by the (exclusive) offsets of the
+        // elements of each chunk relative to the beginning of each bucket.
+        // Return the offsets of the buckets.
+        histogram scan_buckets(std::vector<histogram>& offsets)
+        {
+            histogram bases;
+
+            auto scan = [&](std::size_t first, std::size_t last) {
+                for (std::size_t b = first; b != last; ++b)
+                {
+                    std::size_t sum = 0;
+                    for (std::size_t chunk = 0; chunk != num_chunks_; ++chunk)
+                    {
+                        std::size_t const n = offsets[chunk][b];
+                        offsets[chunk][b] = sum;
+                        sum += n;
+                    }
+                    bases[b] = sum;
+                }
+            };
+
+            if (num_chunks_ < radix_sort_parallel_scan_chunks)
+            {
+                scan(0, radix_sort_buckets);
+            }
+            else
+            {
+                std::size_t const num_ranges = radix_sort_parallel_scan_chunks;
+                std::size_t const buckets_per_range =
+                    radix_sort_buckets / num_ranges;
+
+                for_each(num_ranges, [&](std::size_t range) {
+                    scan(range * buckets_per_range,
+                        (range + 1) * buckets_per_range);
+                });
+            }
+
+            std::size_t sum = 0;
+            for (std::size_t b = 0; b != radix_sort_buckets; ++b)
+            {
+                std::size_t const n = bases[b];
+                bases[b] = sum;
+                sum += n;
+            }
+            HPX_ASSERT(sum == count_);
+
+            return bases;
+        }
+
+        template <typename KeySrc, typename ValueSrc, typename KeyDest,
+            typename ValueDest>
+        void scatter(KeySrc key_src, ValueSrc value_src, KeyDest key_dest,
+            ValueDest value_dest, std::vector<histogram> const& offsets,
+            histogram const& bases, std::size_t d)
+        {
+            for_each(num_chunks_, [&](std::size_t chunk) {
+                histogram pos = offsets[chunk];
+                for (std::size_t b = 0; b != radix_sort_buckets; ++b)
+                {
+                    pos[b] += bases[b];
+                }
+
+                std::size_t const last = chunk_last(chunk);
+                for (std::size_t i = chunk_first(chunk); i != last; ++i)
+                {
+                    key_type const key = key_src[i];
+                    std::size_t const to = pos[digit(get_key(key), d)]++;
+                    key_dest[to] = key;
+                    radix_sort_move_value(value_src, value_dest, i, to);
+                }
+            });
+        }
+
+    private:
+        ExPolicy& policy_;
+        KeyIter keys_;
+        ValueIter values_;
+        std::size_t count_;
+        std::size_t chunk_size_;
+        std::size_t num_chunks_;
+        bool descending_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Return the number of elements per chunk to use for sorting the given
+    // number of elements
+    template <typename ExPolicy>
+    std::size_t radix_sort_chunk_size(ExPolicy& policy, std::size_t count)
+    {
+        if (hpx::is_sequenced_execution_policy<ExPolicy>::value ||
+            count < 2 * radix_sort_limit_per_task)
+        {
+            return count;
+        }
+
+        std::size_t const cores = execution::processing_units_count(
+            policy.parameters(), policy.executor());
+
+        std::size_t max_chunks = execution::maximal_number_of_chunks(
+            policy.parameters(), policy.executor(), cores, count);
+
+        std::size_t chunk_size = execution::get_chunk_size(policy.parameters(),
+            policy.executor(), [](std::size_t) { return 0; }, cores, count);
+
+        util::detail::adjust_chunk_size_and_max_chunks(
+            cores, count, max_chunks, chunk_size);
+
+        return (std::max)(chunk_size, radix_sort_limit_per_task);
+    }
+
+    // Sort the keys in [keys, keys + count) and permute the values alongside
+    // (if any). The keys are sorted in descending order if descending is
+    // true, in ascending order otherwise. The sort is stable.
+    template <typename ExPolicy, typename KeyIter, typename ValueIter>
+    void radix_sort(ExPolicy& policy, KeyIter keys, ValueIter values,
+        std::size_t count, bool descending)
+    {
+        if (count < 2)
+            return;
+
+        radix_sorter<ExPolicy, KeyIter, ValueIter>(policy, keys, values,
+            count, radix_sort_chunk_size(policy, count), descending)();
+    }
+
+    // Same as radix_sort, returns a future which becomes ready once the
+    // sort has finished and which holds the given result.
+    template <typename ExPolicy, typename KeyIter, typename ValueIter,
+        typename Result>
+    hpx::future<Result> radix_sort_async(ExPolicy&& policy, KeyIter keys,
+        ValueIter values, std::size_t count, bool descending, Result result)
+    {
+        using policy_type = typename std::decay<ExPolicy>::type;
+
+        // sort small sequences on the calling thread
+        if (radix_sort_chunk_size(policy, count) == count)
+        {
+            radix_sort(policy, keys, values, count, descending);
+            return hpx::make_ready_future(std::move(result));
+        }
+
+        return execution::async_execute(policy.executor(),
+            [keys, values, count, descending](
+                policy_type policy, Result result) mutable -> Result {
+                radix_sort(policy, keys, values, count, descending);
+                return result;
+            },
+            policy_type(std::forward<ExPolicy>(policy)), std::move(result));
+    }
+    /// \endcond
+}}}}    // namespace hpx::parallel::v1::detail
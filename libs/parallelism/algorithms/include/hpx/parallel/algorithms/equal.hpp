@@ -181,6 +181,7 @@ namespace hpx {
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/find.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
@@ -277,24 +278,20 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 }
 
                 typedef hpx::util::zip_iterator<Iter1, Iter2> zip_iterator;
-                typedef typename zip_iterator::reference reference;
 
                 util::cancellation_token<> tok;
                 auto f1 = [tok, f = std::forward<F>(f),
                               proj1 = std::forward<Proj1>(proj1),
-                              proj2 = std::forward<Proj2>(proj2)](
+                              proj2 = std::forward<Proj2>(proj2), policy](
                               zip_iterator it,
                               std::size_t part_count) mutable -> bool {
-                    util::loop_n<ExPolicy>(it, part_count, tok,
-                        [&f, &proj1, &proj2, &tok](zip_iterator const& curr) {
-                            reference t = *curr;
-                            if (!hpx::util::invoke(f,
-                                    hpx::util::invoke(proj1, hpx::get<0>(t)),
-                                    hpx::util::invoke(proj2, hpx::get<1>(t))))
-                            {
-                                tok.cancel();
-                            }
-                        });
+                    sequential_find_if_not(policy, it, part_count, tok,
+                        [&f, &proj1, &proj2](auto const& t) {
+                            return hpx::util::invoke(f,
+                                hpx::util::invoke(proj1, hpx::get<0>(t)),
+                                hpx::util::invoke(proj2, hpx::get<1>(t)));
+                        },
+                        util::projection_identity());
                     return !tok.was_cancelled();
                 };
 
@@ -387,20 +384,16 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 typedef hpx::util::zip_iterator<FwdIter1, FwdIter2>
                     zip_iterator;
-                typedef typename zip_iterator::reference reference;
 
                 util::cancellation_token<> tok;
-                auto f1 = [f, tok](zip_iterator it,
+                auto f1 = [f, tok, policy](zip_iterator it,
                               std::size_t part_count) mutable -> bool {
-                    util::loop_n<ExPolicy>(it, part_count, tok,
-                        [&f, &tok](zip_iterator const& curr) {
-                            reference t = *curr;
-                            if (!hpx::util::invoke(
-                                    f, hpx::get<0>(t), hpx::get<1>(t)))
-                            {
-                                tok.cancel();
-                            }
-                        });
+                    sequential_find_if_not(policy, it, part_count, tok,
+                        [&f](auto const& t) {
+                            return hpx::util::invoke(
+                                f, hpx::get<0>(t), hpx::get<1>(t));
+                        },
+                        util::projection_identity());
                     return !tok.was_cancelled();
                 };
 
@@ -416,11 +416,11 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
             template <typename ExPolicy, typename Iter, typename Sent,
                 typename T, typename Proj = util::projection_identity>
-            static constexpr Iter sequential(ExPolicy, Iter first, Sent last,
-                T const& val, Proj&& proj = Proj())
+            static constexpr Iter sequential(ExPolicy&& policy, Iter first,
+                Sent last, T const& val, Proj&& proj = Proj())
             {
-                return sequential_find(
-                    first, last, val, std::forward<Proj>(proj));
+                return sequential_find(std::forward<ExPolicy>(policy), first,
+                    last, val, std::forward<Proj>(proj));
             }
 
             template <typename ExPolicy, typename Iter, typename Sent,
@@ -430,7 +430,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 Proj&& proj = Proj())
             {
                 typedef util::detail::algorithm_result<ExPolicy, Iter> result;
-                typedef typename std::iterator_traits<Iter>::value_type type;
                 typedef typename std::iterator_traits<Iter>::difference_type
                     difference_type;
 
@@ -440,16 +439,11 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 util::cancellation_token<std::size_t> tok(count);
 
-                auto f1 = [val, proj = std::forward<Proj>(proj), tok](Iter it,
-                              std::size_t part_size,
+                auto f1 = [val, proj = std::forward<Proj>(proj), tok, policy](
+                              Iter it, std::size_t part_size,
                               std::size_t base_idx) mutable -> void {
-                    util::loop_idx_n(base_idx, it, part_size, tok,
-                        [&val, &proj, &tok](type& v, std::size_t i) -> void {
-                            if (hpx::util::invoke(proj, v) == val)
-                            {
-                                tok.cancel(i);
-                            }
-                        });
+                    sequential_find(
+                        policy, base_idx, it, part_size, tok, val, proj);
                 };
 
                 auto f2 =
@@ -536,11 +530,11 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
             template <typename ExPolicy, typename Iter, typename Sent,
                 typename F, typename Proj = util::projection_identity>
-            static constexpr Iter sequential(
-                ExPolicy, Iter first, Sent last, F&& f, Proj&& proj = Proj())
+            static constexpr Iter sequential(ExPolicy&& policy, Iter first,
+                Sent last, F&& f, Proj&& proj = Proj())
             {
-                return sequential_find_if(
-                    first, last, std::forward<F>(f), std::forward<Proj>(proj));
+                return sequential_find_if(std::forward<ExPolicy>(policy), first,
+                    last, std::forward<F>(f), std::forward<Proj>(proj));
             }
 
             template <typename ExPolicy, typename Iter, typename Sent,
@@ -550,7 +544,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 Proj&& proj = Proj())
             {
                 typedef util::detail::algorithm_result<ExPolicy, Iter> result;
-                typedef typename std::iterator_traits<Iter>::value_type type;
                 typedef typename std::iterator_traits<Iter>::difference_type
                     difference_type;
 
@@ -561,17 +554,11 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 util::cancellation_token<std::size_t> tok(count);
 
                 auto f1 = [f = std::forward<F>(f),
-                              proj = std::forward<Proj>(proj),
-                              tok](Iter it, std::size_t part_size,
+                              proj = std::forward<Proj>(proj), tok, policy](
+                              Iter it, std::size_t part_size,
                               std::size_t base_idx) mutable -> void {
-                    util::loop_idx_n(base_idx, it, part_size, tok,
-                        [&f, &proj, &tok](type& v, std::size_t i) -> void {
-                            if (hpx::util::invoke(
-                                    f, hpx::util::invoke(proj, v)))
-                            {
-                                tok.cancel(i);
-                            }
-                        });
+                    sequential_find_if(
+                        policy, base_idx, it, part_size, tok, f, proj);
                 };
 
                 auto f2 =
@@ -663,10 +650,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
             template <typename ExPolicy, typename Iter, typename Sent,
                 typename F, typename Proj = util::projection_identity>
-            static constexpr Iter sequential(
-                ExPolicy, Iter first, Sent last, F&& f, Proj&& proj = Proj())
+            static constexpr Iter sequential(ExPolicy&& policy, Iter first,
+                Sent last, F&& f, Proj&& proj = Proj())
             {
-                return sequential_find_if_not(
+                return sequential_find_if_not(std::forward<ExPolicy>(policy),
                     first, last, std::forward<F>(f), std::forward<Proj>(proj));
             }
 
@@ -677,7 +664,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 Proj&& proj = Proj())
             {
                 typedef util::detail::algorithm_result<ExPolicy, Iter> result;
-                typedef typename std::iterator_traits<Iter>::value_type type;
                 typedef typename std::iterator_traits<Iter>::difference_type
                     difference_type;
 
@@ -688,17 +674,11 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 util::cancellation_token<std::size_t> tok(count);
 
                 auto f1 = [f = std::forward<F>(f),
-                              proj = std::forward<Proj>(proj),
-                              tok](Iter it, std::size_t part_size,
+                              proj = std::forward<Proj>(proj), tok, policy](
+                              Iter it, std::size_t part_size,
                               std::size_t base_idx) mutable -> void {
-                    util::loop_idx_n(base_idx, it, part_size, tok,
-                        [&f, &proj, &tok](type& v, std::size_t i) -> void {
-                            if (!hpx::util::invoke(
-                                    f, hpx::util::invoke(proj, v)))
-                            {
-                                tok.cancel(i);
-                            }
-                        });
+                    sequential_find_if_not(
+                        policy, base_idx, it, part_size, tok, f, proj);
                 };
 
                 auto f2 =
@@ -0,0 +1,378 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/histogram.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+namespace hpx { namespace experimental {
+    // clang-format off
+
+    /// Counts the elements in the range [first, last) which fall into each of
+    /// \a num_bins bins of equal width covering the interval
+    /// [\a lower, \a upper). Elements outside of this interval (and NaN) are
+    /// not counted. The bin of each element is computed in double precision.
+    ///
+    /// \note   Complexity: Performs exactly \a last - \a first bin
+    ///         computations.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam FwdIter     The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam Size        The type of the number of bins (deduced). This
+    ///                     must be an integral type.
+    /// \tparam T           The type of the bounds of the bins (deduced).
+    /// \tparam OutIter     The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     output iterator.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param num_bins     The number of bins.
+    /// \param lower        The lower bound of the first bin.
+    /// \param upper        The upper bound of the last bin (exclusive).
+    /// \param dest         Refers to the beginning of the destination range
+    ///                     the number of elements in each of the bins is
+    ///                     written to.
+    ///
+    /// The counting in the parallel \a histogram algorithm invoked with an
+    /// execution policy object of type \a sequenced_policy execute in
+    /// sequential order in the calling thread.
+    ///
+    /// The counting in the parallel \a histogram algorithm invoked with an
+    /// execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread. Each of the workers counts into its own set of
+    /// bins, the bins of all workers are added up in a tree. Histograms
+    /// with very many bins are counted using atomic counters instead.
+    ///
+    /// \returns  The \a histogram algorithm returns a \a hpx::future<OutIter>
+    ///           if the execution policy is of type \a sequenced_task_policy
+    ///           or \a parallel_task_policy and returns \a OutIter otherwise.
+    ///           The \a histogram algorithm returns the output iterator to
+    ///           the element in the destination range, one past the count
+    ///           of the last bin.
+    ///
+    template <typename ExPolicy, typename FwdIter, typename Size, typename T,
+        typename OutIter>
+    typename util::detail::algorithm_result<ExPolicy, OutIter>::type
+    histogram(ExPolicy&& policy, FwdIter first, FwdIter last, Size num_bins,
+        T lower, T upper, OutIter dest);
+
+    /// Counts the elements in the range [first, last) which fall into each of
+    /// the bins given by the sorted sequence of bin edges
+    /// [edges_first, edges_last). Bin i covers the interval
+    /// [edges_first[i], edges_first[i + 1]), elements which are not covered
+    /// by any of the bins are not counted.
+    ///
+    /// \note   Complexity: Performs O(N log(M)) comparisons, where
+    ///         N = std::distance(first, last) and
+    ///         M = std::distance(edges_first, edges_last).
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam FwdIter1    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam FwdIter2    The type of the iterators referring to the bin
+    ///                     edges (deduced). This iterator type must meet the
+    ///                     requirements of a forward iterator.
+    /// \tparam OutIter     The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     output iterator.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param edges_first  Refers to the beginning of the sorted sequence of
+    ///                     bin edges.
+    /// \param edges_last   Refers to the end of the sorted sequence of bin
+    ///                     edges.
+    /// \param dest         Refers to the beginning of the destination range
+    ///                     the number of elements in each of the bins is
+    ///                     written to.
+    ///
+    /// The counting in the parallel \a histogram algorithm invoked with an
+    /// execution policy object of type \a sequenced_policy execute in
+    /// sequential order in the calling thread.
+    ///
+    /// The counting in the parallel \a histogram algorithm invoked with an
+    /// execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a histogram algorithm returns a \a hpx::future<OutIter>
+    ///           if the execution policy is of type \a sequenced_task_policy
+    ///           or \a parallel_task_policy and returns \a OutIter otherwise.
+    ///           The \a histogram algorithm returns the output iterator to
+    ///           the element in the destination range, one past the count
+    ///           of the last bin.
+    ///
+    template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+        typename OutIter>
+    typename util::detail::algorithm_result<ExPolicy, OutIter>::type
+    histogram(ExPolicy&& policy, FwdIter1 first, FwdIter1 last,
+        FwdIter2 edges_first, FwdIter2 edges_last, OutIter dest);
+
+    // clang-format on
+}}    // namespace hpx::experimental
+
+#else    // DOXYGEN
+
+#include <hpx/config.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/modules/futures.hpp>
+
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/histogram.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+    ///////////////////////////////////////////////////////////////////////////
+    // histogram
+    namespace detail {
+        /// \cond NOINTERNAL
+        struct histogram
+          : public detail::algorithm<histogram, std::vector<std::size_t>>
+        {
+            histogram()
+              : histogram::algorithm("histogram")
+            {
+            }
+
+            template <typename ExPolicy, typename FwdIter, typename Bins>
+            static std::vector<std::size_t> sequential(
+                ExPolicy&&, FwdIter first, FwdIter last, Bins const& bins)
+            {
+                return histogram_sequential(
+                    first, detail::distance(first, last), bins);
+            }
+
+            template <typename ExPolicy, typename FwdIter, typename Bins>
+            static typename util::detail::algorithm_result<ExPolicy,
+                std::vector<std::size_t>>::type
+            parallel(
+                ExPolicy&& policy, FwdIter first, FwdIter last, Bins bins)
+            {
+                using result = util::detail::algorithm_result<ExPolicy,
+                    std::vector<std::size_t>>;
+                using policy_type = typename std::decay<ExPolicy>::type;
+
+                if (first == last)
+                {
+                    return result::get(std::vector<std::size_t>(bins.size()));
+                }
+
+                try
+                {
+                    return result::get(execution::async_execute(
+                        policy.executor(),
+                        [first, last, bins](policy_type policy) {
+                            return histogram_n(policy, first,
+                                detail::distance(first, last), bins);
+                        },
+                        policy_type(std::forward<ExPolicy>(policy))));
+                }
+                catch (...)
+                {
+                    return result::get(detail::handle_exception<ExPolicy,
+                        std::vector<std::size_t>>::call(
+                        std::current_exception()));
+                }
+            }
+        };
+
+        // Write the counts to dest
+        template <typename OutIter>
+        OutIter histogram_copy(std::vector<std::size_t>&& counts, OutIter dest)
+        {
+            return std::copy(counts.begin(), counts.end(), dest);
+        }
+
+        template <typename OutIter>
+        hpx::future<OutIter> histogram_copy(
+            hpx::future<std::vector<std::size_t>>&& counts, OutIter dest)
+        {
+            return counts.then(
+                [dest](hpx::future<std::vector<std::size_t>>&& f) -> OutIter {
+                    std::vector<std::size_t> counts = f.get();
+                    return std::copy(counts.begin(), counts.end(), dest);
+                });
+        }
+
+        template <typename ExPolicy, typename FwdIter, typename Bins,
+            typename OutIter>
+        typename util::detail::algorithm_result<ExPolicy, OutIter>::type
+        histogram_(ExPolicy&& policy, FwdIter first, FwdIter last,
+            Bins const& bins, OutIter dest, std::false_type)
+        {
+            using is_seq = hpx::is_sequenced_execution_policy<ExPolicy>;
+
+            return histogram_copy(
+                histogram().call(std::forward<ExPolicy>(policy), is_seq(),
+                    first, last, bins),
+                dest);
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename FwdIter, typename Bins,
+            typename OutIter>
+        typename util::detail::algorithm_result<ExPolicy, OutIter>::type
+        histogram_(ExPolicy&& policy, FwdIter first, FwdIter last,
+            Bins const& bins, OutIter dest, std::true_type);
+        /// \endcond
+    }    // namespace detail
+}}}      // namespace hpx::parallel::v1
+
+namespace hpx { namespace experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for hpx::experimental::histogram
+    HPX_INLINE_CONSTEXPR_VARIABLE struct histogram_t final
+      : hpx::functional::tag<histogram_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter, typename Size,
+            typename T, typename OutIter,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy<ExPolicy>::value &&
+                hpx::traits::is_iterator<FwdIter>::value &&
+                std::is_integral<Size>::value &&
+                hpx::traits::is_iterator<OutIter>::value
+            )>
+        // clang-format on
+        friend typename hpx::parallel::util::detail::algorithm_result<ExPolicy,
+            OutIter>::type
+        tag_invoke(histogram_t, ExPolicy&& policy, FwdIter first, FwdIter last,
+            Size num_bins, T lower, T upper, OutIter dest)
+        {
+            static_assert((hpx::traits::is_forward_iterator<FwdIter>::value),
+                "Requires at least forward iterator.");
+
+            using is_segmented = hpx::traits::is_segmented_iterator<FwdIter>;
+
+            return hpx::parallel::v1::detail::histogram_(
+                std::forward<ExPolicy>(policy), first, last,
+                hpx::parallel::v1::detail::histogram_uniform_bins<T>(
+                    num_bins, lower, upper),
+                dest, is_segmented());
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+            typename OutIter,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy<ExPolicy>::value &&
+                hpx::traits::is_iterator<FwdIter1>::value &&
+                hpx::traits::is_iterator<FwdIter2>::value &&
+                hpx::traits::is_iterator<OutIter>::value
+            )>
+        // clang-format on
+        friend typename hpx::parallel::util::detail::algorithm_result<ExPolicy,
+            OutIter>::type
+        tag_invoke(histogram_t, ExPolicy&& policy, FwdIter1 first,
+            FwdIter1 last, FwdIter2 edges_first, FwdIter2 edges_last,
+            OutIter dest)
+        {
+            static_assert((hpx::traits::is_forward_iterator<FwdIter1>::value),
+                "Requires at least forward iterator.");
+            static_assert((hpx::traits::is_forward_iterator<FwdIter2>::value),
+                "Requires at least forward iterator.");
+
+            using is_segmented = hpx::traits::is_segmented_iterator<FwdIter1>;
+            using edge_type =
+                typename std::iterator_traits<FwdIter2>::value_type;
+
+            return hpx::parallel::v1::detail::histogram_(
+                std::forward<ExPolicy>(policy), first, last,
+                hpx::parallel::v1::detail::histogram_edge_bins<edge_type>(
+                    edges_first, edges_last),
+                dest, is_segmented());
+        }
+
+        // clang-format off
+        template <typename FwdIter, typename Size, typename T,
+            typename OutIter,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_iterator<FwdIter>::value &&
+                std::is_integral<Size>::value &&
+                hpx::traits::is_iterator<OutIter>::value
+            )>
+        // clang-format on
+        friend OutIter tag_invoke(histogram_t, FwdIter first, FwdIter last,
+            Size num_bins, T lower, T upper, OutIter dest)
+        {
+            static_assert((hpx::traits::is_forward_iterator<FwdIter>::value),
+                "Requires at least forward iterator.");
+
+            return hpx::parallel::v1::detail::histogram_(hpx::execution::seq,
+                first, last,
+                hpx::parallel::v1::detail::histogram_uniform_bins<T>(
+                    num_bins, lower, upper),
+                dest, std::false_type());
+        }
+
+        // clang-format off
+        template <typename FwdIter1, typename FwdIter2, typename OutIter,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_iterator<FwdIter1>::value &&
+                hpx::traits::is_iterator<FwdIter2>::value &&
+                hpx::traits::is_iterator<OutIter>::value
+            )>
+        // clang-format on
+        friend OutIter tag_invoke(histogram_t, FwdIter1 first, FwdIter1 last,
+            FwdIter2 edges_first, FwdIter2 edges_last, OutIter dest)
+        {
+            static_assert((hpx::traits::is_forward_iterator<FwdIter1>::value),
+                "Requires at least forward iterator.");
+            static_assert((hpx::traits::is_forward_iterator<FwdIter2>::value),
+                "Requires at least forward iterator.");
+
+            using edge_type =
+                typename std::iterator_traits<FwdIter2>::value_type;
+
+            return hpx::parallel::v1::detail::histogram_(hpx::execution::seq,
+                first, last,
+                hpx::parallel::v1::detail::histogram_edge_bins<edge_type>(
+                    edges_first, edges_last),
+                dest, std::false_type());
+        }
+    } histogram{};
+}}    // namespace hpx::experimental
+
+#endif    // DOXYGEN
@@ -19,10 +19,11 @@
 #include <hpx/parallel/util/tagged_pair.hpp>
 
 #include <hpx/algorithms/traits/projected.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/tagspec.hpp>
-#include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
@@ -35,6 +36,10 @@
 #include <utility>
 #include <vector>
 
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/parallel/datapar/minmax.hpp>
+#endif
+
 namespace hpx { namespace parallel { inline namespace v1 {
     ///////////////////////////////////////////////////////////////////////////
     // min_element
@@ -42,8 +47,11 @@ namespace hpx { namespace parallel { inline namespace v1 {
         /// \cond NOINTERNAL
         template <typename ExPolicy, typename FwdIter, typename F,
             typename Proj>
-        FwdIter sequential_min_element(ExPolicy&&, FwdIter it,
-            std::size_t count, F const& f, Proj const& proj)
+        typename std::enable_if<
+            !hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+            FwdIter>::type
+        sequential_min_element(ExPolicy&&, FwdIter it, std::size_t count,
+            F const& f, Proj const& proj)
         {
             if (count == 0 || count == 1)
                 return it;
@@ -80,7 +88,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 typename std::iterator_traits<FwdIter>::value_type smallest =
                     *it;
-                util::loop_n<ExPolicy>(++it, count - 1,
+                util::loop_n<hpx::execution::sequenced_policy>(
+                    ++it, count - 1,
                     [&f, &smallest, &proj](FwdIter const& curr) -> void {
                         if (hpx::util::invoke(f,
                                 hpx::util::invoke(proj, **curr),
@@ -100,12 +109,11 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
             template <typename ExPolicy, typename FwdIter, typename F,
                 typename Proj>
-            static FwdIter sequential(
-                ExPolicy, FwdIter first, FwdIter last, F&& f, Proj&& proj)
+            static FwdIter sequential(ExPolicy policy, FwdIter first,
+                FwdIter last, F&& f, Proj&& proj)
             {
-                return std::min_element(first, last,
-                    util::compare_projected<F, Proj>(
-                        std::forward<F>(f), std::forward<Proj>(proj)));
+                return sequential_min_element(std::move(policy), first,
+                    detail::distance(first, last), f, proj);
             }
 
             template <typename ExPolicy, typename FwdIter, typename F,
@@ -257,8 +265,11 @@ namespace hpx { namespace parallel { inline namespace v1 {
         /// \cond NOINTERNAL
         template <typename ExPolicy, typename FwdIter, typename F,
             typename Proj>
-        FwdIter sequential_max_element(ExPolicy&&, FwdIter it,
-            std::size_t count, F const& f, Proj const& proj)
+        typename std::enable_if<
+            !hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+            FwdIter>::type
+        sequential_max_element(ExPolicy&&, FwdIter it, std::size_t count,
+            F const& f, Proj const& proj)
         {
             if (count == 0 || count == 1)
                 return it;
@@ -295,7 +306,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 typename std::iterator_traits<FwdIter>::value_type greatest =
                     *it;
-                util::loop_n<ExPolicy>(++it, count - 1,
+                util::loop_n<hpx::execution::sequenced_policy>(
+                    ++it, count - 1,
                     [&f, &greatest, &proj](FwdIter const& curr) -> void {
                         if (hpx::util::invoke(f,
                                 hpx::util::invoke(proj, *greatest),
@@ -315,12 +327,11 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
             template <typename ExPolicy, typename FwdIter, typename F,
                 typename Proj>
-            static FwdIter sequential(
-                ExPolicy, FwdIter first, FwdIter last, F&& f, Proj&& proj)
+            static FwdIter sequential(ExPolicy policy, FwdIter first,
+                FwdIter last, F&& f, Proj&& proj)
             {
-                return std::max_element(first, last,
-                    util::compare_projected<F, Proj>(
-                        std::forward<F>(f), std::forward<Proj>(proj)));
+                return sequential_max_element(std::move(policy), first,
+                    detail::distance(first, last), f, proj);
             }
 
             template <typename ExPolicy, typename FwdIter, typename F,
@@ -473,8 +484,11 @@ namespace hpx { namespace parallel { inline namespace v1 {
         /// \cond NOINTERNAL
         template <typename ExPolicy, typename FwdIter, typename F,
             typename Proj>
-        std::pair<FwdIter, FwdIter> sequential_minmax_element(ExPolicy&&,
-            FwdIter it, std::size_t count, F const& f, Proj const& proj)
+        typename std::enable_if<
+            !hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+            std::pair<FwdIter, FwdIter>>::type
+        sequential_minmax_element(ExPolicy&&, FwdIter it, std::size_t count,
+            F const& f, Proj const& proj)
         {
             std::pair<FwdIter, FwdIter> result(it, it);
 
@@ -519,7 +533,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 typename std::iterator_traits<PairIter>::value_type result =
                     *it;
-                util::loop_n<ExPolicy>(++it, count - 1,
+                util::loop_n<hpx::execution::sequenced_policy>(
+                    ++it, count - 1,
                     [&f, &result, &proj](PairIter const& curr) -> void {
                         if (hpx::util::invoke(f,
                                 hpx::util::invoke(proj, *curr->first),
@@ -546,12 +561,11 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
             template <typename ExPolicy, typename FwdIter, typename F,
                 typename Proj>
-            static std::pair<FwdIter, FwdIter> sequential(
-                ExPolicy, FwdIter first, FwdIter last, F&& f, Proj&& proj)
+            static std::pair<FwdIter, FwdIter> sequential(ExPolicy policy,
+                FwdIter first, FwdIter last, F&& f, Proj&& proj)
             {
-                return std::minmax_element(first, last,
-                    util::compare_projected<F, Proj>(
-                        std::forward<F>(f), std::forward<Proj>(proj)));
+                return sequential_minmax_element(std::move(policy), first,
+                    detail::distance(first, last), f, proj);
             }
 
             template <typename ExPolicy, typename FwdIter, typename F,
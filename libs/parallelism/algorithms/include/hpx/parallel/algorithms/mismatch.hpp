@@ -181,9 +181,11 @@ namespace hpx {
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/find.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
 #include <hpx/parallel/util/result_types.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
 
@@ -273,24 +275,22 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 }
 
                 typedef hpx::util::zip_iterator<Iter1, Iter2> zip_iterator;
-                typedef typename zip_iterator::reference reference;
 
                 util::cancellation_token<std::size_t> tok(count1);
 
                 auto f1 = [tok, f = std::forward<F>(f),
                               proj1 = std::forward<Proj1>(proj1),
-                              proj2 = std::forward<Proj2>(proj2)](
+                              proj2 = std::forward<Proj2>(proj2), policy](
                               zip_iterator it, std::size_t part_count,
                               std::size_t base_idx) mutable -> void {
-                    util::loop_idx_n(base_idx, it, part_count, tok,
-                        [&f, &proj1, &proj2, &tok](reference t, std::size_t i) {
-                            if (!hpx::util::invoke(f,
-                                    hpx::util::invoke(proj1, hpx::get<0>(t)),
-                                    hpx::util::invoke(proj2, hpx::get<1>(t))))
-                            {
-                                tok.cancel(i);
-                            }
-                        });
+                    sequential_find_if_not(policy, base_idx, it, part_count,
+                        tok,
+                        [&f, &proj1, &proj2](auto const& t) {
+                            return hpx::util::invoke(f,
+                                hpx::util::invoke(proj1, hpx::get<0>(t)),
+                                hpx::util::invoke(proj2, hpx::get<1>(t)));
+                        },
+                        util::projection_identity());
                 };
 
                 auto f2 = [=](std::vector<hpx::future<void>>&&) mutable
@@ -415,21 +415,19 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 typedef hpx::util::zip_iterator<FwdIter1, FwdIter2>
                     zip_iterator;
-                typedef typename zip_iterator::reference reference;
 
                 util::cancellation_token<std::size_t> tok(count);
 
-                auto f1 = [tok, f = std::forward<F>(f)](zip_iterator it,
-                              std::size_t part_count,
+                auto f1 = [tok, f = std::forward<F>(f), policy](
+                              zip_iterator it, std::size_t part_count,
                               std::size_t base_idx) mutable -> void {
-                    util::loop_idx_n(base_idx, it, part_count, tok,
-                        [&f, &tok](reference t, std::size_t i) {
-                            if (!hpx::util::invoke(
-                                    f, hpx::get<0>(t), hpx::get<1>(t)))
-                            {
-                                tok.cancel(i);
-                            }
-                        });
+                    sequential_find_if_not(policy, base_idx, it, part_count,
+                        tok,
+                        [&f](auto const& t) {
+                            return hpx::util::invoke(
+                                f, hpx::get<0>(t), hpx::get<1>(t));
+                        },
+                        util::projection_identity());
                 };
                 auto f2 = [=](std::vector<hpx::future<void>>&&) mutable
                     -> std::pair<FwdIter1, FwdIter2> {
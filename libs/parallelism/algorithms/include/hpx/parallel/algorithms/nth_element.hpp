@@ -0,0 +1,389 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/nth_element.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+namespace hpx {
+
+    /// nth_element is a partial sorting algorithm that rearranges elements in
+    /// [first, last) such that the element pointed at by nth is changed to
+    /// whatever element would occur in that position if [first, last) were
+    /// sorted and all of the elements before this new nth element are less
+    /// than or equal to the elements after the new nth element.
+    ///
+    /// \note   Complexity: Linear in std::distance(first, last) on average.
+    ///         O(N log(N)) in the worst case, where
+    ///         N = std::distance(first, last).
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RandIter    The type of the source begin, nth, and end
+    ///                     iterators used (deduced). This iterator type must
+    ///                     meet the requirements of a random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param nth          Refers to the element which will be placed at its
+    ///                     sorted position.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param comp         comp is a callable object which returns true if
+    ///                     the first argument is less than the second.
+    ///
+    /// The parallel version of the algorithm selects two pivots from a random
+    /// sample of the elements which enclose the position of \a nth with high
+    /// probability. The range is then narrowed down to the elements between
+    /// the pivots using the parallel \a partition algorithm, until it is
+    /// small enough to be handled sequentially. The parallel version requires
+    /// the elements to be copy constructible.
+    ///
+    /// The comparison operations in the parallel \a nth_element algorithm
+    /// invoked with an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The comparison operations in the parallel \a nth_element algorithm
+    /// invoked with an execution policy object of type \a parallel_policy
+    /// or \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a nth_element algorithm returns a
+    ///           \a hpx::future<void> if the execution policy is of
+    ///           type \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns void otherwise.
+    ///
+    template <typename ExPolicy, typename RandIter, typename Comp>
+    typename util::detail::algorithm_result<ExPolicy>::type nth_element(
+        ExPolicy&& policy, RandIter first, RandIter nth, RandIter last,
+        Comp&& comp = Comp());
+
+}    // namespace hpx
+
+#else
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+
+#include <hpx/algorithms/traits/projected.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/partial_sort.hpp>
+#include <hpx/parallel/algorithms/partition.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // nth_element
+    namespace detail {
+
+        /// \cond NOINTERNAL
+
+        // ranges shorter than this are handled sequentially
+        static constexpr std::size_t nth_element_limit_per_task = 65536;
+
+        // number of elements sampled for selecting the pivots
+        static constexpr std::size_t nth_element_num_samples = 1024;
+
+        // distance of the pivots from the expected position of nth in the
+        // sorted samples, roughly the standard deviation of that position
+        static constexpr std::size_t nth_element_pivot_distance = 32;
+
+        ///////////////////////////////////////////////////////////////////////
+        /// Rearranges the elements in [first, last) such that nth is placed
+        /// at its sorted position. In every step two pivots enclosing the
+        /// expected position of nth are selected from a random sample of
+        /// the range. The elements less than the lower pivot and the elements
+        /// greater than the upper pivot are moved to the front and to the
+        /// back of the range using the parallel partition algorithm. The
+        /// range is then narrowed down to the part containing nth. Once the
+        /// range is small enough, it is handled sequentially. Should the
+        /// pivots repeatedly fail to narrow down the range, the remaining
+        /// elements are sorted instead (introselect).
+        ///
+        /// \param policy : execution policy used for partitioning
+        /// \param first : iterator to the first element
+        /// \param nth : iterator to the element to place at its position
+        /// \param last : iterator to the element after the last
+        /// \param comp : object for to Comp elements
+        ///
+        template <typename ExPolicy, typename RandIter, typename Comp>
+        void nth_element_helper(ExPolicy& policy, RandIter first,
+            RandIter nth, RandIter last, Comp& comp)
+        {
+            using value_type =
+                typename std::iterator_traits<RandIter>::value_type;
+
+            if (nth == last)
+                return;
+
+            std::uint32_t level =
+                nbits64(static_cast<std::uint64_t>(last - first));
+
+            std::minstd_rand gen(static_cast<std::uint32_t>(last - first));
+            std::vector<value_type> samples;
+            samples.reserve(nth_element_num_samples);
+
+            while (true)
+            {
+                std::size_t const count = last - first;
+                if (count <= nth_element_limit_per_task)
+                {
+                    std::nth_element(first, nth, last, comp);
+                    return;
+                }
+
+                if (level-- == 0)
+                {
+                    parallel_sort_async(
+                        ExPolicy(policy), first, last, Comp(comp))
+                        .get();
+                    return;
+                }
+
+                // select the pivots from a random sample of the range
+                std::uniform_int_distribution<std::size_t> dist(0, count - 1);
+
+                samples.clear();
+                for (std::size_t i = 0; i != nth_element_num_samples; ++i)
+                {
+                    samples.push_back(first[dist(gen)]);
+                }
+                std::sort(samples.begin(), samples.end(), comp);
+
+                std::size_t const pos =
+                    static_cast<std::size_t>(static_cast<double>(nth - first) /
+                        count * nth_element_num_samples);
+
+                bool const has_lower = pos >= nth_element_pivot_distance;
+                bool const has_upper = pos + nth_element_pivot_distance <
+                    nth_element_num_samples;
+
+                value_type const& lower =
+                    samples[has_lower ? pos - nth_element_pivot_distance : 0];
+                value_type const& upper = samples[has_upper ?
+                        pos + nth_element_pivot_distance :
+                        nth_element_num_samples - 1];
+
+                // move the elements less than the lower pivot to the front
+                RandIter middle1 = first;
+                if (has_lower)
+                {
+                    middle1 = partition_helper::call(
+                        policy, first, last,
+                        [&](value_type const& value) {
+                            return HPX_INVOKE(comp, value, lower);
+                        },
+                        util::projection_identity());
+
+                    if (nth < middle1)
+                    {
+                        last = middle1;
+                        continue;
+                    }
+                }
+
+                // move the elements greater than the upper pivot to the back
+                RandIter middle2 = last;
+                if (has_upper)
+                {
+                    middle2 = partition_helper::call(
+                        policy, middle1, last,
+                        [&](value_type const& value) {
+                            return !HPX_INVOKE(comp, upper, value);
+                        },
+                        util::projection_identity());
+
+                    if (nth >= middle2)
+                    {
+                        first = middle2;
+                        continue;
+                    }
+                }
+
+                // all remaining elements are equal to the pivots
+                if (has_lower && has_upper && !HPX_INVOKE(comp, lower, upper))
+                {
+                    return;
+                }
+
+                first = middle1;
+                last = middle2;
+            }
+        }
+
+        template <typename ExPolicy, typename RandIter, typename Comp>
+        hpx::future<RandIter> parallel_nth_element(ExPolicy&& policy,
+            RandIter first, RandIter nth, RandIter last, Comp&& comp)
+        {
+            if (static_cast<std::size_t>(last - first) <=
+                nth_element_limit_per_task)
+            {
+                std::nth_element(first, nth, last, comp);
+                return hpx::make_ready_future(last);
+            }
+
+            return execution::async_execute(policy.executor(),
+                [=, comp = std::forward<Comp>(comp)]() mutable -> RandIter {
+                    try
+                    {
+                        nth_element_helper(policy, first, nth, last, comp);
+                        return last;
+                    }
+                    catch (...)
+                    {
+                        util::detail::handle_local_exceptions<ExPolicy>::call(
+                            std::current_exception());
+                    }
+
+                    // Not reachable.
+                    HPX_ASSERT(false);
+                    return last;
+                });
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename RandIter>
+        struct nth_element
+          : public detail::algorithm<nth_element<RandIter>, RandIter>
+        {
+            nth_element()
+              : nth_element::algorithm("nth_element")
+            {
+            }
+
+            template <typename ExPolicy, typename Comp, typename Proj>
+            static RandIter sequential(ExPolicy, RandIter first, RandIter nth,
+                RandIter last, Comp&& comp, Proj&& proj)
+            {
+                std::nth_element(first, nth, last,
+                    util::compare_projected<Comp, Proj>(
+                        std::forward<Comp>(comp), std::forward<Proj>(proj)));
+                return last;
+            }
+
+            template <typename ExPolicy, typename Comp, typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                RandIter>::type
+            parallel(ExPolicy&& policy, RandIter first, RandIter nth,
+                RandIter last, Comp&& comp, Proj&& proj)
+            {
+                using algorithm_result =
+                    util::detail::algorithm_result<ExPolicy, RandIter>;
+
+                try
+                {
+                    return algorithm_result::get(parallel_nth_element(
+                        std::forward<ExPolicy>(policy), first, nth, last,
+                        util::compare_projected<Comp, Proj>(
+                            std::forward<Comp>(comp),
+                            std::forward<Proj>(proj))));
+                }
+                catch (...)
+                {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, RandIter>::call(
+                            std::current_exception()));
+                }
+            }
+        };
+        /// \endcond
+    }    // namespace detail
+}}}      // namespace hpx::parallel::v1
+
+namespace hpx {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for hpx::nth_element
+    HPX_INLINE_CONSTEXPR_VARIABLE struct nth_element_t final
+      : hpx::functional::tag<nth_element_t>
+    {
+    private:
+        // clang-format off
+        template <typename RandIter,
+            typename Comp = hpx::parallel::v1::detail::less,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_iterator<RandIter>::value &&
+                hpx::is_invocable_v<Comp,
+                    typename std::iterator_traits<RandIter>::value_type,
+                    typename std::iterator_traits<RandIter>::value_type
+                >
+            )>
+        // clang-format on
+        friend void tag_invoke(hpx::nth_element_t, RandIter first,
+            RandIter nth, RandIter last, Comp&& comp = Comp())
+        {
+            static_assert(
+                hpx::traits::is_random_access_iterator<RandIter>::value,
+                "Requires at least random access iterator.");
+
+            parallel::v1::detail::nth_element<RandIter>().call(
+                hpx::execution::seq, std::true_type(), first, nth, last,
+                std::forward<Comp>(comp),
+                parallel::util::projection_identity());
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename RandIter,
+            typename Comp = hpx::parallel::v1::detail::less,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy<ExPolicy>::value &&
+                hpx::traits::is_iterator<RandIter>::value &&
+                hpx::is_invocable_v<Comp,
+                    typename std::iterator_traits<RandIter>::value_type,
+                    typename std::iterator_traits<RandIter>::value_type
+                >
+            )>
+        // clang-format on
+        friend typename parallel::util::detail::algorithm_result<ExPolicy>::type
+        tag_invoke(hpx::nth_element_t, ExPolicy&& policy, RandIter first,
+            RandIter nth, RandIter last, Comp&& comp = Comp())
+        {
+            static_assert(
+                hpx::traits::is_random_access_iterator<RandIter>::value,
+                "Requires at least random access iterator.");
+
+            using is_seq = hpx::is_sequenced_execution_policy<ExPolicy>;
+
+            return parallel::util::detail::algorithm_result<ExPolicy>::get(
+                parallel::v1::detail::nth_element<RandIter>().call(
+                    std::forward<ExPolicy>(policy), is_seq(), first, nth, last,
+                    std::forward<Comp>(comp),
+                    parallel::util::projection_identity()));
+        }
+    } nth_element{};
+}    // namespace hpx
+
+#endif    // DOXYGEN
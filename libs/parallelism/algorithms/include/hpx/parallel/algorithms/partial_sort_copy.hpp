@@ -0,0 +1,443 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/partial_sort_copy.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+namespace hpx {
+
+    /// Sorts some of the elements in the range [first, last) in ascending
+    /// order, storing the result in the range [d_first, d_last). At most
+    /// d_last - d_first of the elements are placed sorted to the range
+    /// [d_first, d_first + n) where n is the number of elements to sort
+    /// (n = min(last - first, d_last - d_first)). The order of equal elements
+    /// is not guaranteed to be preserved.
+    ///
+    /// \note   Complexity: Approximately (last - first) * log(min(last -
+    ///         first, d_last - d_first)) applications of the comparison
+    ///         function.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam FwdIter     The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam RandIter    The type of the destination iterators used
+    ///                     (deduced). This iterator type must meet the
+    ///                     requirements of a random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param d_first      Refers to the beginning of the destination range.
+    /// \param d_last       Refers to the end of the destination range.
+    /// \param comp         comp is a callable object which returns true if
+    ///                     the first argument is less than the second.
+    ///
+    /// The parallel version of the algorithm splits the source range into
+    /// chunks. The smallest d_last - d_first elements of each chunk are
+    /// selected concurrently, the final elements are selected from those
+    /// candidates using the parallel \a nth_element algorithm and sorted
+    /// using the parallel \a sort algorithm. The parallel version requires
+    /// the destination value type to be default constructible.
+    ///
+    /// The comparison operations in the parallel \a partial_sort_copy
+    /// algorithm invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the calling thread.
+    ///
+    /// The comparison operations in the parallel \a partial_sort_copy
+    /// algorithm invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are permitted to execute
+    /// in an unordered fashion in unspecified threads, and indeterminately
+    /// sequenced within each thread.
+    ///
+    /// \returns  The \a partial_sort_copy algorithm returns a
+    ///           \a hpx::future<RandIter> if the execution policy is of
+    ///           type \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a RandIter otherwise.
+    ///           The iterator returned refers to the element past the last
+    ///           element written, i.e. d_first + n.
+    ///
+    template <typename ExPolicy, typename FwdIter, typename RandIter,
+        typename Comp>
+    typename util::detail::algorithm_result<ExPolicy, RandIter>::type
+    partial_sort_copy(ExPolicy&& policy, FwdIter first, FwdIter last,
+        RandIter d_first, RandIter d_last, Comp&& comp = Comp());
+
+}    // namespace hpx
+
+#else
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/iterator_support/counting_iterator.hpp>
+#include <hpx/iterator_support/iterator_range.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/modules/async_combinators.hpp>
+
+#include <hpx/algorithms/traits/projected.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_information.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/nth_element.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // partial_sort_copy
+    namespace detail {
+
+        /// \cond NOINTERNAL
+
+        // minimal number of source elements handled by one task
+        static constexpr std::size_t partial_sort_copy_limit_per_task = 65536;
+
+        ///////////////////////////////////////////////////////////////////////
+        /// Copies the smallest elements of [first, last) sorted to the range
+        /// [d_first, d_last). The destination range is used as a max-heap
+        /// holding the smallest elements seen so far.
+        ///
+        /// \param first : iterator to the first source element
+        /// \param last : sentinel of the source range
+        /// \param d_first : iterator to the first destination element
+        /// \param d_last : iterator to the element after the last destination
+        ///                 element
+        /// \param comp : object for to Comp elements
+        /// \param proj1 : projection applied to the source elements
+        /// \param proj2 : projection applied to the destination elements
+        ///
+        /// \return the end of the source range and the iterator to the
+        ///         element after the last element written
+        ///
+        template <typename InIter, typename Sent, typename RandIter,
+            typename Comp, typename Proj1, typename Proj2>
+        util::in_out_result<InIter, RandIter> sequential_partial_sort_copy(
+            InIter first, Sent last, RandIter d_first, RandIter d_last,
+            Comp& comp, Proj1& proj1, Proj2& proj2)
+        {
+            if (d_first == d_last)
+            {
+                return {detail::advance_to_sentinel(first, last), d_first};
+            }
+
+            util::compare_projected<Comp&, Proj2&> comp2(comp, proj2);
+
+            RandIter it = d_first;
+            for (/**/; first != last && it != d_last; ++first, ++it)
+            {
+                *it = *first;
+            }
+
+            if (first == last)
+            {
+                std::sort(d_first, it, comp2);
+                return {first, it};
+            }
+
+            std::make_heap(d_first, it, comp2);
+            for (/**/; first != last; ++first)
+            {
+                if (HPX_INVOKE(comp, HPX_INVOKE(proj1, *first),
+                        HPX_INVOKE(proj2, *d_first)))
+                {
+                    std::pop_heap(d_first, it, comp2);
+                    *(it - 1) = *first;
+                    std::push_heap(d_first, it, comp2);
+                }
+            }
+            std::sort_heap(d_first, it, comp2);
+            return {first, it};
+        }
+
+        template <typename ExPolicy, typename F>
+        void partial_sort_copy_for_each(
+            ExPolicy& policy, std::size_t count, F&& f)
+        {
+            auto shape = hpx::util::make_iterator_range(
+                hpx::util::make_counting_iterator(std::size_t(0)),
+                hpx::util::make_counting_iterator(count));
+
+            auto futures = execution::bulk_async_execute(
+                policy.executor(), std::forward<F>(f), shape);
+
+            hpx::wait_all(futures);
+            for (auto& f : futures)
+            {
+                f.get();    // rethrow exceptions
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// The source range is split into one chunk per core. If the
+        /// destination range can hold all source elements, the chunks are
+        /// copied concurrently and sorted in place. Otherwise the smallest
+        /// d_last - d_first elements of each chunk are selected concurrently
+        /// into a buffer of candidates, from which the overall smallest
+        /// elements are selected using nth_element. Those are sorted and
+        /// moved to the destination range.
+        template <typename ExPolicy, typename FwdIter, typename RandIter,
+            typename Comp, typename Proj1, typename Proj2>
+        util::in_out_result<FwdIter, RandIter> partial_sort_copy_helper(
+            ExPolicy& policy, FwdIter first,
+            FwdIter last, RandIter d_first, RandIter d_last, Comp& comp,
+            Proj1& proj1, Proj2& proj2)
+        {
+            using value_type =
+                typename std::iterator_traits<RandIter>::value_type;
+
+            std::size_t const count = std::distance(first, last);
+            std::size_t const d_count = d_last - d_first;
+
+            std::size_t const cores = execution::processing_units_count(
+                policy.parameters(), policy.executor());
+            std::size_t const num_chunks = (std::min)(
+                cores, count / partial_sort_copy_limit_per_task);
+
+            if (d_count == 0 || num_chunks <= 1)
+            {
+                return sequential_partial_sort_copy(
+                    first, last, d_first, d_last, comp, proj1, proj2);
+            }
+
+            std::size_t const chunk_size =
+                (count + num_chunks - 1) / num_chunks;
+
+            std::vector<FwdIter> chunks;
+            chunks.reserve(num_chunks + 1);
+            chunks.push_back(first);
+            for (std::size_t i = 1; i != num_chunks; ++i)
+            {
+                chunks.push_back(std::next(chunks.back(), chunk_size));
+            }
+            chunks.push_back(last);
+
+            using compare_type = util::compare_projected<Comp&, Proj2&>;
+            compare_type comp2(comp, proj2);
+
+            if (count <= d_count)
+            {
+                partial_sort_copy_for_each(
+                    policy, num_chunks, [&](std::size_t chunk) {
+                        std::copy(chunks[chunk], chunks[chunk + 1],
+                            d_first + chunk * chunk_size);
+                    });
+
+                RandIter d_end = d_first + count;
+                parallel_sort_async(
+                    ExPolicy(policy), d_first, d_end, compare_type(comp2))
+                    .get();
+                return {last, d_end};
+            }
+
+            // every chunk contributes its smallest d_count elements
+            std::vector<std::size_t> offsets(num_chunks + 1, 0);
+            for (std::size_t i = 0; i != num_chunks; ++i)
+            {
+                std::size_t const size = (std::min)(chunk_size,
+                    count - (std::min)(count, i * chunk_size));
+                offsets[i + 1] = offsets[i] + (std::min)(d_count, size);
+            }
+
+            std::vector<value_type> candidates(offsets.back());
+            partial_sort_copy_for_each(
+                policy, num_chunks, [&](std::size_t chunk) {
+                    sequential_partial_sort_copy(chunks[chunk],
+                        chunks[chunk + 1], candidates.begin() + offsets[chunk],
+                        candidates.begin() + offsets[chunk + 1], comp, proj1,
+                        proj2);
+                });
+
+            auto const middle = candidates.begin() + d_count;
+            nth_element_helper(
+                policy, candidates.begin(), middle, candidates.end(), comp2);
+            parallel_sort_async(ExPolicy(policy), candidates.begin(), middle,
+                compare_type(comp2))
+                .get();
+
+            return {last, std::move(candidates.begin(), middle, d_first)};
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename IterPair>
+        struct partial_sort_copy
+          : public detail::algorithm<partial_sort_copy<IterPair>, IterPair>
+        {
+            partial_sort_copy()
+              : partial_sort_copy::algorithm("partial_sort_copy")
+            {
+            }
+
+            template <typename ExPolicy, typename InIter, typename Sent,
+                typename RandIter, typename Comp, typename Proj1,
+                typename Proj2>
+            static IterPair sequential(ExPolicy, InIter first, Sent last,
+                RandIter d_first, RandIter d_last, Comp&& comp, Proj1&& proj1,
+                Proj2&& proj2)
+            {
+                return sequential_partial_sort_copy(
+                    first, last, d_first, d_last, comp, proj1, proj2);
+            }
+
+            template <typename ExPolicy, typename FwdIter, typename Sent,
+                typename RandIter, typename Comp, typename Proj1,
+                typename Proj2>
+            static typename util::detail::algorithm_result<ExPolicy,
+                IterPair>::type
+            parallel(ExPolicy&& policy, FwdIter first, Sent last,
+                RandIter d_first, RandIter d_last, Comp&& comp, Proj1&& proj1,
+                Proj2&& proj2)
+            {
+                using algorithm_result =
+                    util::detail::algorithm_result<ExPolicy, IterPair>;
+
+                try
+                {
+                    FwdIter last_iter =
+                        detail::advance_to_sentinel(first, last);
+
+                    return algorithm_result::get(
+                        execution::async_execute(policy.executor(),
+                            [=, comp = std::forward<Comp>(comp),
+                                proj1 = std::forward<Proj1>(proj1),
+                                proj2 = std::forward<Proj2>(
+                                    proj2)]() mutable -> IterPair {
+                                try
+                                {
+                                    return partial_sort_copy_helper(policy,
+                                        first, last_iter, d_first, d_last,
+                                        comp, proj1, proj2);
+                                }
+                                catch (...)
+                                {
+                                    util::detail::handle_local_exceptions<
+                                        ExPolicy>::call(
+                                        std::current_exception());
+                                }
+
+                                // Not reachable.
+                                HPX_ASSERT(false);
+                                return IterPair{last_iter, d_first};
+                            }));
+                }
+                catch (...)
+                {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, IterPair>::call(
+                            std::current_exception()));
+                }
+            }
+        };
+        /// \endcond
+    }    // namespace detail
+}}}      // namespace hpx::parallel::v1
+
+namespace hpx {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for hpx::partial_sort_copy
+    HPX_INLINE_CONSTEXPR_VARIABLE struct partial_sort_copy_t final
+      : hpx::functional::tag<partial_sort_copy_t>
+    {
+    private:
+        // clang-format off
+        template <typename InIter, typename RandIter,
+            typename Comp = hpx::parallel::v1::detail::less,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_iterator<InIter>::value &&
+                hpx::traits::is_iterator<RandIter>::value &&
+                hpx::is_invocable_v<Comp,
+                    typename std::iterator_traits<InIter>::value_type,
+                    typename std::iterator_traits<RandIter>::value_type
+                >
+            )>
+        // clang-format on
+        friend RandIter tag_invoke(hpx::partial_sort_copy_t, InIter first,
+            InIter last, RandIter d_first, RandIter d_last,
+            Comp&& comp = Comp())
+        {
+            static_assert(hpx::traits::is_input_iterator<InIter>::value,
+                "Requires at least input iterator.");
+            static_assert(
+                hpx::traits::is_random_access_iterator<RandIter>::value,
+                "Requires at least random access iterator.");
+
+            return parallel::util::get_second_element(
+                parallel::v1::detail::partial_sort_copy<
+                    parallel::util::in_out_result<InIter, RandIter>>()
+                    .call(hpx::execution::seq, std::true_type(), first, last,
+                        d_first, d_last, std::forward<Comp>(comp),
+                        parallel::util::projection_identity(),
+                        parallel::util::projection_identity()));
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter, typename RandIter,
+            typename Comp = hpx::parallel::v1::detail::less,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy<ExPolicy>::value &&
+                hpx::traits::is_iterator<FwdIter>::value &&
+                hpx::traits::is_iterator<RandIter>::value &&
+                hpx::is_invocable_v<Comp,
+                    typename std::iterator_traits<FwdIter>::value_type,
+                    typename std::iterator_traits<RandIter>::value_type
+                >
+            )>
+        // clang-format on
+        friend typename parallel::util::detail::algorithm_result<ExPolicy,
+            RandIter>::type
+        tag_invoke(hpx::partial_sort_copy_t, ExPolicy&& policy, FwdIter first,
+            FwdIter last, RandIter d_first, RandIter d_last,
+            Comp&& comp = Comp())
+        {
+            static_assert(hpx::traits::is_forward_iterator<FwdIter>::value,
+                "Requires at least forward iterator.");
+            static_assert(
+                hpx::traits::is_random_access_iterator<RandIter>::value,
+                "Requires at least random access iterator.");
+
+            using is_seq = hpx::is_sequenced_execution_policy<ExPolicy>;
+
+            return parallel::util::get_second_element(
+                parallel::v1::detail::partial_sort_copy<
+                    parallel::util::in_out_result<FwdIter, RandIter>>()
+                    .call(std::forward<ExPolicy>(policy), is_seq(), first,
+                        last, d_first, d_last, std::forward<Comp>(comp),
+                        parallel::util::projection_identity(),
+                        parallel::util::projection_identity()));
+        }
+    } partial_sort_copy{};
+}    // namespace hpx
+
+#endif    // DOXYGEN
@@ -315,16 +315,16 @@ namespace hpx { namespace parallel { inline namespace v1 {
         BidirIter sequential_partition(
             BidirIter first, BidirIter last, Pred&& pred, Proj&& proj)
         {
-            using hpx::util::invoke;
-
             while (true)
             {
-                while (first != last && invoke(pred, invoke(proj, *first)))
+                while (
+                    first != last && HPX_INVOKE(pred, HPX_INVOKE(proj, *first)))
                     ++first;
                 if (first == last)
                     break;
 
-                while (first != --last && !invoke(pred, invoke(proj, *last)))
+                while (first != --last &&
+                    !HPX_INVOKE(pred, HPX_INVOKE(proj, *last)))
                     ;
                 if (first == last)
                     break;
@@ -343,9 +343,7 @@ namespace hpx { namespace parallel { inline namespace v1 {
         FwdIter sequential_partition(
             FwdIter first, FwdIter last, Pred&& pred, Proj&& proj)
         {
-            using hpx::util::invoke;
-
-            while (first != last && invoke(pred, invoke(proj, *first)))
+            while (first != last && HPX_INVOKE(pred, HPX_INVOKE(proj, *first)))
                 ++first;
 
             if (first == last)
@@ -353,7 +351,7 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
             for (FwdIter it = std::next(first); it != last; ++it)
             {
-                if (invoke(pred, invoke(proj, *it)))
+                if (HPX_INVOKE(pred, HPX_INVOKE(proj, *it)))
                     std::iter_swap(first++, it);
             }
 
@@ -590,8 +588,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
             static block<FwdIter> partition_thread(
                 block_manager<FwdIter>& block_manager, Pred pred, Proj proj)
             {
-                using hpx::util::invoke;
-
                 block<FwdIter> left_block, right_block;
 
                 left_block = block_manager.get_left_block();
@@ -602,7 +598,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
                     while ((!left_block.empty() ||
                                !(left_block = block_manager.get_left_block())
                                     .empty()) &&
-                        invoke(pred, invoke(proj, *left_block.first)))
+                        HPX_INVOKE(
+                            pred, HPX_INVOKE(proj, *left_block.first)))
                     {
                         ++left_block.first;
                     }
@@ -610,7 +607,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
                     while ((!right_block.empty() ||
                                !(right_block = block_manager.get_right_block())
                                     .empty()) &&
-                        !invoke(pred, invoke(proj, *right_block.first)))
+                        !HPX_INVOKE(
+                            pred, HPX_INVOKE(proj, *right_block.first)))
                     {
                         ++right_block.first;
                     }
@@ -643,8 +641,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 while (true)
                 {
-                    using hpx::util::invoke;
-
                     while (true)
                     {
                         if (left_iter->empty())
@@ -654,7 +650,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
                                 left_iter->block_no > 0)
                                 break;
                         }
-                        if (!invoke(pred, invoke(proj, *left_iter->first)))
+                        if (!HPX_INVOKE(
+                                pred, HPX_INVOKE(proj, *left_iter->first)))
                             break;
                         ++left_iter->first;
                     }
@@ -667,7 +664,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
                                 (--right_iter)->block_no < 0)
                                 break;
                         }
-                        if (invoke(pred, invoke(proj, *right_iter->first)))
+                        if (HPX_INVOKE(
+                                pred, HPX_INVOKE(proj, *right_iter->first)))
                             break;
                         ++right_iter->first;
                     }
@@ -1164,8 +1162,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
                     // MSVC complains if pred or proj is captured by ref below
                     util::loop_n<ExPolicy>(part_begin, part_size,
                         [pred, proj, &true_count](zip_iterator it) mutable {
-                            using hpx::util::invoke;
-                            bool f = invoke(pred, invoke(proj, get<0>(*it)));
+                            bool f =
+                                HPX_INVOKE(pred, HPX_INVOKE(proj, get<0>(*it)));
 
                             if ((get<1>(*it) = f))
                                 ++true_count;
@@ -220,8 +220,8 @@ namespace hpx {
 #include <hpx/iterator_support/traits/is_sentinel_for.hpp>
 #include <hpx/pack_traversal/unwrap.hpp>
 
+#include <hpx/execution/traits/is_execution_policy.hpp>
 #include <hpx/executors/execution_policy.hpp>
-#include <hpx/parallel/algorithms/detail/accumulate.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
@@ -236,11 +236,26 @@ namespace hpx {
 #include <utility>
 #include <vector>
 
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/parallel/datapar/reduce.hpp>
+#endif
+
 namespace hpx { namespace parallel { inline namespace v1 {
     ///////////////////////////////////////////////////////////////////////////
     // reduce
     namespace detail {
         /// \cond NOINTERNAL
+        template <typename ExPolicy, typename Iter, typename T,
+            typename Reduce>
+        inline typename std::enable_if<
+            !hpx::is_vectorpack_execution_policy<ExPolicy>::value, T>::type
+        sequential_reduce(
+            ExPolicy&&, Iter it, std::size_t count, T init, Reduce&& r)
+        {
+            return util::accumulate_n(
+                it, count, std::move(init), std::forward<Reduce>(r));
+        }
+
         template <typename T>
         struct reduce : public detail::algorithm<reduce<T>, T>
         {
@@ -251,10 +266,11 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
             template <typename ExPolicy, typename InIterB, typename InIterE,
                 typename T_, typename Reduce>
-            static T sequential(
-                ExPolicy, InIterB first, InIterE last, T_&& init, Reduce&& r)
+            static T sequential(ExPolicy policy, InIterB first, InIterE last,
+                T_&& init, Reduce&& r)
             {
-                return detail::accumulate(first, last, std::forward<T_>(init),
+                return sequential_reduce(std::move(policy), first,
+                    detail::distance(first, last), std::forward<T_>(init),
                     std::forward<Reduce>(r));
             }
 
@@ -270,10 +286,11 @@ namespace hpx { namespace parallel { inline namespace v1 {
                         std::forward<T_>(init));
                 }
 
-                auto f1 = [r](FwdIterB part_begin, std::size_t part_size) -> T {
+                auto f1 = [r, policy](
+                              FwdIterB part_begin, std::size_t part_size) -> T {
                     T val = *part_begin;
-                    return util::accumulate_n(
-                        ++part_begin, --part_size, std::move(val), r);
+                    return sequential_reduce(
+                        policy, ++part_begin, --part_size, std::move(val), r);
                 };
 
                 return util::partitioner<ExPolicy, T>::call(
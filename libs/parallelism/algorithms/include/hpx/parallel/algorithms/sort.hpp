@@ -25,6 +25,7 @@
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/is_sorted.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
@@ -258,13 +259,12 @@ namespace hpx { namespace parallel { inline namespace v1 {
             }
 
             template <typename ExPolicy, typename Comp, typename Proj>
-            static RandomIt sequential(ExPolicy, RandomIt first, RandomIt last,
-                Comp&& comp, Proj&& proj)
+            static RandomIt sequential(ExPolicy policy, RandomIt first,
+                RandomIt last, Comp&& comp, Proj&& proj)
             {
-                std::sort(first, last,
-                    util::compare_projected<Comp, Proj>(
-                        std::forward<Comp>(comp), std::forward<Proj>(proj)));
-                return last;
+                return sequential_sort(policy, first, last,
+                    std::forward<Comp>(comp), std::forward<Proj>(proj),
+                    use_radix_sort<RandomIt, Comp, Proj>());
             }
 
             template <typename ExPolicy, typename Comp, typename Proj>
@@ -280,11 +280,11 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 {
                     // call the sort routine and return the right type,
                     // depending on execution policy
-                    return algorithm_result::get(parallel_sort_async(
-                        std::forward<ExPolicy>(policy), first, last,
-                        util::compare_projected<Comp, Proj>(
-                            std::forward<Comp>(comp),
-                            std::forward<Proj>(proj))));
+                    return algorithm_result::get(
+                        parallel_sort(std::forward<ExPolicy>(policy), first,
+                            last, std::forward<Comp>(comp),
+                            std::forward<Proj>(proj),
+                            use_radix_sort<RandomIt, Comp, Proj>()));
                 }
                 catch (...)
                 {
@@ -293,6 +293,65 @@ namespace hpx { namespace parallel { inline namespace v1 {
                             std::current_exception()));
                 }
             }
+
+        private:
+            template <typename ExPolicy, typename Comp, typename Proj>
+            static RandomIt sequential_sort(ExPolicy&, RandomIt first,
+                RandomIt last, Comp&& comp, Proj&& proj, std::false_type)
+            {
+                std::sort(first, last,
+                    util::compare_projected<Comp, Proj>(
+                        std::forward<Comp>(comp), std::forward<Proj>(proj)));
+                return last;
+            }
+
+            // arithmetic values compared using operator<() or operator>()
+            // are sorted using a radix sort
+            template <typename ExPolicy, typename Comp, typename Proj>
+            static RandomIt sequential_sort(ExPolicy& policy, RandomIt first,
+                RandomIt last, Comp&& comp, Proj&& proj, std::true_type)
+            {
+                std::size_t const count = last - first;
+                if (count < radix_sort_min_size)
+                {
+                    return sequential_sort(policy, first, last,
+                        std::forward<Comp>(comp), std::forward<Proj>(proj),
+                        std::false_type());
+                }
+
+                radix_sort(policy, first, radix_sort_no_values(), count,
+                    is_radix_sort_descending<RandomIt, Comp>::value);
+                return last;
+            }
+
+            template <typename ExPolicy, typename Comp, typename Proj>
+            static hpx::future<RandomIt> parallel_sort(ExPolicy&& policy,
+                RandomIt first, RandomIt last, Comp&& comp, Proj&& proj,
+                std::false_type)
+            {
+                return parallel_sort_async(std::forward<ExPolicy>(policy),
+                    first, last,
+                    util::compare_projected<Comp, Proj>(
+                        std::forward<Comp>(comp), std::forward<Proj>(proj)));
+            }
+
+            template <typename ExPolicy, typename Comp, typename Proj>
+            static hpx::future<RandomIt> parallel_sort(ExPolicy&& policy,
+                RandomIt first, RandomIt last, Comp&& comp, Proj&& proj,
+                std::true_type)
+            {
+                std::size_t const count = last - first;
+                if (count < radix_sort_min_size)
+                {
+                    return parallel_sort(std::forward<ExPolicy>(policy), first,
+                        last, std::forward<Comp>(comp),
+                        std::forward<Proj>(proj), std::false_type());
+                }
+
+                return radix_sort_async(std::forward<ExPolicy>(policy), first,
+                    radix_sort_no_values(), count,
+                    is_radix_sort_descending<RandomIt, Comp>::value, last);
+            }
         };
         /// \endcond
     }    // namespace detail
@@ -305,6 +364,11 @@ namespace hpx { namespace parallel { inline namespace v1 {
     /// \note   Complexity: O(Nlog(N)), where N = std::distance(first, last)
     ///                     comparisons.
     ///
+    /// Sequences of integral or floating point values which are compared
+    /// using \a std::less or \a std::greater (without a projection) are
+    /// sorted using a parallel LSD radix sort instead, which performs
+    /// O(N) operations per byte of the values.
+    ///
     /// A sequence is sorted with respect to a comparator \a comp and a
     /// projection \a proj if for every iterator i pointing to the sequence and
     /// every non-negative integer n such that i + n is a valid iterator
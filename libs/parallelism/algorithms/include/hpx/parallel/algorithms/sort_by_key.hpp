@@ -11,11 +11,13 @@
 #include <hpx/datastructures/tuple.hpp>
 #include <hpx/parallel/util/tagged_pair.hpp>
 
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
 #include <hpx/parallel/algorithms/sort.hpp>
 #include <hpx/parallel/tagspec.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <iterator>
 #include <type_traits>
 #include <utility>
@@ -34,6 +36,67 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 return hpx::get<0>(std::forward<Tuple>(t));
             }
         };
+
+        template <typename ExPolicy, typename KeyIter, typename ValueIter,
+            typename Compare>
+        typename util::detail::algorithm_result<ExPolicy,
+            hpx::util::tagged_pair<tag::in1(KeyIter),
+                tag::in2(ValueIter)>>::type
+        sort_by_key(ExPolicy&& policy, KeyIter key_first, KeyIter key_last,
+            ValueIter value_first, Compare&& comp, std::false_type)
+        {
+            ValueIter value_last = value_first;
+            std::advance(value_last, std::distance(key_first, key_last));
+
+            return detail::get_iter_tagged_pair<tag::in1, tag::in2>(
+                hpx::parallel::sort(std::forward<ExPolicy>(policy),
+                    hpx::util::make_zip_iterator(key_first, value_first),
+                    hpx::util::make_zip_iterator(key_last, value_last),
+                    std::forward<Compare>(comp), detail::extract_key()));
+        }
+
+        // arithmetic keys compared using operator<() or operator>() are
+        // sorted using a radix sort, the values are moved alongside
+        template <typename ExPolicy, typename KeyIter, typename ValueIter,
+            typename Compare>
+        typename util::detail::algorithm_result<ExPolicy,
+            hpx::util::tagged_pair<tag::in1(KeyIter),
+                tag::in2(ValueIter)>>::type
+        sort_by_key(ExPolicy&& policy, KeyIter key_first, KeyIter key_last,
+            ValueIter value_first, Compare&& comp, std::true_type)
+        {
+            std::size_t const count = std::distance(key_first, key_last);
+            if (count < radix_sort_min_size)
+            {
+                return sort_by_key(std::forward<ExPolicy>(policy), key_first,
+                    key_last, value_first, std::forward<Compare>(comp),
+                    std::false_type());
+            }
+
+            ValueIter value_last = value_first;
+            std::advance(value_last, count);
+
+            using zip_iterator = hpx::util::zip_iterator<KeyIter, ValueIter>;
+            using algorithm_result =
+                util::detail::algorithm_result<ExPolicy, zip_iterator>;
+
+            try
+            {
+                return detail::get_iter_tagged_pair<tag::in1, tag::in2>(
+                    algorithm_result::get(radix_sort_async(
+                        std::forward<ExPolicy>(policy), key_first,
+                        value_first, count,
+                        is_radix_sort_descending<KeyIter, Compare>::value,
+                        hpx::util::make_zip_iterator(key_last, value_last))));
+            }
+            catch (...)
+            {
+                return detail::get_iter_tagged_pair<tag::in1, tag::in2>(
+                    algorithm_result::get(
+                        detail::handle_exception<ExPolicy, zip_iterator>::call(
+                            std::current_exception())));
+            }
+        }
         /// \endcond
     }    // namespace detail
 
@@ -50,6 +113,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
     /// \note   Complexity: O(Nlog(N)), where N = std::distance(first, last)
     ///                     comparisons.
     ///
+    /// Integral or floating point keys which are compared using
+    /// \a std::less or \a std::greater are sorted using a parallel LSD radix
+    /// sort instead, which performs O(N) operations per byte of the keys.
+    ///
     /// A sequence is sorted with respect to a comparator \a comp and a
     /// projection \a proj if for every iterator i pointing to the sequence and
     /// every non-negative integer n such that i + n is a valid iterator
@@ -130,14 +197,9 @@ namespace hpx { namespace parallel { inline namespace v1 {
             (hpx::traits::is_random_access_iterator<ValueIter>::value),
             "Requires a random access iterator.");
 
-        ValueIter value_last = value_first;
-        std::advance(value_last, std::distance(key_first, key_last));
-
-        return detail::get_iter_tagged_pair<tag::in1, tag::in2>(
-            hpx::parallel::sort(std::forward<ExPolicy>(policy),
-                hpx::util::make_zip_iterator(key_first, value_first),
-                hpx::util::make_zip_iterator(key_last, value_last),
-                std::forward<Compare>(comp), detail::extract_key()));
+        return detail::sort_by_key(std::forward<ExPolicy>(policy), key_first,
+            key_last, value_first, std::forward<Compare>(comp),
+            detail::use_radix_sort_by_key<KeyIter, ValueIter, Compare>());
 #endif
     }
 }}}    // namespace hpx::parallel::v1
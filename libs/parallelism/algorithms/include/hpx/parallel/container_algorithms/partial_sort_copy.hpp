@@ -0,0 +1,289 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/container_algorithms/partial_sort_copy.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+namespace hpx { namespace ranges {
+    // clang-format off
+
+    /// Sorts some of the elements in the range \a rng in ascending order,
+    /// storing the result in the range \a r_rng. At most
+    /// size(r_rng) of the elements are placed sorted to the range
+    /// [begin(r_rng), begin(r_rng) + n) where n is the number of elements to
+    /// sort (n = min(size(rng), size(r_rng))). The order of equal elements is
+    /// not guaranteed to be preserved.
+    ///
+    /// \note   Complexity: Approximately N * log(min(N, M)) applications of
+    ///         the comparison function, where N = size(rng) and
+    ///         M = size(r_rng).
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam Rng1        The type of the source range used (deduced).
+    ///                     The iterators extracted from this range type must
+    ///                     meet the requirements of a forward iterator.
+    /// \tparam Rng2        The type of the destination range used (deduced).
+    ///                     The iterators extracted from this range type must
+    ///                     meet the requirements of a random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    /// \tparam Proj1       The type of an optional projection function applied
+    ///                     to the source elements. This defaults to
+    ///                     \a util::projection_identity
+    /// \tparam Proj2       The type of an optional projection function applied
+    ///                     to the destination elements. This defaults to
+    ///                     \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param rng          Refers to the sequence of elements the algorithm
+    ///                     will be applied to.
+    /// \param r_rng        Refers to the destination range.
+    /// \param comp         comp is a callable object which returns true if
+    ///                     the first argument is less than the second.
+    /// \param proj1        Specifies the function (or function object) which
+    ///                     will be invoked for each of the source elements
+    ///                     as a projection operation before the actual
+    ///                     predicate \a comp is invoked.
+    /// \param proj2        Specifies the function (or function object) which
+    ///                     will be invoked for each of the destination
+    ///                     elements as a projection operation before the
+    ///                     actual predicate \a comp is invoked.
+    ///
+    /// The comparison operations in the parallel \a partial_sort_copy
+    /// algorithm invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the calling thread.
+    ///
+    /// The comparison operations in the parallel \a partial_sort_copy
+    /// algorithm invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are permitted to execute
+    /// in an unordered fashion in unspecified threads, and indeterminately
+    /// sequenced within each thread.
+    ///
+    /// \returns  The \a partial_sort_copy algorithm returns a
+    ///           \a hpx::future<partial_sort_copy_result<Iter1, Iter2>>
+    ///           if the execution policy is of type \a sequenced_task_policy
+    ///           or \a parallel_task_policy and returns
+    ///           \a partial_sort_copy_result<Iter1, Iter2> otherwise.
+    ///           The first iterator refers to the end of \a rng, the second
+    ///           refers to the element past the last element written.
+    ///
+    template <typename ExPolicy, typename Rng1, typename Rng2, typename Comp,
+        typename Proj1, typename Proj2>
+    typename util::detail::algorithm_result<ExPolicy,
+        partial_sort_copy_result<
+            typename hpx::traits::range_iterator<Rng1>::type,
+            typename hpx::traits::range_iterator<Rng2>::type>>::type
+    partial_sort_copy(ExPolicy&& policy, Rng1&& rng, Rng2&& r_rng,
+        Comp&& comp = Comp(), Proj1&& proj1 = Proj1(),
+        Proj2&& proj2 = Proj2());
+
+    // clang-format on
+}}    // namespace hpx::ranges
+
+#else    // DOXYGEN
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/iterator_support/range.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/iterator_support/traits/is_range.hpp>
+#include <hpx/iterator_support/traits/is_sentinel_for.hpp>
+
+#include <hpx/algorithms/traits/projected.hpp>
+#include <hpx/algorithms/traits/projected_range.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
+#include <hpx/parallel/algorithms/partial_sort_copy.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace ranges {
+
+    template <typename I, typename O>
+    using partial_sort_copy_result = parallel::util::in_out_result<I, O>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for hpx::ranges::partial_sort_copy
+    HPX_INLINE_CONSTEXPR_VARIABLE struct partial_sort_copy_t final
+      : hpx::functional::tag<partial_sort_copy_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename Iter1, typename Sent1,
+            typename Iter2, typename Sent2,
+            typename Comp = hpx::parallel::v1::detail::less,
+            typename Proj1 = hpx::parallel::util::projection_identity,
+            typename Proj2 = hpx::parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy<ExPolicy>::value &&
+                hpx::traits::is_sentinel_for<Sent1, Iter1>::value &&
+                hpx::traits::is_sentinel_for<Sent2, Iter2>::value &&
+                hpx::parallel::traits::is_indirect_callable<ExPolicy, Comp,
+                    hpx::parallel::traits::projected<Proj1, Iter1>,
+                    hpx::parallel::traits::projected<Proj2, Iter2>
+                >::value
+            )>
+        // clang-format on
+        friend typename hpx::parallel::util::detail::algorithm_result<ExPolicy,
+            partial_sort_copy_result<Iter1, Iter2>>::type
+        tag_invoke(partial_sort_copy_t, ExPolicy&& policy, Iter1 first,
+            Sent1 last, Iter2 r_first, Sent2 r_last, Comp&& comp = Comp(),
+            Proj1&& proj1 = Proj1(), Proj2&& proj2 = Proj2())
+        {
+            static_assert(hpx::traits::is_forward_iterator<Iter1>::value,
+                "Requires at least forward iterator.");
+            static_assert(hpx::traits::is_random_access_iterator<Iter2>::value,
+                "Requires random access iterator.");
+
+            using is_seq = hpx::is_sequenced_execution_policy<ExPolicy>;
+
+            return hpx::parallel::v1::detail::partial_sort_copy<
+                partial_sort_copy_result<Iter1, Iter2>>()
+                .call(std::forward<ExPolicy>(policy), is_seq{}, first, last,
+                    r_first,
+                    hpx::parallel::v1::detail::advance_to_sentinel(
+                        r_first, r_last),
+                    std::forward<Comp>(comp), std::forward<Proj1>(proj1),
+                    std::forward<Proj2>(proj2));
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename Rng1, typename Rng2,
+            typename Comp = hpx::parallel::v1::detail::less,
+            typename Proj1 = hpx::parallel::util::projection_identity,
+            typename Proj2 = hpx::parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy<ExPolicy>::value &&
+                hpx::traits::is_range<Rng1>::value &&
+                hpx::traits::is_range<Rng2>::value &&
+                hpx::parallel::traits::is_indirect_callable<ExPolicy, Comp,
+                    hpx::parallel::traits::projected_range<Proj1, Rng1>,
+                    hpx::parallel::traits::projected_range<Proj2, Rng2>
+                >::value
+            )>
+        // clang-format on
+        friend typename hpx::parallel::util::detail::algorithm_result<ExPolicy,
+            partial_sort_copy_result<
+                typename hpx::traits::range_iterator<Rng1>::type,
+                typename hpx::traits::range_iterator<Rng2>::type>>::type
+        tag_invoke(partial_sort_copy_t, ExPolicy&& policy, Rng1&& rng,
+            Rng2&& r_rng, Comp&& comp = Comp(), Proj1&& proj1 = Proj1(),
+            Proj2&& proj2 = Proj2())
+        {
+            using iterator_type1 =
+                typename hpx::traits::range_iterator<Rng1>::type;
+            using iterator_type2 =
+                typename hpx::traits::range_iterator<Rng2>::type;
+
+            static_assert(
+                hpx::traits::is_forward_iterator<iterator_type1>::value,
+                "Requires at least forward iterator.");
+            static_assert(
+                hpx::traits::is_random_access_iterator<iterator_type2>::value,
+                "Requires random access iterator.");
+
+            using is_seq = hpx::is_sequenced_execution_policy<ExPolicy>;
+
+            return hpx::parallel::v1::detail::partial_sort_copy<
+                partial_sort_copy_result<iterator_type1, iterator_type2>>()
+                .call(std::forward<ExPolicy>(policy), is_seq{},
+                    hpx::util::begin(rng), hpx::util::end(rng),
+                    hpx::util::begin(r_rng), hpx::util::end(r_rng),
+                    std::forward<Comp>(comp), std::forward<Proj1>(proj1),
+                    std::forward<Proj2>(proj2));
+        }
+
+        // clang-format off
+        template <typename Iter1, typename Sent1, typename Iter2,
+            typename Sent2, typename Comp = hpx::parallel::v1::detail::less,
+            typename Proj1 = hpx::parallel::util::projection_identity,
+            typename Proj2 = hpx::parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_sentinel_for<Sent1, Iter1>::value &&
+                hpx::traits::is_sentinel_for<Sent2, Iter2>::value &&
+                hpx::parallel::traits::is_indirect_callable<
+                    hpx::execution::sequenced_policy, Comp,
+                    hpx::parallel::traits::projected<Proj1, Iter1>,
+                    hpx::parallel::traits::projected<Proj2, Iter2>
+                >::value
+            )>
+        // clang-format on
+        friend partial_sort_copy_result<Iter1, Iter2> tag_invoke(
+            partial_sort_copy_t, Iter1 first, Sent1 last, Iter2 r_first,
+            Sent2 r_last, Comp&& comp = Comp(), Proj1&& proj1 = Proj1(),
+            Proj2&& proj2 = Proj2())
+        {
+            static_assert(hpx::traits::is_input_iterator<Iter1>::value,
+                "Requires at least input iterator.");
+            static_assert(hpx::traits::is_random_access_iterator<Iter2>::value,
+                "Requires random access iterator.");
+
+            return hpx::parallel::v1::detail::partial_sort_copy<
+                partial_sort_copy_result<Iter1, Iter2>>()
+                .call(hpx::execution::seq, std::true_type{}, first, last,
+                    r_first,
+                    hpx::parallel::v1::detail::advance_to_sentinel(
+                        r_first, r_last),
+                    std::forward<Comp>(comp), std::forward<Proj1>(proj1),
+                    std::forward<Proj2>(proj2));
+        }
+
+        // clang-format off
+        template <typename Rng1, typename Rng2,
+            typename Comp = hpx::parallel::v1::detail::less,
+            typename Proj1 = hpx::parallel::util::projection_identity,
+            typename Proj2 = hpx::parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_range<Rng1>::value &&
+                hpx::traits::is_range<Rng2>::value &&
+                hpx::parallel::traits::is_indirect_callable<
+                    hpx::execution::sequenced_policy, Comp,
+                    hpx::parallel::traits::projected_range<Proj1, Rng1>,
+                    hpx::parallel::traits::projected_range<Proj2, Rng2>
+                >::value
+            )>
+        // clang-format on
+        friend partial_sort_copy_result<
+            typename hpx::traits::range_iterator<Rng1>::type,
+            typename hpx::traits::range_iterator<Rng2>::type>
+        tag_invoke(partial_sort_copy_t, Rng1&& rng, Rng2&& r_rng,
+            Comp&& comp = Comp(), Proj1&& proj1 = Proj1(),
+            Proj2&& proj2 = Proj2())
+        {
+            using iterator_type1 =
+                typename hpx::traits::range_iterator<Rng1>::type;
+            using iterator_type2 =
+                typename hpx::traits::range_iterator<Rng2>::type;
+
+            static_assert(hpx::traits::is_input_iterator<iterator_type1>::value,
+                "Requires at least input iterator.");
+            static_assert(
+                hpx::traits::is_random_access_iterator<iterator_type2>::value,
+                "Requires random access iterator.");
+
+            return hpx::parallel::v1::detail::partial_sort_copy<
+                partial_sort_copy_result<iterator_type1, iterator_type2>>()
+                .call(hpx::execution::seq, std::true_type{},
+                    hpx::util::begin(rng), hpx::util::end(rng),
+                    hpx::util::begin(r_rng), hpx::util::end(r_rng),
+                    std::forward<Comp>(comp), std::forward<Proj1>(proj1),
+                    std::forward<Proj2>(proj2));
+        }
+    } partial_sort_copy{};
+}}    // namespace hpx::ranges
+
+#endif    // DOXYGEN
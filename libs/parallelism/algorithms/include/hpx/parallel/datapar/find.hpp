@@ -0,0 +1,305 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_alignment_size.hpp>
+#include <hpx/execution/traits/vector_pack_count_bits.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/util/cancellation_token.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { namespace util { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Return the index of the first element of [first, first + count) for
+    // which f returns true, or count if there is no such element. The
+    // function cancelled is called with the index of each vector-pack before
+    // it is processed, the search gives up (returning count) as soon as this
+    // returns true.
+    //
+    // For iterators referring to arithmetic types f is invoked with
+    // vector-packs and is expected to return a mask. Full packs are
+    // processed as long as possible, the remaining elements are handled
+    // using scalar packs. The position of a match inside of a pack is
+    // determined only after traits::count_bits has reported a hit, which
+    // keeps the common case (no match) free of any lane-wise operations.
+    template <typename Iter, typename Enable = void>
+    struct datapar_find_first_n
+    {
+        template <typename F, typename Cancelled>
+        static std::size_t call(
+            Iter first, std::size_t count, F&& f, Cancelled&& cancelled)
+        {
+            for (std::size_t i = 0; i != count; (void) ++i, ++first)
+            {
+                if (cancelled(i))
+                {
+                    return count;
+                }
+                if (HPX_INVOKE(f, *first))
+                {
+                    return i;
+                }
+            }
+            return count;
+        }
+    };
+
+    template <typename Iter>
+    struct datapar_find_first_n<Iter,
+        typename std::enable_if<iterator_datapar_compatible<Iter>::value>::type>
+    {
+        typedef typename std::iterator_traits<Iter>::value_type value_type;
+
+        typedef typename traits::vector_pack_type<value_type>::type V;
+        typedef typename traits::vector_pack_type<value_type, 1>::type V1;
+
+        template <typename Mask>
+        HPX_FORCEINLINE static std::size_t first_set(Mask const& mask)
+        {
+            std::size_t i = 0;
+            while (!mask[i])
+            {
+                ++i;
+            }
+            return i;
+        }
+
+        template <typename F, typename Cancelled>
+        static std::size_t call(
+            Iter first, std::size_t count, F&& f, Cancelled&& cancelled)
+        {
+            static std::size_t constexpr size =
+                traits::vector_pack_size<V>::value;
+
+            std::size_t i = 0;
+            for (/* */; i + size <= count; i += size)
+            {
+                if (cancelled(i))
+                {
+                    return count;
+                }
+
+                // the chunks handed to this kernel start anywhere in the
+                // sequence, so the packs are always loaded element aligned
+                V const v =
+                    traits::vector_pack_load<V, value_type>::unaligned(first);
+                auto mask = HPX_INVOKE(f, v);
+
+                if (traits::count_bits(mask) != 0)
+                {
+                    return i + first_set(mask);
+                }
+                std::advance(first, size);
+            }
+
+            for (/* */; i != count; (void) ++i, ++first)
+            {
+                if (traits::count_bits(HPX_INVOKE(f,
+                        traits::vector_pack_load<V1, value_type>::unaligned(
+                            first))) != 0)
+                {
+                    return i;
+                }
+            }
+            return count;
+        }
+    };
+
+    struct datapar_never_cancelled
+    {
+        HPX_FORCEINLINE constexpr bool operator()(std::size_t) const
+        {
+            return false;
+        }
+    };
+
+    template <typename Token>
+    struct datapar_cancelled_at
+    {
+        Token& tok_;
+        std::size_t base_idx_;
+
+        HPX_FORCEINLINE bool operator()(std::size_t i) const
+        {
+            return tok_.was_cancelled(base_idx_ + i);
+        }
+    };
+
+    struct datapar_cancelled
+    {
+        util::cancellation_token<>& tok_;
+
+        HPX_FORCEINLINE bool operator()(std::size_t) const
+        {
+            return tok_.was_cancelled();
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iter, typename Sent, typename F>
+    Iter datapar_find_first(Iter first, Sent last, F&& f)
+    {
+        std::size_t const count = parallel::v1::detail::distance(first, last);
+        std::advance(first,
+            datapar_find_first_n<Iter>::call(
+                first, count, std::forward<F>(f), datapar_never_cancelled{}));
+        return first;
+    }
+
+    template <typename Iter, typename Token, typename F>
+    void datapar_find_first(std::size_t base_idx, Iter part_begin,
+        std::size_t part_count, Token& tok, F&& f)
+    {
+        std::size_t const pos = datapar_find_first_n<Iter>::call(part_begin,
+            part_count, std::forward<F>(f),
+            datapar_cancelled_at<Token>{tok, base_idx});
+        if (pos != part_count)
+        {
+            tok.cancel(base_idx + pos);
+        }
+    }
+
+    template <typename Iter, typename F>
+    void datapar_find_first(Iter part_begin, std::size_t part_count,
+        util::cancellation_token<>& tok, F&& f)
+    {
+        std::size_t const pos = datapar_find_first_n<Iter>::call(part_begin,
+            part_count, std::forward<F>(f), datapar_cancelled{tok});
+        if (pos != part_count)
+        {
+            tok.cancel();
+        }
+    }
+}}}}    // namespace hpx::parallel::util::detail
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iterator, typename Sentinel,
+        typename T, typename Proj>
+    inline typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value, Iterator>::type
+    sequential_find(
+        ExPolicy&&, Iterator first, Sentinel last, T const& value, Proj proj)
+    {
+        return util::detail::datapar_find_first(
+            first, last, [&value, &proj](auto const& v) {
+                return hpx::util::invoke(proj, v) == value;
+            });
+    }
+
+    template <typename ExPolicy, typename Iterator, typename Token,
+        typename T, typename Proj>
+    inline typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value>::type
+    sequential_find(ExPolicy&&, std::size_t base_idx, Iterator part_begin,
+        std::size_t part_count, Token& tok, T const& value, Proj&& proj)
+    {
+        util::detail::datapar_find_first(base_idx, part_begin, part_count,
+            tok, [&value, &proj](auto const& v) {
+                return hpx::util::invoke(proj, v) == value;
+            });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iterator, typename Sentinel,
+        typename Pred, typename Proj>
+    inline typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value, Iterator>::type
+    sequential_find_if(
+        ExPolicy&&, Iterator first, Sentinel last, Pred pred, Proj proj)
+    {
+        return util::detail::datapar_find_first(
+            first, last, [&pred, &proj](auto const& v) {
+                return hpx::util::invoke(pred, hpx::util::invoke(proj, v));
+            });
+    }
+
+    template <typename ExPolicy, typename Iterator, typename Token,
+        typename Pred, typename Proj>
+    inline typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value>::type
+    sequential_find_if(ExPolicy&&, std::size_t base_idx, Iterator part_begin,
+        std::size_t part_count, Token& tok, Pred&& pred, Proj&& proj)
+    {
+        util::detail::datapar_find_first(base_idx, part_begin, part_count,
+            tok, [&pred, &proj](auto const& v) {
+                return hpx::util::invoke(pred, hpx::util::invoke(proj, v));
+            });
+    }
+
+    template <typename ExPolicy, typename Iterator, typename Pred,
+        typename Proj>
+    inline typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value>::type
+    sequential_find_if(ExPolicy&&, Iterator part_begin,
+        std::size_t part_count, util::cancellation_token<>& tok, Pred&& pred,
+        Proj&& proj)
+    {
+        util::detail::datapar_find_first(part_begin, part_count, tok,
+            [&pred, &proj](auto const& v) {
+                return hpx::util::invoke(pred, hpx::util::invoke(proj, v));
+            });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iterator, typename Sentinel,
+        typename Pred, typename Proj>
+    inline typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value, Iterator>::type
+    sequential_find_if_not(
+        ExPolicy&&, Iterator first, Sentinel last, Pred pred, Proj proj)
+    {
+        return util::detail::datapar_find_first(
+            first, last, [&pred, &proj](auto const& v) {
+                return !hpx::util::invoke(pred, hpx::util::invoke(proj, v));
+            });
+    }
+
+    template <typename ExPolicy, typename Iterator, typename Token,
+        typename Pred, typename Proj>
+    inline typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value>::type
+    sequential_find_if_not(ExPolicy&&, std::size_t base_idx,
+        Iterator part_begin, std::size_t part_count, Token& tok, Pred&& pred,
+        Proj&& proj)
+    {
+        util::detail::datapar_find_first(base_idx, part_begin, part_count,
+            tok, [&pred, &proj](auto const& v) {
+                return !hpx::util::invoke(pred, hpx::util::invoke(proj, v));
+            });
+    }
+
+    template <typename ExPolicy, typename Iterator, typename Pred,
+        typename Proj>
+    inline typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value>::type
+    sequential_find_if_not(ExPolicy&&, Iterator part_begin,
+        std::size_t part_count, util::cancellation_token<>& tok, Pred&& pred,
+        Proj&& proj)
+    {
+        util::detail::datapar_find_first(part_begin, part_count, tok,
+            [&pred, &proj](auto const& v) {
+                return !hpx::util::invoke(pred, hpx::util::invoke(proj, v));
+            });
+    }
+}}}}    // namespace hpx::parallel::v1::detail
+
+#endif
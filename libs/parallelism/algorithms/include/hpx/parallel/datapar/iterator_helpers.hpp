@@ -209,7 +209,7 @@ namespace hpx { namespace parallel { namespace util { namespace detail {
 
         template <typename F>
         HPX_HOST_DEVICE HPX_FORCEINLINE static
-            typename HPX_INVOKE_result<F, V1*>::type
+            typename hpx::util::invoke_result<F, V1*>::type
             call1(F&& f, Iter& it)
         {
             store_on_exit_unaligned<Iter, V1> tmp(it);
@@ -219,7 +219,7 @@ namespace hpx { namespace parallel { namespace util { namespace detail {
 
         template <typename F>
         HPX_HOST_DEVICE HPX_FORCEINLINE static
-            typename HPX_INVOKE_result<F, V*>::type
+            typename hpx::util::invoke_result<F, V*>::type
             callv(F&& f, Iter& it)
         {
             store_on_exit<Iter, V> tmp(it);
@@ -233,8 +233,8 @@ namespace hpx { namespace parallel { namespace util { namespace detail {
     struct invoke_vectorized_in2
     {
         template <typename F, typename Iter1, typename Iter2>
-        static typename HPX_INVOKE_result<F, V1*, V2*>::type call_aligned(
-            F&& f, Iter1& it1, Iter2& it2)
+        static typename hpx::util::invoke_result<F, V1*, V2*>::type
+        call_aligned(F&& f, Iter1& it1, Iter2& it2)
         {
             static_assert(traits::vector_pack_size<V1>::value ==
                     traits::vector_pack_size<V2>::value,
@@ -255,8 +255,8 @@ namespace hpx { namespace parallel { namespace util { namespace detail {
         }
 
         template <typename F, typename Iter1, typename Iter2>
-        static typename HPX_INVOKE_result<F, V1*, V2*>::type call_unaligned(
-            F&& f, Iter1& it1, Iter2& it2)
+        static typename hpx::util::invoke_result<F, V1*, V2*>::type
+        call_unaligned(F&& f, Iter1& it1, Iter2& it2)
         {
             static_assert(traits::vector_pack_size<V1>::value ==
                     traits::vector_pack_size<V2>::value,
@@ -291,7 +291,7 @@ namespace hpx { namespace parallel { namespace util { namespace detail {
 
         template <typename F>
         HPX_HOST_DEVICE HPX_FORCEINLINE static
-            typename HPX_INVOKE_result<F, V11*, V12*>::type
+            typename hpx::util::invoke_result<F, V11*, V12*>::type
             call1(F&& f, Iter1& it1, Iter2& it2)
         {
             return invoke_vectorized_in2<V11, V12>::call_aligned(
@@ -300,7 +300,7 @@ namespace hpx { namespace parallel { namespace util { namespace detail {
 
         template <typename F>
         HPX_HOST_DEVICE HPX_FORCEINLINE static
-            typename HPX_INVOKE_result<F, V1*, V2*>::type
+            typename hpx::util::invoke_result<F, V1*, V2*>::type
             callv(F&& f, Iter1& it1, Iter2& it2)
         {
             if (is_data_aligned(it1) || is_data_aligned(it2))
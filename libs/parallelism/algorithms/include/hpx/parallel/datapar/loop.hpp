@@ -15,6 +15,7 @@
 #include <hpx/execution/traits/vector_pack_load_store.hpp>
 #include <hpx/execution/traits/vector_pack_type.hpp>
 #include <hpx/executors/datapar/execution_policy_fwd.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/datapar/iterator_helpers.hpp>
 #include <hpx/parallel/util/loop.hpp>
 
@@ -95,7 +96,7 @@ namespace hpx { namespace parallel { namespace util {
             typename std::enable_if<
                 iterator_datapar_compatible<Iter>::value>::type>
         {
-            template <typename Iter_>
+            template <typename Iter_, typename Sent_>
             static bool call(Iter_ const& first, Sent_ const& last)
             {
                 typedef
@@ -103,7 +104,7 @@ namespace hpx { namespace parallel { namespace util {
                 typedef typename traits::vector_pack_type<value_type>::type V;
 
                 return traits::vector_pack_size<V>::value <=
-                    (std::size_t) detail::distance(first, last);
+                    (std::size_t) parallel::v1::detail::distance(first, last);
             }
         };
 
@@ -117,7 +118,7 @@ namespace hpx { namespace parallel { namespace util {
             typedef typename std::iterator_traits<iterator_type>::value_type
                 value_type;
 
-            typedef typename traits::vector_pack_type<value_type> V;
+            typedef typename traits::vector_pack_type<value_type>::type V;
 
             template <typename Begin, typename End, typename F>
             HPX_HOST_DEVICE HPX_FORCEINLINE static typename std::enable_if<
@@ -206,7 +207,7 @@ namespace hpx { namespace parallel { namespace util {
                     !iterator_datapar_compatible<InIter1>::value ||
                     !iterator_datapar_compatible<InIter2>::value,
                 std::pair<InIter1, InIter2>>::type
-            call(InIter1 it1, InIter1 last1, InIter2 it2, F&& f)
+            call(InIter1 it1, InIter1 /* last1 */, InIter2 it2, F&& /* f */)
             {
                 return std::make_pair(std::move(it1), std::move(it2));
             }
@@ -317,7 +318,23 @@ namespace hpx { namespace parallel { namespace util {
     ///////////////////////////////////////////////////////////////////////////
     template <typename Begin, typename End, typename F>
     HPX_HOST_DEVICE HPX_FORCEINLINE Begin loop(
-        parallel::execution::datapar_policy, Begin begin, End end, F&& f)
+        hpx::execution::dataseq_policy, Begin begin, End end, F&& f)
+    {
+        return detail::datapar_loop<Begin>::call(
+            begin, end, std::forward<F>(f));
+    }
+
+    template <typename Begin, typename End, typename F>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Begin loop(
+        hpx::execution::dataseq_task_policy, Begin begin, End end, F&& f)
+    {
+        return detail::datapar_loop<Begin>::call(
+            begin, end, std::forward<F>(f));
+    }
+
+    template <typename Begin, typename End, typename F>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Begin loop(
+        hpx::execution::datapar_policy, Begin begin, End end, F&& f)
     {
         return detail::datapar_loop<Begin>::call(
             begin, end, std::forward<F>(f));
@@ -325,7 +342,7 @@ namespace hpx { namespace parallel { namespace util {
 
     template <typename Begin, typename End, typename F>
     HPX_HOST_DEVICE HPX_FORCEINLINE Begin loop(
-        parallel::execution::datapar_task_policy, Begin begin, End end, F&& f)
+        hpx::execution::datapar_task_policy, Begin begin, End end, F&& f)
     {
         return detail::datapar_loop<Begin>::call(
             begin, end, std::forward<F>(f));
@@ -0,0 +1,316 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_alignment_size.hpp>
+#include <hpx/execution/traits/vector_pack_count_bits.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { namespace util { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Find the smallest (first one found), the largest (first one found), or
+    // both (first smallest, last largest) elements of [it, it + count).
+    //
+    // For iterators referring to arithmetic types each vector-pack is
+    // compared against the current extremum broadcast to all lanes. The
+    // elements of a pack are inspected one by one (using scalar packs) only
+    // if traits::count_bits reports that at least one of its lanes may
+    // replace the current result. This keeps the common case free of any
+    // lane-wise operations and preserves the element order guarantees of the
+    // scalar implementation.
+    template <typename Iter, typename Enable = void>
+    struct datapar_minmax_element_n
+    {
+        template <typename F, typename Proj>
+        static Iter min(
+            Iter it, std::size_t count, F const& f, Proj const& proj)
+        {
+            Iter smallest = it;
+            for (++it; count > 1; (void) --count, ++it)
+            {
+                if (HPX_INVOKE(
+                        f, HPX_INVOKE(proj, *it), HPX_INVOKE(proj, *smallest)))
+                {
+                    smallest = it;
+                }
+            }
+            return smallest;
+        }
+
+        template <typename F, typename Proj>
+        static Iter max(
+            Iter it, std::size_t count, F const& f, Proj const& proj)
+        {
+            Iter greatest = it;
+            for (++it; count > 1; (void) --count, ++it)
+            {
+                if (HPX_INVOKE(
+                        f, HPX_INVOKE(proj, *greatest), HPX_INVOKE(proj, *it)))
+                {
+                    greatest = it;
+                }
+            }
+            return greatest;
+        }
+
+        template <typename F, typename Proj>
+        static std::pair<Iter, Iter> minmax(
+            Iter it, std::size_t count, F const& f, Proj const& proj)
+        {
+            std::pair<Iter, Iter> result(it, it);
+            for (++it; count > 1; (void) --count, ++it)
+            {
+                if (HPX_INVOKE(f, HPX_INVOKE(proj, *it),
+                        HPX_INVOKE(proj, *result.first)))
+                {
+                    result.first = it;
+                }
+                if (!HPX_INVOKE(f, HPX_INVOKE(proj, *it),
+                        HPX_INVOKE(proj, *result.second)))
+                {
+                    result.second = it;
+                }
+            }
+            return result;
+        }
+    };
+
+    template <typename Iter>
+    struct datapar_minmax_element_n<Iter,
+        typename std::enable_if<iterator_datapar_compatible<Iter>::value>::type>
+    {
+        typedef typename std::iterator_traits<Iter>::value_type value_type;
+
+        typedef typename traits::vector_pack_type<value_type>::type V;
+        typedef typename traits::vector_pack_type<value_type, 1>::type V1;
+
+        static std::size_t constexpr size = traits::vector_pack_size<V>::value;
+
+        // The projected packs are returned by value, a projection returning
+        // its argument would otherwise leave a dangling reference to the
+        // loaded pack. The chunks start anywhere in the sequence, so the
+        // packs are always loaded element aligned.
+        template <typename Proj>
+        HPX_FORCEINLINE static auto load(Iter const& it, Proj const& proj)
+            -> typename std::decay<decltype(
+                HPX_INVOKE(proj, std::declval<V const&>()))>::type
+        {
+            V const v = traits::vector_pack_load<V, value_type>::unaligned(it);
+            return HPX_INVOKE(proj, v);
+        }
+
+        template <typename Proj>
+        HPX_FORCEINLINE static auto load1(Iter const& it, Proj const& proj)
+            -> typename std::decay<decltype(
+                HPX_INVOKE(proj, std::declval<V1 const&>()))>::type
+        {
+            V1 const v =
+                traits::vector_pack_load<V1, value_type>::unaligned(it);
+            return HPX_INVOKE(proj, v);
+        }
+
+        // f(a, b) with both arguments being packs, returns true if this holds
+        // for at least one lane
+        template <typename F, typename T1, typename T2>
+        HPX_FORCEINLINE static bool any_of(F const& f, T1 const& a, T2 const& b)
+        {
+            return traits::count_bits(HPX_INVOKE(f, a, b)) != 0;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename F, typename Proj>
+        static void min_step(Iter it, std::size_t count, F const& f,
+            Proj const& proj, Iter& smallest, value_type& value)
+        {
+            for (/* */; count != 0; (void) --count, ++it)
+            {
+                if (any_of(f, load1(it, proj), V1(value)))
+                {
+                    smallest = it;
+                    value = HPX_INVOKE(proj, *it);
+                }
+            }
+        }
+
+        template <typename F, typename Proj>
+        static Iter min(
+            Iter it, std::size_t count, F const& f, Proj const& proj)
+        {
+            Iter smallest = it;
+            if (count < 2)
+            {
+                return smallest;
+            }
+
+            value_type value = HPX_INVOKE(proj, *it);
+            ++it;
+            --count;
+
+            for (/* */; count >= size; count -= size)
+            {
+                if (any_of(f, load(it, proj), V(value)))
+                {
+                    min_step(it, size, f, proj, smallest, value);
+                }
+                std::advance(it, size);
+            }
+            min_step(it, count, f, proj, smallest, value);
+
+            return smallest;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename F, typename Proj>
+        static void max_step(Iter it, std::size_t count, F const& f,
+            Proj const& proj, Iter& greatest, value_type& value)
+        {
+            for (/* */; count != 0; (void) --count, ++it)
+            {
+                if (any_of(f, V1(value), load1(it, proj)))
+                {
+                    greatest = it;
+                    value = HPX_INVOKE(proj, *it);
+                }
+            }
+        }
+
+        template <typename F, typename Proj>
+        static Iter max(
+            Iter it, std::size_t count, F const& f, Proj const& proj)
+        {
+            Iter greatest = it;
+            if (count < 2)
+            {
+                return greatest;
+            }
+
+            value_type value = HPX_INVOKE(proj, *it);
+            ++it;
+            --count;
+
+            for (/* */; count >= size; count -= size)
+            {
+                if (any_of(f, V(value), load(it, proj)))
+                {
+                    max_step(it, size, f, proj, greatest, value);
+                }
+                std::advance(it, size);
+            }
+            max_step(it, count, f, proj, greatest, value);
+
+            return greatest;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename F, typename Proj>
+        static void minmax_step(Iter it, std::size_t count, F const& f,
+            Proj const& proj, std::pair<Iter, Iter>& result,
+            value_type& min_value, value_type& max_value)
+        {
+            for (/* */; count != 0; (void) --count, ++it)
+            {
+                auto curr = load1(it, proj);
+                if (any_of(f, curr, V1(min_value)))
+                {
+                    result.first = it;
+                    min_value = HPX_INVOKE(proj, *it);
+                }
+                if (!any_of(f, curr, V1(max_value)))
+                {
+                    result.second = it;
+                    max_value = HPX_INVOKE(proj, *it);
+                }
+            }
+        }
+
+        template <typename F, typename Proj>
+        static std::pair<Iter, Iter> minmax(
+            Iter it, std::size_t count, F const& f, Proj const& proj)
+        {
+            std::pair<Iter, Iter> result(it, it);
+            if (count < 2)
+            {
+                return result;
+            }
+
+            value_type min_value = HPX_INVOKE(proj, *it);
+            value_type max_value = min_value;
+            ++it;
+            --count;
+
+            for (/* */; count >= size; count -= size)
+            {
+                auto curr = load(it, proj);
+
+                // a pack needs closer inspection if any of its lanes is
+                // smaller than the current minimum or if not all of its lanes
+                // are smaller than the current maximum
+                if (any_of(f, curr, V(min_value)) ||
+                    traits::count_bits(HPX_INVOKE(f, curr, V(max_value))) !=
+                        size)
+                {
+                    minmax_step(
+                        it, size, f, proj, result, min_value, max_value);
+                }
+                std::advance(it, size);
+            }
+            minmax_step(it, count, f, proj, result, min_value, max_value);
+
+            return result;
+        }
+    };
+}}}}    // namespace hpx::parallel::util::detail
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename FwdIter, typename F, typename Proj>
+    inline typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value, FwdIter>::type
+    sequential_min_element(ExPolicy&&, FwdIter it, std::size_t count,
+        F const& f, Proj const& proj)
+    {
+        return util::detail::datapar_minmax_element_n<FwdIter>::min(
+            it, count, f, proj);
+    }
+
+    template <typename ExPolicy, typename FwdIter, typename F, typename Proj>
+    inline typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value, FwdIter>::type
+    sequential_max_element(ExPolicy&&, FwdIter it, std::size_t count,
+        F const& f, Proj const& proj)
+    {
+        return util::detail::datapar_minmax_element_n<FwdIter>::max(
+            it, count, f, proj);
+    }
+
+    template <typename ExPolicy, typename FwdIter, typename F, typename Proj>
+    inline typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+        std::pair<FwdIter, FwdIter>>::type
+    sequential_minmax_element(ExPolicy&&, FwdIter it, std::size_t count,
+        F const& f, Proj const& proj)
+    {
+        return util::detail::datapar_minmax_element_n<FwdIter>::minmax(
+            it, count, f, proj);
+    }
+}}}}    // namespace hpx::parallel::v1::detail
+
+#endif
@@ -0,0 +1,130 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_alignment_size.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/traits/is_invocable.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/util/loop.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { namespace util { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Reduce the elements of [it, it + count) into init using r.
+    //
+    // If the iterator refers to arithmetic types, the type of the reduction
+    // is the element type, and r can combine two vector-packs into another
+    // vector-pack, whole packs are accumulated into a vector accumulator
+    // first. The lanes of the accumulator are combined with init afterwards,
+    // the remaining elements are handled one by one. This relies on r being
+    // associative and commutative (as required by reduce), the order of
+    // applying r is different from the scalar implementation.
+    template <typename Iter, typename Enable = void>
+    struct datapar_reduce_n
+    {
+        template <typename T, typename Reduce>
+        static T call(Iter it, std::size_t count, T init, Reduce&& r)
+        {
+            return util::accumulate_n(
+                it, count, std::move(init), std::forward<Reduce>(r));
+        }
+    };
+
+    template <typename Iter>
+    struct datapar_reduce_n<Iter,
+        typename std::enable_if<iterator_datapar_compatible<Iter>::value>::type>
+    {
+        typedef typename std::iterator_traits<Iter>::value_type value_type;
+        typedef typename traits::vector_pack_type<value_type>::type V;
+
+        template <typename T, typename Reduce>
+        struct is_vectorizable
+          : std::integral_constant<bool,
+                std::is_same<T, value_type>::value &&
+                    hpx::is_invocable_r<V, Reduce&, V const&, V const&>::value>
+        {
+        };
+
+        // the chunks start anywhere in the sequence, so the packs are always
+        // loaded element aligned
+        HPX_FORCEINLINE static V load(Iter const& it)
+        {
+            return traits::vector_pack_load<V, value_type>::unaligned(it);
+        }
+
+        template <typename T, typename Reduce>
+        static T call_vectorized(
+            Iter it, std::size_t count, T init, Reduce& r, std::true_type)
+        {
+            static std::size_t constexpr size =
+                traits::vector_pack_size<V>::value;
+
+            if (count >= 2 * size)
+            {
+                V accum = load(it);
+                std::advance(it, size);
+                count -= size;
+
+                for (/* */; count >= size; count -= size)
+                {
+                    accum = HPX_INVOKE(r, accum, load(it));
+                    std::advance(it, size);
+                }
+
+                for (std::size_t i = 0; i != size; ++i)
+                {
+                    init = HPX_INVOKE(r, init, T(accum[i]));
+                }
+            }
+
+            return util::accumulate_n(it, count, std::move(init), r);
+        }
+
+        template <typename T, typename Reduce>
+        static T call_vectorized(
+            Iter it, std::size_t count, T init, Reduce& r, std::false_type)
+        {
+            return util::accumulate_n(it, count, std::move(init), r);
+        }
+
+        template <typename T, typename Reduce>
+        static T call(Iter it, std::size_t count, T init, Reduce&& r)
+        {
+            return call_vectorized(it, count, std::move(init), r,
+                is_vectorizable<T,
+                    typename std::remove_reference<Reduce>::type>{});
+        }
+    };
+}}}}    // namespace hpx::parallel::util::detail
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter, typename T, typename Reduce>
+    inline typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value, T>::type
+    sequential_reduce(
+        ExPolicy&&, Iter it, std::size_t count, T init, Reduce&& r)
+    {
+        return util::detail::datapar_reduce_n<Iter>::call(
+            it, count, std::move(init), std::forward<Reduce>(r));
+    }
+}}}}    // namespace hpx::parallel::v1::detail
+
+#endif
@@ -17,6 +17,7 @@
 #include <hpx/iterator_support/traits/is_iterator.hpp>
 #include <hpx/parallel/datapar/iterator_helpers.hpp>
 #include <hpx/parallel/util/cancellation_token.hpp>
+#include <hpx/parallel/util/result_types.hpp>
 #include <hpx/parallel/util/transform_loop.hpp>
 
 #include <algorithm>
@@ -78,48 +79,11 @@ namespace hpx { namespace parallel { namespace util {
                 std::pair<InIter, OutIter>>::type
             call(InIter first, std::size_t count, OutIter dest, F&& f)
             {
-                return util::transform_loop_n<sequenced_policy>(
+                return util::transform_loop_n<hpx::execution::sequenced_policy>(
                     first, count, dest, std::forward<F>(f));
             }
         };
 
-        ///////////////////////////////////////////////////////////////////////
-        template <typename Iterator>
-        struct datapar_transform_loop
-        {
-            typedef typename std::decay<Iterator>::type iterator_type;
-            typedef typename std::iterator_traits<iterator_type>::value_type
-                value_type;
-
-            typedef typename traits::vector_pack_type<value_type>::type V;
-            typedef typename traits::vector_pack_type<value_type, 1>::type V1;
-
-            template <typename InIter, typename OutIter, typename F>
-            HPX_HOST_DEVICE HPX_FORCEINLINE static typename std::enable_if<
-                iterators_datapar_compatible<InIter, OutIter>::value &&
-                    iterator_datapar_compatible<InIter>::value &&
-                    iterator_datapar_compatible<OutIter>::value,
-                std::pair<InIter, OutIter>>::type
-            call(InIter first, InIter last, OutIter dest, F&& f)
-            {
-                return util::transform_loop_n<
-                    parallel::execution::datapar_policy>(first,
-                    std::distance(first, last), dest, std::forward<F>(f));
-            }
-
-            template <typename InIter, typename OutIter, typename F>
-            HPX_HOST_DEVICE HPX_FORCEINLINE static typename std::enable_if<
-                !iterators_datapar_compatible<InIter, OutIter>::value ||
-                    !iterator_datapar_compatible<InIter>::value ||
-                    !iterator_datapar_compatible<OutIter>::value,
-                std::pair<InIter, OutIter>>::type
-            call(InIter first, InIter last, OutIter dest, F&& f)
-            {
-                return util::transform_loop(
-                    seq, first, last, dest, std::forward<F>(f));
-            }
-        };
-
         ///////////////////////////////////////////////////////////////////////
         template <typename Iter1, typename Iter2>
         struct datapar_transform_binary_loop_n
@@ -179,10 +143,79 @@ namespace hpx { namespace parallel { namespace util {
             call(InIter1 first1, std::size_t count, InIter2 first2,
                 OutIter dest, F&& f)
             {
-                return util::transform_binary_loop_n<sequenced_policy>(
+                return util::transform_binary_loop_n<
+                    hpx::execution::sequenced_policy>(
                     first1, count, first2, dest, std::forward<F>(f));
             }
         };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter, typename OutIter, typename F>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+        std::pair<Iter, OutIter>>::type
+    transform_loop_n(Iter it, std::size_t count, OutIter dest, F&& f)
+    {
+        return detail::datapar_transform_loop_n<Iter>::call(
+            it, count, dest, std::forward<F>(f));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename InIter1, typename InIter2,
+        typename OutIter, typename F>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+        hpx::tuple<InIter1, InIter2, OutIter>>::type
+    transform_binary_loop_n(
+        InIter1 first1, std::size_t count, InIter2 first2, OutIter dest, F&& f)
+    {
+        return detail::datapar_transform_binary_loop_n<InIter1, InIter2>::call(
+            first1, count, first2, dest, std::forward<F>(f));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Iterator>
+        struct datapar_transform_loop
+        {
+            typedef typename std::decay<Iterator>::type iterator_type;
+            typedef typename std::iterator_traits<iterator_type>::value_type
+                value_type;
+
+            typedef typename traits::vector_pack_type<value_type>::type V;
+            typedef typename traits::vector_pack_type<value_type, 1>::type V1;
+
+            template <typename InIter, typename OutIter, typename F>
+            HPX_HOST_DEVICE HPX_FORCEINLINE static typename std::enable_if<
+                iterators_datapar_compatible<InIter, OutIter>::value &&
+                    iterator_datapar_compatible<InIter>::value &&
+                    iterator_datapar_compatible<OutIter>::value,
+                util::in_out_result<InIter, OutIter>>::type
+            call(InIter first, InIter last, OutIter dest, F&& f)
+            {
+                auto ret =
+                    util::transform_loop_n<hpx::execution::datapar_policy>(
+                        first, std::distance(first, last), dest,
+                        std::forward<F>(f));
+
+                return util::in_out_result<InIter, OutIter>{
+                    std::move(ret.first), std::move(ret.second)};
+            }
+
+            template <typename InIter, typename OutIter, typename F>
+            HPX_HOST_DEVICE HPX_FORCEINLINE static typename std::enable_if<
+                !iterators_datapar_compatible<InIter, OutIter>::value ||
+                    !iterator_datapar_compatible<InIter>::value ||
+                    !iterator_datapar_compatible<OutIter>::value,
+                util::in_out_result<InIter, OutIter>>::type
+            call(InIter first, InIter last, OutIter dest, F&& f)
+            {
+                return util::transform_loop(hpx::execution::seq, first, last,
+                    dest, std::forward<F>(f));
+            }
+        };
 
         ///////////////////////////////////////////////////////////////////////
         template <typename Iter1, typename Iter2>
@@ -210,14 +243,18 @@ namespace hpx { namespace parallel { namespace util {
                     iterator_datapar_compatible<InIter1>::value &&
                     iterator_datapar_compatible<InIter2>::value &&
                     iterator_datapar_compatible<OutIter>::value,
-                hpx::tuple<InIter1, InIter2, OutIter>>::type
+                util::in_in_out_result<InIter1, InIter2, OutIter>>::type
             call(InIter1 first1, InIter1 last1, InIter2 first2, OutIter dest,
                 F&& f)
             {
-                return util::transform_binary_loop_n<
-                    parallel::execution::datapar_policy>(first1,
+                auto ret = util::transform_binary_loop_n<
+                    hpx::execution::datapar_policy>(first1,
                     std::distance(first1, last1), first2, dest,
                     std::forward<F>(f));
+
+                return util::in_in_out_result<InIter1, InIter2, OutIter>{
+                    std::move(hpx::get<0>(ret)), std::move(hpx::get<1>(ret)),
+                    std::move(hpx::get<2>(ret))};
             }
 
             template <typename InIter1, typename InIter2, typename OutIter,
@@ -228,11 +265,12 @@ namespace hpx { namespace parallel { namespace util {
                     !iterator_datapar_compatible<InIter1>::value ||
                     !iterator_datapar_compatible<InIter2>::value ||
                     !iterator_datapar_compatible<OutIter>::value,
-                hpx::tuple<InIter1, InIter2, OutIter>>::type
+                util::in_in_out_result<InIter1, InIter2, OutIter>>::type
             call(InIter1 first1, InIter1 last1, InIter2 first2, OutIter dest,
                 F&& f)
             {
-                return util::transform_binary_loop<sequenced_policy>(
+                return util::transform_binary_loop<
+                    hpx::execution::sequenced_policy>(
                     first1, last1, first2, dest, std::forward<F>(f));
             }
 
@@ -244,16 +282,20 @@ namespace hpx { namespace parallel { namespace util {
                     iterator_datapar_compatible<InIter1>::value &&
                     iterator_datapar_compatible<InIter2>::value &&
                     iterator_datapar_compatible<OutIter>::value,
-                hpx::tuple<InIter1, InIter2, OutIter>>::type
+                util::in_in_out_result<InIter1, InIter2, OutIter>>::type
             call(InIter1 first1, InIter1 last1, InIter2 first2, InIter2 last2,
                 OutIter dest, F&& f)
             {
                 std::size_t count = (std::min)(
                     std::distance(first1, last1), std::distance(first2, last2));
 
-                return util::transform_binary_loop_n<
-                    parallel::execution::datapar_policy>(
+                auto ret = util::transform_binary_loop_n<
+                    hpx::execution::datapar_policy>(
                     first1, count, first2, dest, std::forward<F>(f));
+
+                return util::in_in_out_result<InIter1, InIter2, OutIter>{
+                    std::move(hpx::get<0>(ret)), std::move(hpx::get<1>(ret)),
+                    std::move(hpx::get<2>(ret))};
             }
 
             template <typename InIter1, typename InIter2, typename OutIter,
@@ -264,57 +306,52 @@ namespace hpx { namespace parallel { namespace util {
                     !iterator_datapar_compatible<InIter1>::value ||
                     !iterator_datapar_compatible<InIter2>::value ||
                     !iterator_datapar_compatible<OutIter>::value,
-                hpx::tuple<InIter1, InIter2, OutIter>>::type
+                util::in_in_out_result<InIter1, InIter2, OutIter>>::type
             call(InIter1 first1, InIter1 last1, InIter2 first2, InIter2 last2,
                 OutIter dest, F&& f)
             {
-                return util::transform_binary_loop<sequenced_policy>(
+                return util::transform_binary_loop<
+                    hpx::execution::sequenced_policy>(
                     first1, last1, first2, last2, dest, std::forward<F>(f));
             }
         };
     }    // namespace detail
 
     ///////////////////////////////////////////////////////////////////////////
-    template <typename ExPolicy, typename Iter, typename OutIter, typename F>
-    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
-        hpx::is_vectorpack_execution_policy<ExPolicy>::value,
-        std::pair<Iter, OutIter>>::type
-    transform_loop_n(Iter it, std::size_t count, OutIter dest, F&& f)
+    template <typename Iter, typename OutIter, typename F>
+    HPX_HOST_DEVICE HPX_FORCEINLINE util::in_out_result<Iter, OutIter>
+    transform_loop(hpx::execution::dataseq_policy, Iter it, Iter end,
+        OutIter dest, F&& f)
     {
-        return detail::datapar_transform_loop_n<Iter>::call(
-            it, count, dest, std::forward<F>(f));
+        return detail::datapar_transform_loop<Iter>::call(
+            it, end, dest, std::forward<F>(f));
     }
 
-    ///////////////////////////////////////////////////////////////////////////
     template <typename Iter, typename OutIter, typename F>
-    HPX_HOST_DEVICE HPX_FORCEINLINE std::pair<Iter, OutIter> transform_loop(
-        parallel::execution::datapar_policy, Iter it, Iter end, OutIter dest,
-        F&& f)
+    HPX_HOST_DEVICE HPX_FORCEINLINE util::in_out_result<Iter, OutIter>
+    transform_loop(hpx::execution::dataseq_task_policy, Iter it, Iter end,
+        OutIter dest, F&& f)
     {
         return detail::datapar_transform_loop<Iter>::call(
             it, end, dest, std::forward<F>(f));
     }
 
     template <typename Iter, typename OutIter, typename F>
-    HPX_HOST_DEVICE HPX_FORCEINLINE std::pair<Iter, OutIter> transform_loop(
-        parallel::execution::datapar_task_policy, Iter it, Iter end,
+    HPX_HOST_DEVICE HPX_FORCEINLINE util::in_out_result<Iter, OutIter>
+    transform_loop(hpx::execution::datapar_policy, Iter it, Iter end,
         OutIter dest, F&& f)
     {
         return detail::datapar_transform_loop<Iter>::call(
             it, end, dest, std::forward<F>(f));
     }
 
-    ///////////////////////////////////////////////////////////////////////////
-    template <typename ExPolicy, typename InIter1, typename InIter2,
-        typename OutIter, typename F>
-    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
-        hpx::is_vectorpack_execution_policy<ExPolicy>::value,
-        hpx::tuple<InIter1, InIter2, OutIter>>::type
-    transform_binary_loop_n(
-        InIter1 first1, std::size_t count, InIter2 first2, OutIter dest, F&& f)
+    template <typename Iter, typename OutIter, typename F>
+    HPX_HOST_DEVICE HPX_FORCEINLINE util::in_out_result<Iter, OutIter>
+    transform_loop(hpx::execution::datapar_task_policy, Iter it, Iter end,
+        OutIter dest, F&& f)
     {
-        return detail::datapar_transform_binary_loop_n<InIter1, InIter2>::call(
-            first1, count, first2, dest, std::forward<F>(f));
+        return detail::datapar_transform_loop<Iter>::call(
+            it, end, dest, std::forward<F>(f));
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -323,7 +360,7 @@ namespace hpx { namespace parallel { namespace util {
         typename OutIter, typename F>
     HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
         hpx::is_vectorpack_execution_policy<ExPolicy>::value,
-        hpx::tuple<InIter1, InIter2, OutIter>>::type
+        util::in_in_out_result<InIter1, InIter2, OutIter>>::type
     transform_binary_loop(
         InIter1 first1, InIter1 last1, InIter2 first2, OutIter dest, F&& f)
     {
@@ -335,7 +372,7 @@ namespace hpx { namespace parallel { namespace util {
         typename OutIter, typename F>
     HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
         hpx::is_vectorpack_execution_policy<ExPolicy>::value,
-        hpx::tuple<InIter1, InIter2, OutIter>>::type
+        util::in_in_out_result<InIter1, InIter2, OutIter>>::type
     transform_binary_loop(InIter1 first1, InIter1 last1, InIter2 first2,
         InIter2 last2, OutIter dest, F&& f)
     {
@@ -53,10 +53,24 @@ namespace hpx { namespace parallel { namespace util { namespace detail {
     };
 
     ///////////////////////////////////////////////////////////////////////////
+    // all element types of a zipped sequence have to map onto vector-packs
+    // of the same size
+    template <typename T, typename... Ts>
+    struct vector_pack_sizes_match
+      : hpx::util::all_of<std::integral_constant<bool,
+            traits::vector_pack_size<T>::value ==
+                traits::vector_pack_size<Ts>::value>...>
+    {
+    };
+
     template <typename... Iter>
     struct iterator_datapar_compatible_impl<hpx::util::zip_iterator<Iter...>>
-      : hpx::util::all_of<std::is_arithmetic<
-            typename std::iterator_traits<Iter>::value_type>...>
+      : std::conditional<
+            hpx::util::all_of<std::is_arithmetic<
+                typename std::iterator_traits<Iter>::value_type>...>::value,
+            vector_pack_sizes_match<
+                typename std::iterator_traits<Iter>::value_type...>,
+            std::false_type>::type
     {
     };
 }}}}    // namespace hpx::parallel::util::detail
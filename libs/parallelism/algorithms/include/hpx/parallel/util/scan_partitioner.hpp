@@ -11,6 +11,10 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/datastructures/optional.hpp>
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/execution_base/this_thread.hpp>
 #include <hpx/modules/errors.hpp>
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
 #include <hpx/async_local/dataflow.hpp>
@@ -26,8 +30,10 @@
 #include <hpx/parallel/util/detail/select_partitioner.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <exception>
+#include <iterator>
 #include <list>
 #include <memory>
 #include <type_traits>
@@ -43,8 +49,50 @@ namespace hpx { namespace parallel { namespace util {
     {
     };
 
+    // Performs the scan in a single pass over the data using decoupled
+    // look-back: the input is split into small chunks which are handed out
+    // in order to a fixed number of workers. Each chunk is reduced (f1),
+    // publishes its result, and combines the results of the chunks to its
+    // left (f2) until it finds an inclusive prefix. The final step (f3) is
+    // run right away, while the chunk's data is still in cache. This
+    // requires f2 to be associative.
+    struct scan_partitioner_single_pass_tag
+    {
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        // The maximal number of elements in a chunk of the single-pass scan.
+        // This keeps the part of the sequence touched by f1 small enough to
+        // still be in cache when f3 runs on it.
+        constexpr std::size_t scan_single_pass_max_chunk_size = 16384;
+
+        // Per-chunk state of the single-pass scan. The state is advanced from
+        // 'invalid' to 'aggregate' once the chunk has been reduced and to
+        // 'prefix' once its inclusive prefix is known. A chunk is marked
+        // 'failed' if it will never be completed.
+        enum class scan_chunk_state
+        {
+            invalid,
+            aggregate,
+            prefix,
+            failed
+        };
+
+        template <typename Result1>
+        struct scan_chunk_status
+        {
+            scan_chunk_status()
+              : state(scan_chunk_state::invalid)
+            {
+            }
+
+            std::atomic<scan_chunk_state> state;
+            hpx::util::optional<Result1> aggregate;
+            hpx::util::optional<Result1> prefix;
+        };
+
         ///////////////////////////////////////////////////////////////////////
         // The static partitioner simply spawns one chunk of iterations for
         // each available core.
@@ -297,6 +345,184 @@ namespace hpx { namespace parallel { namespace util {
 #endif
             }
 
+            template <typename ExPolicy_, typename FwdIter, typename T,
+                typename F1, typename F2, typename F3, typename F4>
+            static R call(scan_partitioner_single_pass_tag, ExPolicy_ policy,
+                FwdIter first, std::size_t count, T&& init, F1&& f1, F2&& f2,
+                F3&& f3, F4&& f4)
+            {
+#if defined(HPX_COMPUTE_DEVICE_CODE)
+                HPX_UNUSED(policy);
+                HPX_UNUSED(first);
+                HPX_UNUSED(count);
+                HPX_UNUSED(init);
+                HPX_UNUSED(f1);
+                HPX_UNUSED(f2);
+                HPX_UNUSED(f3);
+                HPX_UNUSED(f4);
+                HPX_ASSERT(false);
+                return R();
+#else
+                // inform parameter traits
+                scoped_executor_parameters scoped_params(
+                    policy.parameters(), policy.executor());
+
+                std::vector<hpx::shared_future<Result1>> workitems;
+                std::vector<hpx::future<Result2>> finalitems;
+                std::list<std::exception_ptr> errors;
+
+                // the workers refer to the state below, it has to outlive
+                // all of them
+                std::vector<hpx::tuple<FwdIter, std::size_t>> chunks;
+                std::vector<status_type> status;
+                std::atomic<std::size_t> next_chunk(0);
+                std::atomic<bool> failed(false);
+
+                std::vector<hpx::future<void>> workers;
+                std::exception_ptr scheduling_error;
+                try
+                {
+                    // pre-initialize first intermediate result
+                    workitems.push_back(
+                        make_ready_future(std::forward<T>(init)));
+
+                    HPX_ASSERT(count > 0);
+                    FwdIter first_ = first;
+                    std::size_t count_ = count;
+
+                    // estimate a chunk size based on number of cores used
+                    typedef typename execution::extract_has_variable_chunk_size<
+                        parameters_type>::type has_variable_chunk_size;
+
+                    auto shape = detail::get_bulk_iteration_shape(
+                        has_variable_chunk_size(), policy, workitems, f1, first,
+                        count, 1);
+
+                    // If the size of count was enough to warrant testing for a
+                    // chunk, the tested chunk has been reduced already, it
+                    // becomes the first chunk.
+                    bool const tested = workitems.size() == 2;
+                    if (tested)
+                    {
+                        HPX_ASSERT(count_ > count);
+                        chunks.emplace_back(first_, count_ - count);
+                    }
+
+                    // split the partitions into chunks small enough to stay
+                    // in cache between the first and the third step
+                    for (auto const& elem : shape)
+                    {
+                        FwdIter it = hpx::get<0>(elem);
+                        std::size_t size = hpx::get<1>(elem);
+
+                        std::size_t const parts =
+                            (size + scan_single_pass_max_chunk_size - 1) /
+                            scan_single_pass_max_chunk_size;
+                        std::size_t const part_size =
+                            (size + parts - 1) / parts;
+
+                        while (size != 0)
+                        {
+                            std::size_t const curr =
+                                (std::min)(part_size, size);
+                            chunks.emplace_back(it, curr);
+                            std::advance(it, curr);
+                            size -= curr;
+                        }
+                    }
+
+                    std::size_t const num_chunks = chunks.size();
+
+                    workitems.resize(num_chunks + 1);
+                    finalitems.resize(num_chunks);
+
+                    // the initial value acts as the inclusive prefix of a
+                    // virtual chunk to the left of the first one
+                    status = std::vector<status_type>(num_chunks + 1);
+                    status[0].data_.prefix = workitems[0].get();
+                    status[0].data_.state.store(
+                        scan_chunk_state::prefix, std::memory_order_relaxed);
+
+                    if (tested)
+                    {
+                        Result1 aggregate = workitems[1].get();
+                        finish_chunk(status, 1, hpx::get<0>(chunks[0]),
+                            hpx::get<1>(chunks[0]), std::move(aggregate), f2,
+                            f3, workitems, finalitems);
+                        ++next_chunk;
+                    }
+
+                    // Every worker repeatedly takes the next chunk and runs
+                    // all steps of the scan on it. Chunks are handed out in
+                    // order, thus the look-back waits only for chunks that
+                    // are being worked on.
+                    auto worker = [&, f1, f2, f3]() mutable {
+                        while (!failed.load(std::memory_order_relaxed))
+                        {
+                            std::size_t const i = next_chunk++;
+                            if (i >= num_chunks)
+                                break;
+
+                            try
+                            {
+                                FwdIter it = hpx::get<0>(chunks[i]);
+                                std::size_t size = hpx::get<1>(chunks[i]);
+
+                                if (!finish_chunk(status, i + 1, it, size,
+                                        f1(it, size), f2, f3, workitems,
+                                        finalitems))
+                                {
+                                    // a chunk to the left has failed
+                                    break;
+                                }
+                            }
+                            catch (...)
+                            {
+                                status[i + 1].data_.state.store(
+                                    scan_chunk_state::failed,
+                                    std::memory_order_release);
+                                failed.store(true, std::memory_order_relaxed);
+                                throw;
+                            }
+                        }
+                    };
+
+                    std::size_t const cores = execution::processing_units_count(
+                        policy.parameters(), policy.executor());
+                    std::size_t const num_workers =
+                        (std::min)(cores, num_chunks - next_chunk.load());
+
+                    workers.reserve(num_workers);
+                    for (std::size_t i = 0; i != num_workers; ++i)
+                    {
+                        workers.push_back(execution::async_execute(
+                            policy.executor(), worker));
+                    }
+
+                    scoped_params.mark_end_of_scheduling();
+                }
+                catch (...)
+                {
+                    scheduling_error = std::current_exception();
+                }
+
+                // wait for all workers to finish before touching any errors
+                hpx::wait_all(workers);
+
+                if (scheduling_error)
+                {
+                    handle_local_exceptions::call(scheduling_error, errors);
+                }
+
+                // The intermediate results are incomplete if any of the
+                // workers has failed, always rethrow in this case.
+                handle_local_exceptions::call(workers, errors);
+
+                return reduce(std::move(workitems), std::move(finalitems),
+                    std::move(errors), std::forward<F4>(f4));
+#endif
+            }
+
             template <typename ExPolicy_, typename FwdIter, typename T,
                 typename F1, typename F2, typename F3, typename F4>
             static R call(ExPolicy_&& policy, FwdIter first, std::size_t count,
@@ -309,6 +535,84 @@ namespace hpx { namespace parallel { namespace util {
             }
 
         private:
+            using status_type =
+                hpx::util::cache_aligned_data<scan_chunk_status<Result1>>;
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+            // Publish the reduction result of chunk 'i', look back to find its
+            // exclusive prefix, publish its inclusive prefix, and run the final
+            // step on it. Returns false if a chunk to the left has failed.
+            template <typename FwdIter, typename F2, typename F3>
+            static bool finish_chunk(std::vector<status_type>& status,
+                std::size_t i, FwdIter it, std::size_t size, Result1 aggregate,
+                F2& f2, F3& f3,
+                std::vector<hpx::shared_future<Result1>>& workitems,
+                std::vector<hpx::future<Result2>>& finalitems)
+            {
+                HPX_ASSERT(i != 0);
+
+                scan_chunk_status<Result1>& curr = status[i].data_;
+                curr.aggregate = aggregate;
+                curr.state.store(
+                    scan_chunk_state::aggregate, std::memory_order_release);
+
+                // combine the results of the chunks to the left until an
+                // inclusive prefix is found
+                hpx::util::optional<Result1> prev;
+                for (std::size_t j = i - 1; /**/; --j)
+                {
+                    scan_chunk_status<Result1> const& left = status[j].data_;
+
+                    scan_chunk_state state = scan_chunk_state::invalid;
+                    hpx::util::yield_while([&]() {
+                        state = left.state.load(std::memory_order_acquire);
+                        return state == scan_chunk_state::invalid;
+                    });
+
+                    if (state == scan_chunk_state::failed)
+                    {
+                        curr.state.store(scan_chunk_state::failed,
+                            std::memory_order_release);
+                        return false;
+                    }
+
+                    Result1 const& value = state == scan_chunk_state::prefix ?
+                        *left.prefix :
+                        *left.aggregate;
+
+                    if (prev)
+                    {
+                        prev = f2(make_ready_future(value).share(),
+                            make_ready_future(std::move(*prev)).share());
+                    }
+                    else
+                    {
+                        prev = value;
+                    }
+
+                    if (state == scan_chunk_state::prefix)
+                        break;
+
+                    HPX_ASSERT(j != 0);
+                }
+
+                hpx::shared_future<Result1> prev_result =
+                    make_ready_future(std::move(*prev)).share();
+                hpx::shared_future<Result1> curr_result =
+                    make_ready_future(std::move(aggregate)).share();
+
+                curr.prefix = f2(prev_result, curr_result);
+                curr.state.store(
+                    scan_chunk_state::prefix, std::memory_order_release);
+
+                workitems[i] = make_ready_future(*curr.prefix).share();
+                finalitems[i - 1] = dataflow(
+                    hpx::launch::sync, f3, it, size, prev_result, curr_result);
+
+                return true;
+            }
+#endif
+
             template <typename F>
             static R reduce(
                 std::vector<hpx::shared_future<Result1>>&& workitems,
@@ -376,6 +680,9 @@ namespace hpx { namespace parallel { namespace util {
     // Result1:     intermediate result type of first and second step
     // Result2:     intermediate result of the third step
     // ScanPartTag: select appropriate policy of scan partitioner
+    //              (scan_partitioner_normal_tag,
+    //              scan_partitioner_sequential_f3_tag, or
+    //              scan_partitioner_single_pass_tag)
     template <typename ExPolicy, typename R = void, typename Result1 = R,
         typename Result2 = void,
         typename ScanPartTag = scan_partitioner_normal_tag>
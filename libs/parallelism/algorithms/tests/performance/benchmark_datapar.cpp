@@ -0,0 +1,191 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the data parallel execution policies (dataseq and
+// datapar) with their scalar counterparts (seq and par) for transform,
+// for_each, and transform_reduce.
+
+#include <hpx/execution.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/datapar.hpp>
+#include <hpx/init.hpp>
+#include <hpx/parallel/algorithms/for_each.hpp>
+#include <hpx/parallel/algorithms/transform.hpp>
+#include <hpx/parallel/algorithms/transform_reduce.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+template <typename F>
+std::uint64_t measure(std::size_t test_count, F&& f)
+{
+    std::uint64_t total = 0;
+    for (std::size_t i = 0; i != test_count; ++i)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+        f();
+        auto end = std::chrono::high_resolution_clock::now();
+        total += static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+                .count());
+    }
+    return total / test_count;
+}
+
+void report(char const* name, std::uint64_t elapsed)
+{
+    std::cout << name << (elapsed / 1000) << " [us]" << std::endl;
+}
+
+struct plus
+{
+    template <typename T1, typename T2>
+    auto operator()(T1 const& t1, T2 const& t2) const -> decltype(t1 + t2)
+    {
+        return t1 + t2;
+    }
+};
+
+struct multiplies
+{
+    template <typename T1, typename T2>
+    auto operator()(T1 const& t1, T2 const& t2) const -> decltype(t1 * t2)
+    {
+        return t1 * t2;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void run_transform(char const* name, ExPolicy&& policy,
+    std::vector<float> const& A, std::vector<float>& B, std::size_t test_count)
+{
+    report(name, measure(test_count, [&]() {
+        hpx::transform(policy, A.begin(), A.end(), B.begin(),
+            [](auto const& x) { return x * 2.0f + 1.0f; });
+    }));
+}
+
+template <typename ExPolicy>
+void run_for_each(char const* name, ExPolicy&& policy, std::vector<float>& B,
+    std::size_t test_count)
+{
+    report(name, measure(test_count, [&]() {
+        hpx::for_each(policy, B.begin(), B.end(), [](auto& x) { x *= 0.5f; });
+    }));
+}
+
+template <typename ExPolicy>
+void run_transform_reduce(char const* name, ExPolicy&& policy,
+    std::vector<float> const& A, std::vector<float> const& B,
+    std::size_t test_count)
+{
+    float result = 0.0f;
+    report(name, measure(test_count, [&]() {
+        result = hpx::transform_reduce(policy, A.begin(), A.end(), B.begin(),
+            0.0f, ::multiplies(), ::plus());
+    }));
+
+    // keep the result alive
+    if (result == -1.0f)
+    {
+        std::cout << "unexpected result\n";
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::size_t const vector_size = vm["vector_size"].as<std::size_t>();
+    std::size_t const test_count = vm["test_count"].as<std::size_t>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    std::uniform_real_distribution<float> dis(-1.0f, 1.0f);
+
+    std::vector<float> A(vector_size);
+    for (auto& value : A)
+    {
+        value = dis(gen);
+    }
+    std::vector<float> B(vector_size, 1.0f);
+
+    using namespace hpx::execution;
+
+    std::cout << "------------ transform (" << vector_size
+              << " elements) ------------\n";
+    run_transform("hpx::transform(seq)              :", seq, A, B, test_count);
+    run_transform("hpx::transform(dataseq)          :", dataseq, A, B,
+        test_count);
+    run_transform("hpx::transform(par)              :", par, A, B, test_count);
+    run_transform("hpx::transform(datapar)          :", datapar, A, B,
+        test_count);
+
+    std::cout << "\n------------ for_each (" << vector_size
+              << " elements) ------------\n";
+    run_for_each("hpx::for_each(seq)               :", seq, B, test_count);
+    run_for_each("hpx::for_each(dataseq)           :", dataseq, B, test_count);
+    run_for_each("hpx::for_each(par)               :", par, B, test_count);
+    run_for_each("hpx::for_each(datapar)           :", datapar, B, test_count);
+
+    std::cout << "\n------------ transform_reduce (" << vector_size
+              << " elements) ------------\n";
+    run_transform_reduce(
+        "hpx::transform_reduce(seq)       :", seq, A, B, test_count);
+    run_transform_reduce(
+        "hpx::transform_reduce(dataseq)   :", dataseq, A, B, test_count);
+    run_transform_reduce(
+        "hpx::transform_reduce(par)       :", par, A, B, test_count);
+    run_transform_reduce(
+        "hpx::transform_reduce(datapar)   :", datapar, A, B, test_count);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+         "the random number generator seed to use for this run")
+        ("vector_size", value<std::size_t>()->default_value(
+#if defined(HPX_DEBUG)
+            100000
+#else
+            10000000
+#endif
+            ), "number of elements to process")
+        ("test_count", value<std::size_t>()->default_value(10),
+         "number of tests to be averaged");
+    // clang-format on
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    return hpx::init(argc, argv, init_args);
+}
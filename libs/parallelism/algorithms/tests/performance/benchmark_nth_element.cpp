@@ -0,0 +1,168 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares hpx::nth_element and hpx::partial_sort_copy with
+// their counterparts from the standard library.
+
+#include <hpx/execution.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/init.hpp>
+#include <hpx/parallel/algorithms/nth_element.hpp>
+#include <hpx/parallel/algorithms/partial_sort_copy.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+template <typename F>
+std::uint64_t measure(std::size_t test_count, F&& f)
+{
+    std::uint64_t total = 0;
+    for (std::size_t i = 0; i != test_count; ++i)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+        f();
+        auto end = std::chrono::high_resolution_clock::now();
+        total += static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+                .count());
+    }
+    return total / test_count;
+}
+
+void report(char const* name, std::uint64_t elapsed)
+{
+    std::cout << name << (elapsed / 1000) << " [us]" << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void run_nth_element_benchmark(std::vector<std::uint64_t> const& A,
+    std::size_t nth, std::size_t test_count)
+{
+    std::cout << "------------ nth_element (" << A.size()
+              << " elements, nth = " << nth << ") ------------\n";
+
+    std::vector<std::uint64_t> B;
+
+    report("std::nth_element            :", measure(test_count, [&]() {
+        B = A;
+        std::nth_element(B.begin(), B.begin() + nth, B.end());
+    }));
+
+    report("hpx::nth_element(seq)       :", measure(test_count, [&]() {
+        B = A;
+        hpx::nth_element(
+            hpx::execution::seq, B.begin(), B.begin() + nth, B.end());
+    }));
+
+    report("hpx::nth_element(par)       :", measure(test_count, [&]() {
+        B = A;
+        hpx::nth_element(
+            hpx::execution::par, B.begin(), B.begin() + nth, B.end());
+    }));
+
+    std::cout << "\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void run_partial_sort_copy_benchmark(std::vector<std::uint64_t> const& A,
+    std::size_t d_size, std::size_t test_count)
+{
+    std::cout << "------------ partial_sort_copy (" << A.size()
+              << " elements, " << d_size << " copied) ------------\n";
+
+    std::vector<std::uint64_t> B(d_size);
+
+    report("std::partial_sort_copy      :", measure(test_count, [&]() {
+        std::partial_sort_copy(A.begin(), A.end(), B.begin(), B.end());
+    }));
+
+    report("hpx::partial_sort_copy(seq) :", measure(test_count, [&]() {
+        hpx::partial_sort_copy(
+            hpx::execution::seq, A.begin(), A.end(), B.begin(), B.end());
+    }));
+
+    report("hpx::partial_sort_copy(par) :", measure(test_count, [&]() {
+        hpx::partial_sort_copy(
+            hpx::execution::par, A.begin(), A.end(), B.begin(), B.end());
+    }));
+
+    if (!std::is_sorted(B.begin(), B.end()))
+    {
+        std::cout << "Error: sequence is not sorted!\n";
+    }
+    std::cout << "\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::size_t const vector_size = vm["vector_size"].as<std::size_t>();
+    std::size_t const test_count = vm["test_count"].as<std::size_t>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    std::uniform_int_distribution<std::uint64_t> dis;
+    std::vector<std::uint64_t> A(vector_size);
+    for (auto& value : A)
+    {
+        value = dis(gen);
+    }
+
+    run_nth_element_benchmark(A, vector_size / 2, test_count);
+    run_nth_element_benchmark(A, vector_size / 100, test_count);
+
+    run_partial_sort_copy_benchmark(A, 100, test_count);
+    run_partial_sort_copy_benchmark(A, vector_size / 100, test_count);
+    run_partial_sort_copy_benchmark(A, vector_size / 2, test_count);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+         "the random number generator seed to use for this run")
+        ("vector_size", value<std::size_t>()->default_value(
+#if defined(HPX_DEBUG)
+            100000
+#else
+            10000000
+#endif
+            ), "number of elements to use")
+        ("test_count", value<std::size_t>()->default_value(10),
+         "number of tests to be averaged");
+    // clang-format on
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    return hpx::init(argc, argv, init_args);
+}
@@ -0,0 +1,229 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the radix sort used by hpx::parallel::sort and
+// hpx::parallel::sort_by_key for arithmetic keys with the comparison based
+// sort (selected by using a lambda as the comparison function) and with
+// std::sort.
+
+#include <hpx/execution.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/init.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/algorithms/sort_by_key.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+template <typename T>
+std::vector<T> random_values(std::size_t size, std::true_type)
+{
+    std::uniform_int_distribution<T> dis(
+        (std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)());
+
+    std::vector<T> v(size);
+    for (auto& value : v)
+    {
+        value = dis(gen);
+    }
+    return v;
+}
+
+template <typename T>
+std::vector<T> random_values(std::size_t size, std::false_type)
+{
+    std::uniform_real_distribution<T> dis(T(-1e6), T(1e6));
+
+    std::vector<T> v(size);
+    for (auto& value : v)
+    {
+        value = dis(gen);
+    }
+    return v;
+}
+
+template <typename F>
+std::uint64_t measure(std::size_t test_count, F&& f)
+{
+    std::uint64_t total = 0;
+    for (std::size_t i = 0; i != test_count; ++i)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+        f();
+        auto end = std::chrono::high_resolution_clock::now();
+        total += static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+                .count());
+    }
+    return total / test_count;
+}
+
+void report(char const* name, std::uint64_t elapsed)
+{
+    std::cout << name << (elapsed / 1000000) << " [ms]" << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void run_sort_benchmark(
+    char const* type_name, std::size_t vector_size, std::size_t test_count)
+{
+    std::cout << "------------ sort " << type_name << " ("
+              << vector_size << " elements) ------------\n";
+
+    std::vector<T> const A =
+        random_values<T>(vector_size, std::is_integral<T>());
+    std::vector<T> B;
+
+    auto less = [](T lhs, T rhs) { return lhs < rhs; };
+
+    report("std::sort                          :",
+        measure(test_count, [&]() {
+            B = A;
+            std::sort(B.begin(), B.end());
+        }));
+
+    report("hpx::parallel::sort(seq), compare  :",
+        measure(test_count, [&]() {
+            B = A;
+            hpx::parallel::sort(hpx::execution::seq, B.begin(), B.end(), less);
+        }));
+
+    report("hpx::parallel::sort(seq), radix    :",
+        measure(test_count, [&]() {
+            B = A;
+            hpx::parallel::sort(hpx::execution::seq, B.begin(), B.end());
+        }));
+
+    report("hpx::parallel::sort(par), compare  :",
+        measure(test_count, [&]() {
+            B = A;
+            hpx::parallel::sort(hpx::execution::par, B.begin(), B.end(), less);
+        }));
+
+    report("hpx::parallel::sort(par), radix    :",
+        measure(test_count, [&]() {
+            B = A;
+            hpx::parallel::sort(hpx::execution::par, B.begin(), B.end());
+        }));
+
+    if (!std::is_sorted(B.begin(), B.end()))
+    {
+        std::cout << "Error: sequence is not sorted!\n";
+    }
+    std::cout << "\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Key>
+void run_sort_by_key_benchmark(
+    char const* type_name, std::size_t vector_size, std::size_t test_count)
+{
+    std::cout << "------------ sort_by_key " << type_name << " ("
+              << vector_size << " elements) ------------\n";
+
+    std::vector<Key> const keys =
+        random_values<Key>(vector_size, std::is_integral<Key>());
+    std::vector<std::uint64_t> values(vector_size);
+    std::iota(values.begin(), values.end(), std::uint64_t(0));
+
+    std::vector<Key> K;
+    std::vector<std::uint64_t> V;
+
+    auto less = [](Key lhs, Key rhs) { return lhs < rhs; };
+
+    report("hpx::parallel::sort_by_key, compare:",
+        measure(test_count, [&]() {
+            K = keys;
+            V = values;
+            hpx::parallel::sort_by_key(
+                hpx::execution::par, K.begin(), K.end(), V.begin(), less);
+        }));
+
+    report("hpx::parallel::sort_by_key, radix  :",
+        measure(test_count, [&]() {
+            K = keys;
+            V = values;
+            hpx::parallel::sort_by_key(
+                hpx::execution::par, K.begin(), K.end(), V.begin());
+        }));
+
+    if (!std::is_sorted(K.begin(), K.end()))
+    {
+        std::cout << "Error: sequence is not sorted!\n";
+    }
+    std::cout << "\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::size_t const vector_size = vm["vector_size"].as<std::size_t>();
+    std::size_t const test_count = vm["test_count"].as<std::size_t>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    run_sort_benchmark<std::uint32_t>("uint32_t", vector_size, test_count);
+    run_sort_benchmark<std::int64_t>("int64_t", vector_size, test_count);
+    run_sort_benchmark<float>("float", vector_size, test_count);
+    run_sort_benchmark<double>("double", vector_size, test_count);
+
+#if defined(HPX_HAVE_TUPLE_RVALUE_SWAP)
+    run_sort_by_key_benchmark<std::uint32_t>(
+        "uint32_t", vector_size, test_count);
+    run_sort_by_key_benchmark<double>("double", vector_size, test_count);
+#endif
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+         "the random number generator seed to use for this run")
+        ("vector_size", value<std::size_t>()->default_value(
+#if defined(HPX_DEBUG)
+            100000
+#else
+            10000000
+#endif
+            ), "number of elements to sort")
+        ("test_count", value<std::size_t>()->default_value(10),
+         "number of tests to be averaged");
+    // clang-format on
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    return hpx::init(argc, argv, init_args);
+}
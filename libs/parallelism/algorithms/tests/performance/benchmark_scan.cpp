@@ -0,0 +1,157 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the parallel scan algorithms (which run in a single
+// pass over the data) with std::partial_sum and the sequential versions. The
+// default vector size is chosen such that the data does not fit into cache.
+
+#include <hpx/execution.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/init.hpp>
+#include <hpx/parallel/algorithms/exclusive_scan.hpp>
+#include <hpx/parallel/algorithms/inclusive_scan.hpp>
+#include <hpx/parallel/algorithms/transform_inclusive_scan.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+template <typename F>
+std::uint64_t measure(std::size_t test_count, F&& f)
+{
+    std::uint64_t total = 0;
+    for (std::size_t i = 0; i != test_count; ++i)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+        f();
+        auto end = std::chrono::high_resolution_clock::now();
+        total += static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+                .count());
+    }
+    return total / test_count;
+}
+
+void report(char const* name, std::uint64_t elapsed)
+{
+    std::cout << name << (elapsed / 1000000) << " [ms]" << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void run_scan_benchmark(
+    char const* type_name, std::size_t vector_size, std::size_t test_count)
+{
+    std::cout << "------------ scan " << type_name << " (" << vector_size
+              << " elements) ------------\n";
+
+    std::uniform_int_distribution<int> dis(0, 100);
+
+    std::vector<T> A(vector_size);
+    for (auto& value : A)
+    {
+        value = T(dis(gen));
+    }
+    std::vector<T> B(vector_size);
+    std::vector<T> C(vector_size);
+
+    report("std::partial_sum                      :",
+        measure(test_count,
+            [&]() { std::partial_sum(A.begin(), A.end(), C.begin()); }));
+
+    report("hpx::parallel::inclusive_scan(seq)    :",
+        measure(test_count, [&]() {
+            hpx::parallel::inclusive_scan(hpx::execution::seq, A.begin(),
+                A.end(), B.begin(), std::plus<T>());
+        }));
+
+    report("hpx::parallel::inclusive_scan(par)    :",
+        measure(test_count, [&]() {
+            hpx::parallel::inclusive_scan(hpx::execution::par, A.begin(),
+                A.end(), B.begin(), std::plus<T>());
+        }));
+
+    if (B != C)
+    {
+        std::cout << "Error: inclusive_scan produced a wrong result!\n";
+    }
+
+    report("hpx::parallel::exclusive_scan(par)    :",
+        measure(test_count, [&]() {
+            hpx::parallel::exclusive_scan(
+                hpx::execution::par, A.begin(), A.end(), B.begin(), T(0));
+        }));
+
+    report("hpx::parallel::transform_inclusive_scan(par):",
+        measure(test_count, [&]() {
+            hpx::parallel::transform_inclusive_scan(hpx::execution::par,
+                A.begin(), A.end(), B.begin(), std::plus<T>(),
+                [](T v) { return 2 * v; }, T(0));
+        }));
+
+    std::cout << "\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::size_t const vector_size = vm["vector_size"].as<std::size_t>();
+    std::size_t const test_count = vm["test_count"].as<std::size_t>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    run_scan_benchmark<std::int32_t>("int32_t", vector_size, test_count);
+    run_scan_benchmark<std::int64_t>("int64_t", vector_size, test_count);
+    run_scan_benchmark<double>("double", vector_size, test_count);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+         "the random number generator seed to use for this run")
+        ("vector_size", value<std::size_t>()->default_value(
+#if defined(HPX_DEBUG)
+            1000000
+#else
+            100000000
+#endif
+            ), "number of elements to scan")
+        ("test_count", value<std::size_t>()->default_value(10),
+         "number of tests to be averaged");
+    // clang-format on
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    return hpx::init(argc, argv, init_args);
+}
@@ -0,0 +1,242 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_histogram.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// the elements remember their original position to verify the stability
+typedef std::pair<std::size_t, std::size_t> element;
+
+struct get_bucket
+{
+    std::size_t num_buckets;
+
+    std::size_t operator()(element const& e) const
+    {
+        return e.first % num_buckets;
+    }
+};
+
+std::vector<element> random_elements(std::size_t size)
+{
+    std::uniform_int_distribution<std::size_t> dis(0, 1000000);
+
+    std::vector<element> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        c[i] = element(dis(gen), i);
+    }
+    return c;
+}
+
+// the stable grouping of the elements and the offsets of the buckets
+std::pair<std::vector<element>, std::vector<std::size_t>> bucket_reference(
+    std::vector<element> const& c, std::size_t num_buckets)
+{
+    std::vector<std::vector<element>> buckets(num_buckets);
+    for (element const& e : c)
+    {
+        buckets[get_bucket{num_buckets}(e)].push_back(e);
+    }
+
+    std::vector<element> d;
+    std::vector<std::size_t> offsets;
+    for (auto const& bucket : buckets)
+    {
+        offsets.push_back(d.size());
+        d.insert(d.end(), bucket.begin(), bucket.end());
+    }
+    offsets.push_back(d.size());
+
+    return std::make_pair(std::move(d), std::move(offsets));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename IteratorTag>
+void test_bucket_by_key(ExPolicy policy, IteratorTag, std::size_t size,
+    std::size_t num_buckets)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    typedef std::vector<element>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<element> c = random_elements(size);
+    std::vector<element> d(size);
+    std::vector<std::size_t> offsets;
+
+    auto result = hpx::experimental::bucket_by_key(policy,
+        iterator(std::begin(c)), iterator(std::end(c)), std::begin(d),
+        num_buckets, get_bucket{num_buckets}, std::back_inserter(offsets));
+
+    auto expected = bucket_reference(c, num_buckets);
+
+    HPX_TEST(result == std::end(d));
+    HPX_TEST(d == expected.first);
+    HPX_TEST(offsets == expected.second);
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_bucket_by_key_async(ExPolicy policy, IteratorTag, std::size_t size,
+    std::size_t num_buckets)
+{
+    typedef std::vector<element>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<element> c = random_elements(size);
+    std::vector<element> d(size);
+    std::vector<std::size_t> offsets(num_buckets + 1);
+
+    auto f = hpx::experimental::bucket_by_key(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), std::begin(d), num_buckets,
+        get_bucket{num_buckets}, std::begin(offsets));
+
+    HPX_TEST(f.get() == std::end(d));
+
+    auto expected = bucket_reference(c, num_buckets);
+    HPX_TEST(d == expected.first);
+    HPX_TEST(offsets == expected.second);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename IteratorTag>
+void test_bucket_by_key_exception(ExPolicy policy, IteratorTag,
+    std::size_t size)
+{
+    typedef std::vector<element>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<element> c = random_elements(size);
+    std::vector<element> d(size);
+    std::vector<std::size_t> offsets(2);
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::experimental::bucket_by_key(policy, iterator(std::begin(c)),
+            iterator(std::end(c)), std::begin(d), 2,
+            [](element const&) -> std::size_t {
+                throw std::runtime_error("test");
+            },
+            std::begin(offsets));
+
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const& e)
+    {
+        caught_exception = true;
+        HPX_TEST(e.size() != 0);
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename IteratorTag>
+void test_bucket_by_key()
+{
+    using namespace hpx::execution;
+
+    for (std::size_t size :
+        {std::size_t(0), std::size_t(1), std::size_t(10007),
+            std::size_t(1000003)})
+    {
+        // many buckets limit the number of chunks
+        for (std::size_t num_buckets :
+            {std::size_t(1), std::size_t(16), std::size_t(1000),
+                std::size_t(300000)})
+        {
+            test_bucket_by_key(seq, IteratorTag(), size, num_buckets);
+            test_bucket_by_key(par, IteratorTag(), size, num_buckets);
+
+            test_bucket_by_key_async(
+                seq(task), IteratorTag(), size, num_buckets);
+            test_bucket_by_key_async(
+                par(task), IteratorTag(), size, num_buckets);
+        }
+    }
+
+    test_bucket_by_key_exception(seq, IteratorTag(), 10007);
+    test_bucket_by_key_exception(par, IteratorTag(), 1000003);
+}
+
+void test_bucket_by_key_without_policy()
+{
+    std::vector<element> c = random_elements(10007);
+    std::vector<element> d(c.size());
+    std::vector<std::size_t> offsets(8);
+
+    auto result = hpx::experimental::bucket_by_key(std::begin(c), std::end(c),
+        std::begin(d), 7, get_bucket{7}, std::begin(offsets));
+
+    auto expected = bucket_reference(c, 7);
+
+    HPX_TEST(result == std::end(d));
+    HPX_TEST(d == expected.first);
+    HPX_TEST(offsets == expected.second);
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_bucket_by_key<std::random_access_iterator_tag>();
+    test_bucket_by_key<std::forward_iterator_tag>();
+
+    test_bucket_by_key_without_policy();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
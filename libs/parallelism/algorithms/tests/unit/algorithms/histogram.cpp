@@ -0,0 +1,234 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_histogram.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// values in [-1, num_bins + 1) and a few NaN, bin i of the uniform bins
+// covering [0, num_bins) is [i, i + 1)
+std::vector<double> random_values(std::size_t size, std::size_t num_bins)
+{
+    std::uniform_real_distribution<double> dis(-1.0, double(num_bins) + 1.0);
+
+    std::vector<double> c(size);
+    for (auto& v : c)
+    {
+        v = dis(gen);
+    }
+    if (size > 2)
+    {
+        c[size / 2] = std::numeric_limits<double>::quiet_NaN();
+        c[size - 1] = double(num_bins);
+    }
+    return c;
+}
+
+std::vector<std::size_t> uniform_histogram(
+    std::vector<double> const& c, std::size_t num_bins)
+{
+    std::vector<std::size_t> counts(num_bins, 0);
+    for (double v : c)
+    {
+        if (v >= 0.0 && v < double(num_bins))
+            ++counts[std::size_t(std::floor(v))];
+    }
+    return counts;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename IteratorTag>
+void test_histogram_uniform(ExPolicy policy, IteratorTag, std::size_t size,
+    std::size_t num_bins)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    typedef std::vector<double>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<double> c = random_values(size, num_bins);
+    std::vector<std::size_t> counts(num_bins + 1, std::size_t(-1));
+
+    auto result = hpx::experimental::histogram(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), num_bins, 0.0, double(num_bins),
+        std::begin(counts));
+
+    HPX_TEST(result == std::next(std::begin(counts), num_bins));
+    HPX_TEST_EQ(counts.back(), std::size_t(-1));
+
+    counts.pop_back();
+    HPX_TEST(counts == uniform_histogram(c, num_bins));
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_histogram_uniform_async(ExPolicy policy, IteratorTag,
+    std::size_t size, std::size_t num_bins)
+{
+    typedef std::vector<double>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<double> c = random_values(size, num_bins);
+    std::vector<std::size_t> counts(num_bins);
+
+    auto f = hpx::experimental::histogram(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), num_bins, 0.0, double(num_bins),
+        std::begin(counts));
+
+    HPX_TEST(f.get() == std::end(counts));
+    HPX_TEST(counts == uniform_histogram(c, num_bins));
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_histogram_edges(ExPolicy policy, IteratorTag, std::size_t size,
+    std::size_t num_bins)
+{
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::uniform_int_distribution<int> dis(-100, 10000);
+
+    std::vector<int> c(size);
+    for (auto& v : c)
+    {
+        v = dis(gen);
+    }
+
+    std::vector<int> edges(num_bins + 1);
+    for (auto& e : edges)
+    {
+        e = dis(gen);
+    }
+    std::sort(std::begin(edges), std::end(edges));
+
+    std::vector<std::size_t> expected(num_bins, 0);
+    for (int v : c)
+    {
+        for (std::size_t b = 0; b != num_bins; ++b)
+        {
+            if (v >= edges[b] && v < edges[b + 1])
+            {
+                ++expected[b];
+                break;
+            }
+        }
+    }
+
+    std::vector<std::size_t> counts;
+    hpx::experimental::histogram(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), std::begin(edges), std::end(edges),
+        std::back_inserter(counts));
+
+    HPX_TEST(counts == expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename IteratorTag>
+void test_histogram()
+{
+    using namespace hpx::execution;
+
+    for (std::size_t size :
+        {std::size_t(0), std::size_t(1), std::size_t(10007),
+            std::size_t(1000003)})
+    {
+        // the number of bins decides between private and atomic counters
+        for (std::size_t num_bins :
+            {std::size_t(1), std::size_t(100), std::size_t(100000)})
+        {
+            test_histogram_uniform(seq, IteratorTag(), size, num_bins);
+            test_histogram_uniform(par, IteratorTag(), size, num_bins);
+            test_histogram_uniform(par_unseq, IteratorTag(), size, num_bins);
+
+            test_histogram_uniform_async(
+                seq(task), IteratorTag(), size, num_bins);
+            test_histogram_uniform_async(
+                par(task), IteratorTag(), size, num_bins);
+        }
+
+        test_histogram_edges(seq, IteratorTag(), size, 17);
+        test_histogram_edges(par, IteratorTag(), size, 17);
+    }
+}
+
+void test_histogram_without_policy()
+{
+    std::vector<double> c = random_values(10007, 100);
+    std::vector<std::size_t> counts(100);
+
+    hpx::experimental::histogram(std::begin(c), std::end(c), 100, 0.0, 100.0,
+        std::begin(counts));
+    HPX_TEST(counts == uniform_histogram(c, 100));
+
+    std::vector<double> edges = {0.0, 0.5, 50.0, 100.0};
+    std::vector<std::size_t> edge_counts(3);
+    hpx::experimental::histogram(std::begin(c), std::end(c), std::begin(edges),
+        std::end(edges), std::begin(edge_counts));
+
+    HPX_TEST_EQ(edge_counts[0] + edge_counts[1] + edge_counts[2],
+        std::accumulate(std::begin(counts), std::end(counts), std::size_t(0)));
+    HPX_TEST_EQ(edge_counts[2],
+        std::accumulate(
+            std::begin(counts) + 50, std::end(counts), std::size_t(0)));
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_histogram<std::random_access_iterator_tag>();
+    test_histogram<std::forward_iterator_tag>();
+
+    test_histogram_without_policy();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
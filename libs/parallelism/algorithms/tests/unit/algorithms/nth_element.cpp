@@ -0,0 +1,189 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/execution.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/nth_element.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+template <typename T, typename Comp>
+void verify_nth_element(std::vector<T> const& orig, std::vector<T> const& v,
+    std::size_t nth, Comp comp)
+{
+    std::vector<T> sorted = orig;
+    std::sort(sorted.begin(), sorted.end(), comp);
+
+    HPX_TEST(v[nth] == sorted[nth]);
+    for (std::size_t i = 0; i != nth; ++i)
+    {
+        HPX_TEST(!comp(v[nth], v[i]));
+    }
+    for (std::size_t i = nth + 1; i != v.size(); ++i)
+    {
+        HPX_TEST(!comp(v[i], v[nth]));
+    }
+}
+
+template <typename ExPolicy>
+void test_nth_element(ExPolicy&& policy, std::size_t size, std::uint64_t range)
+{
+    std::uniform_int_distribution<std::uint64_t> dis(0, range);
+
+    std::vector<std::uint64_t> A(size);
+    for (auto& value : A)
+    {
+        value = dis(gen);
+    }
+
+    std::size_t const positions[] = {
+        0, size / 7, size / 2, size - size / 3 - 1, size - 1};
+    for (std::size_t nth : positions)
+    {
+        std::vector<std::uint64_t> B = A;
+        hpx::nth_element(policy, B.begin(), B.begin() + nth, B.end());
+        verify_nth_element(A, B, nth, std::less<std::uint64_t>());
+
+        B = A;
+        hpx::nth_element(policy, B.begin(), B.begin() + nth, B.end(),
+            std::greater<std::uint64_t>());
+        verify_nth_element(A, B, nth, std::greater<std::uint64_t>());
+    }
+
+    // nth == last is a no-op
+    std::vector<std::uint64_t> B = A;
+    hpx::nth_element(policy, B.begin(), B.end(), B.end());
+    HPX_TEST(A == B);
+}
+
+template <typename ExPolicy>
+void test_nth_element_async(
+    ExPolicy&& policy, std::size_t size, std::uint64_t range)
+{
+    std::uniform_int_distribution<std::uint64_t> dis(0, range);
+
+    std::vector<std::uint64_t> A(size);
+    for (auto& value : A)
+    {
+        value = dis(gen);
+    }
+
+    std::size_t const nth = size / 3;
+    std::vector<std::uint64_t> B = A;
+
+    hpx::future<void> f =
+        hpx::nth_element(policy, B.begin(), B.begin() + nth, B.end());
+    f.get();
+
+    verify_nth_element(A, B, nth, std::less<std::uint64_t>());
+}
+
+void test_nth_element_no_policy(std::size_t size)
+{
+    std::uniform_int_distribution<std::uint64_t> dis(0, 1000);
+
+    std::vector<std::uint64_t> A(size);
+    for (auto& value : A)
+    {
+        value = dis(gen);
+    }
+
+    std::size_t const nth = size / 2;
+    std::vector<std::uint64_t> B = A;
+    hpx::nth_element(B.begin(), B.begin() + nth, B.end());
+    verify_nth_element(A, B, nth, std::less<std::uint64_t>());
+}
+
+void test_nth_element_strings()
+{
+    std::vector<std::string> A(100000);
+    std::uniform_int_distribution<int> dis(0, 100000);
+    for (auto& value : A)
+    {
+        value = std::to_string(dis(gen));
+    }
+
+    std::size_t const nth = A.size() / 2;
+    std::vector<std::string> B = A;
+    hpx::nth_element(hpx::execution::par, B.begin(), B.begin() + nth, B.end(),
+        [](std::string const& lhs, std::string const& rhs) {
+            return lhs < rhs;
+        });
+    verify_nth_element(A, B, nth, std::less<std::string>());
+}
+
+void test_nth_element()
+{
+    std::size_t const sizes[] = {1, 1000, 100000, 1000000};
+    for (std::size_t size : sizes)
+    {
+        // many distinct values, and only a few distinct values
+        for (std::uint64_t range : {std::uint64_t(-1), std::uint64_t(3)})
+        {
+            test_nth_element(hpx::execution::seq, size, range);
+            test_nth_element(hpx::execution::par, size, range);
+            test_nth_element(hpx::execution::par_unseq, size, range);
+        }
+        test_nth_element_no_policy(size);
+    }
+
+    test_nth_element_async(hpx::execution::seq(hpx::execution::task),
+        1000000, std::uint64_t(-1));
+    test_nth_element_async(hpx::execution::par(hpx::execution::task),
+        1000000, std::uint64_t(-1));
+
+    test_nth_element_strings();
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_nth_element();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
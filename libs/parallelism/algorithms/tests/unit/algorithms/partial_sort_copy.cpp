@@ -0,0 +1,187 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/execution.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/partial_sort_copy.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+std::vector<std::uint64_t> random_values(std::size_t size, std::uint64_t range)
+{
+    std::uniform_int_distribution<std::uint64_t> dis(0, range);
+
+    std::vector<std::uint64_t> v(size);
+    for (auto& value : v)
+    {
+        value = dis(gen);
+    }
+    return v;
+}
+
+template <typename ExPolicy>
+void test_partial_sort_copy(
+    ExPolicy&& policy, std::size_t size, std::uint64_t range)
+{
+    std::vector<std::uint64_t> const A = random_values(size, range);
+
+    std::size_t const d_sizes[] = {
+        0, 1, size / 100 + 1, size / 2, size, size + 10};
+    for (std::size_t d_size : d_sizes)
+    {
+        std::vector<std::uint64_t> expected(d_size);
+        auto expected_end = std::partial_sort_copy(
+            A.begin(), A.end(), expected.begin(), expected.end());
+
+        std::vector<std::uint64_t> B(d_size);
+        auto result = hpx::partial_sort_copy(
+            policy, A.begin(), A.end(), B.begin(), B.end());
+
+        HPX_TEST(result - B.begin() == expected_end - expected.begin());
+        HPX_TEST(std::equal(B.begin(), result, expected.begin()));
+
+        auto result2 = hpx::partial_sort_copy(policy, A.begin(), A.end(),
+            B.begin(), B.end(), std::greater<std::uint64_t>());
+        expected_end = std::partial_sort_copy(A.begin(), A.end(),
+            expected.begin(), expected.end(), std::greater<std::uint64_t>());
+
+        HPX_TEST(result2 - B.begin() == expected_end - expected.begin());
+        HPX_TEST(std::equal(B.begin(), result2, expected.begin()));
+    }
+}
+
+template <typename ExPolicy>
+void test_partial_sort_copy_async(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<std::uint64_t> const A = random_values(size, std::uint64_t(-1));
+
+    std::size_t const d_size = size / 10;
+    std::vector<std::uint64_t> expected(d_size);
+    std::partial_sort_copy(
+        A.begin(), A.end(), expected.begin(), expected.end());
+
+    std::vector<std::uint64_t> B(d_size);
+    auto f = hpx::partial_sort_copy(
+        policy, A.begin(), A.end(), B.begin(), B.end());
+
+    HPX_TEST(f.get() == B.end());
+    HPX_TEST(B == expected);
+}
+
+void test_partial_sort_copy_forward()
+{
+    std::vector<std::uint64_t> const values =
+        random_values(300000, std::uint64_t(-1));
+    std::list<std::uint64_t> const A(values.begin(), values.end());
+
+    std::vector<std::uint64_t> expected(1000);
+    std::partial_sort_copy(
+        A.begin(), A.end(), expected.begin(), expected.end());
+
+    std::vector<std::uint64_t> B(1000);
+    hpx::partial_sort_copy(
+        hpx::execution::par, A.begin(), A.end(), B.begin(), B.end());
+    HPX_TEST(B == expected);
+
+    std::fill(B.begin(), B.end(), 0);
+    hpx::partial_sort_copy(A.begin(), A.end(), B.begin(), B.end());
+    HPX_TEST(B == expected);
+}
+
+void test_partial_sort_copy_strings()
+{
+    std::vector<std::string> A(300000);
+    std::uniform_int_distribution<int> dis(0, 100000);
+    for (auto& value : A)
+    {
+        value = std::to_string(dis(gen));
+    }
+
+    std::vector<std::string> expected(5000);
+    std::partial_sort_copy(
+        A.begin(), A.end(), expected.begin(), expected.end());
+
+    std::vector<std::string> B(5000);
+    hpx::partial_sort_copy(hpx::execution::par, A.begin(), A.end(), B.begin(),
+        B.end(), [](std::string const& lhs, std::string const& rhs) {
+            return lhs < rhs;
+        });
+    HPX_TEST(B == expected);
+}
+
+void test_partial_sort_copy()
+{
+    std::size_t const sizes[] = {1, 1000, 100000, 1000000};
+    for (std::size_t size : sizes)
+    {
+        // many distinct values, and only a few distinct values
+        for (std::uint64_t range : {std::uint64_t(-1), std::uint64_t(3)})
+        {
+            test_partial_sort_copy(hpx::execution::seq, size, range);
+            test_partial_sort_copy(hpx::execution::par, size, range);
+            test_partial_sort_copy(hpx::execution::par_unseq, size, range);
+        }
+    }
+
+    test_partial_sort_copy_async(
+        hpx::execution::seq(hpx::execution::task), 1000000);
+    test_partial_sort_copy_async(
+        hpx::execution::par(hpx::execution::task), 1000000);
+
+    test_partial_sort_copy_forward();
+    test_partial_sort_copy_strings();
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_partial_sort_copy();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
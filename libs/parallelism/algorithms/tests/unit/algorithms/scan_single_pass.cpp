@@ -0,0 +1,261 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The parallel scans combine the results of neighboring chunks while looking
+// back over the sequence. This verifies that the order of the operands is
+// preserved by using an associative but non-commutative operation
+// (composition of affine functions) on sequences spanning many chunks.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_scan.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// represents x -> a * x + b
+struct affine
+{
+    std::uint64_t a;
+    std::uint64_t b;
+};
+
+bool operator==(affine const& lhs, affine const& rhs)
+{
+    return lhs.a == rhs.a && lhs.b == rhs.b;
+}
+
+// apply lhs first, then rhs
+struct compose
+{
+    affine operator()(affine const& lhs, affine const& rhs) const
+    {
+        return affine{lhs.a * rhs.a, rhs.a * lhs.b + rhs.b};
+    }
+};
+
+struct make_affine
+{
+    affine operator()(std::uint64_t v) const
+    {
+        return affine{2 * v + 1, v};
+    }
+};
+
+std::vector<affine> random_affine(std::size_t size)
+{
+    std::uniform_int_distribution<std::uint64_t> dis(0, 1000);
+
+    std::vector<affine> c(size);
+    for (auto& v : c)
+    {
+        v = affine{2 * dis(gen) + 1, dis(gen)};
+    }
+    return c;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename IteratorTag>
+void test_scan(ExPolicy policy, IteratorTag, std::size_t size)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    typedef std::vector<affine>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<affine> c = random_affine(size);
+    std::vector<affine> d(c.size());
+    std::vector<affine> e(c.size());
+
+    affine const init{3, 7};
+
+    hpx::parallel::inclusive_scan(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), std::begin(d), compose(), init);
+    hpx::parallel::v1::detail::sequential_inclusive_scan(
+        std::begin(c), std::end(c), std::begin(e), init, compose());
+    HPX_TEST(d == e);
+
+    hpx::parallel::exclusive_scan(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), std::begin(d), init, compose());
+    hpx::parallel::v1::detail::sequential_exclusive_scan(
+        std::begin(c), std::end(c), std::begin(e), init, compose());
+    HPX_TEST(d == e);
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_transform_scan(ExPolicy policy, IteratorTag, std::size_t size)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    typedef std::vector<std::uint64_t>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::uniform_int_distribution<std::uint64_t> dis(0, 1000);
+
+    std::vector<std::uint64_t> c(size);
+    for (auto& v : c)
+    {
+        v = dis(gen);
+    }
+    std::vector<affine> d(c.size());
+    std::vector<affine> e(c.size());
+
+    affine const init{5, 1};
+
+    hpx::parallel::transform_inclusive_scan(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), std::begin(d), compose(), make_affine(), init);
+    hpx::parallel::v1::detail::sequential_transform_inclusive_scan(
+        std::begin(c), std::end(c), std::begin(e), make_affine(), init,
+        compose());
+    HPX_TEST(d == e);
+
+    hpx::parallel::transform_exclusive_scan(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), std::begin(d), init, compose(), make_affine());
+    hpx::parallel::v1::detail::sequential_transform_exclusive_scan(
+        std::begin(c), std::end(c), std::begin(e), make_affine(), init,
+        compose());
+    HPX_TEST(d == e);
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_scan_async(ExPolicy p, IteratorTag, std::size_t size)
+{
+    typedef std::vector<affine>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<affine> c = random_affine(size);
+    std::vector<affine> d(c.size());
+    std::vector<affine> e(c.size());
+
+    affine const init{3, 7};
+
+    hpx::future<void> f = hpx::parallel::inclusive_scan(p,
+        iterator(std::begin(c)), iterator(std::end(c)), std::begin(d),
+        compose(), init);
+    f.wait();
+
+    hpx::parallel::v1::detail::sequential_inclusive_scan(
+        std::begin(c), std::end(c), std::begin(e), init, compose());
+    HPX_TEST(d == e);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// an exception thrown for a single chunk has to be reported without blocking
+// the chunks to its right
+template <typename ExPolicy, typename IteratorTag>
+void test_scan_exception(ExPolicy policy, IteratorTag, std::size_t size)
+{
+    typedef std::vector<std::uint64_t>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<std::uint64_t> c(size, 1);
+    std::vector<affine> d(c.size());
+
+    std::uniform_int_distribution<std::size_t> dis(0, size - 1);
+    c[dis(gen)] = 0;
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::parallel::transform_inclusive_scan(policy,
+            iterator(std::begin(c)), iterator(std::end(c)), std::begin(d),
+            compose(),
+            [](std::uint64_t v) {
+                if (v == 0)
+                    throw std::runtime_error("test");
+                return make_affine()(v);
+            },
+            affine{1, 0});
+
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const& e)
+    {
+        caught_exception = true;
+
+        // only the chunk containing the offending element fails
+        HPX_TEST_EQ(e.size(), std::size_t(1));
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename IteratorTag>
+void test_scan()
+{
+    using namespace hpx::execution;
+
+    for (std::size_t size :
+        {std::size_t(1), std::size_t(10007), std::size_t(1000003)})
+    {
+        test_scan(par, IteratorTag(), size);
+        test_scan(par_unseq, IteratorTag(), size);
+
+        test_transform_scan(par, IteratorTag(), size);
+
+        test_scan_async(par(task), IteratorTag(), size);
+
+        test_scan_exception(par, IteratorTag(), size);
+    }
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_scan<std::random_access_iterator_tag>();
+    test_scan<std::forward_iterator_tag>();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
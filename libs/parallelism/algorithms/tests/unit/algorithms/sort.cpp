@@ -8,8 +8,13 @@
 #include <hpx/hpx_init.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <iostream>
+#include <limits>
+#include <random>
 #include <string>
 #include <vector>
 
@@ -143,6 +148,82 @@ void test_sort2()
     test_sort2_async(par(task), float(), std::greater<float>());
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// arithmetic values compared using std::less or std::greater are sorted using
+// a radix sort, compare the results against std::sort
+template <typename ExPolicy, typename T, typename Compare>
+void test_sort_radix(ExPolicy&& policy, T, Compare comp, std::size_t size)
+{
+    std::mt19937 gen(std::rand());
+    std::uniform_int_distribution<int> dis(0, 1000);
+
+    std::vector<T> c(size);
+    for (auto& v : c)
+    {
+        // include negative values and a few duplicates
+        v = static_cast<T>(dis(gen) - 500) * static_cast<T>(dis(gen));
+    }
+    if (size != 0)
+    {
+        c[0] = (std::numeric_limits<T>::max)();
+        c[size / 2] = std::numeric_limits<T>::lowest();
+    }
+
+    std::vector<T> d = c;
+
+    hpx::parallel::sort(policy, c.begin(), c.end(), comp);
+    std::sort(d.begin(), d.end(), comp);
+
+    HPX_TEST(c == d);
+}
+
+template <typename ExPolicy, typename T>
+void test_sort_radix(ExPolicy&& policy, T value)
+{
+    for (std::size_t size : {std::size_t(0), std::size_t(1), std::size_t(100),
+             std::size_t(5000), std::size_t(HPX_SORT_TEST_SIZE)})
+    {
+        test_sort_radix(policy, value, std::less<T>(), size);
+        test_sort_radix(policy, value, std::greater<T>(), size);
+        test_sort_radix(policy, value, std::less<>(), size);
+        test_sort_radix(policy, value, std::greater<>(), size);
+    }
+}
+
+void test_sort_radix()
+{
+    using namespace hpx::execution;
+
+    test_sort_radix(seq, std::int32_t());
+    test_sort_radix(par, std::int32_t());
+    test_sort_radix(par, std::uint32_t());
+    test_sort_radix(par, std::int64_t());
+    test_sort_radix(par, std::uint64_t());
+    test_sort_radix(par, std::int16_t());
+    test_sort_radix(par, std::int8_t());
+
+    test_sort_radix(seq, float());
+    test_sort_radix(par, float());
+    test_sort_radix(par, double());
+    test_sort_radix(par_unseq, double());
+
+    // values which are the same in all but a single byte
+    std::vector<std::uint64_t> c(HPX_SORT_TEST_SIZE);
+    for (std::size_t i = 0; i != c.size(); ++i)
+    {
+        c[i] = 0x1234000000000000ull | ((c.size() - i) & 0xff) << 16;
+    }
+    hpx::parallel::sort(par, c.begin(), c.end());
+    HPX_TEST(std::is_sorted(c.begin(), c.end()));
+
+    // task policies
+    std::vector<double> d(HPX_SORT_TEST_SIZE);
+    rnd_fill<double>(d, -1000.0, 1000.0, double(std::rand()));
+    hpx::parallel::sort(par(task), d.begin(), d.end(), std::greater<double>())
+        .get();
+    HPX_TEST(std::is_sorted(d.begin(), d.end(), std::greater<double>()));
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -155,6 +236,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
 
     test_sort1();
     test_sort2();
+    test_sort_radix();
     sort_benchmark();
 
     return hpx::finalize();
@@ -0,0 +1,161 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////
+int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+struct element
+{
+    std::size_t key;
+    std::size_t value;
+};
+
+std::vector<element> random_elements(std::size_t size)
+{
+    std::uniform_int_distribution<std::size_t> dis(0, size);
+
+    std::vector<element> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        c[i] = element{dis(gen), i};
+    }
+    return c;
+}
+
+void verify_nth_element(std::vector<element> const& orig,
+    std::vector<element> const& c, std::size_t nth)
+{
+    std::vector<std::size_t> keys(orig.size());
+    std::transform(orig.begin(), orig.end(), keys.begin(),
+        [](element const& e) { return e.key; });
+    std::sort(keys.begin(), keys.end());
+
+    HPX_TEST_EQ(c[nth].key, keys[nth]);
+    HPX_TEST(std::all_of(c.begin(), c.begin() + nth,
+        [&](element const& e) { return e.key <= c[nth].key; }));
+    HPX_TEST(std::all_of(c.begin() + nth, c.end(),
+        [&](element const& e) { return e.key >= c[nth].key; }));
+}
+
+///////////////////////////////////////////////////////////////////////////
+void test_nth_element(std::size_t size)
+{
+    std::vector<element> const orig = random_elements(size);
+    std::size_t const nth = size / 3;
+
+    std::vector<element> c = orig;
+    auto result = hpx::ranges::nth_element(
+        c, c.begin() + nth, std::less<std::size_t>(), &element::key);
+    HPX_TEST(result == c.end());
+    verify_nth_element(orig, c, nth);
+
+    c = orig;
+    result = hpx::ranges::nth_element(c.begin(), c.begin() + nth, c.end(),
+        std::less<std::size_t>(), &element::key);
+    HPX_TEST(result == c.end());
+    verify_nth_element(orig, c, nth);
+}
+
+template <typename ExPolicy>
+void test_nth_element(ExPolicy&& policy, std::size_t size)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    std::vector<element> const orig = random_elements(size);
+    std::size_t const nth = size / 2;
+
+    std::vector<element> c = orig;
+    auto result = hpx::ranges::nth_element(
+        policy, c, c.begin() + nth, std::less<std::size_t>(), &element::key);
+    HPX_TEST(result == c.end());
+    verify_nth_element(orig, c, nth);
+
+    c = orig;
+    result = hpx::ranges::nth_element(policy, c.begin(), c.begin() + nth,
+        c.end(), std::less<std::size_t>(), &element::key);
+    HPX_TEST(result == c.end());
+    verify_nth_element(orig, c, nth);
+}
+
+template <typename ExPolicy>
+void test_nth_element_async(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<element> const orig = random_elements(size);
+    std::size_t const nth = size - size / 4 - 1;
+
+    std::vector<element> c = orig;
+    auto f = hpx::ranges::nth_element(
+        policy, c, c.begin() + nth, std::less<std::size_t>(), &element::key);
+    HPX_TEST(f.get() == c.end());
+    verify_nth_element(orig, c, nth);
+}
+
+void nth_element_test()
+{
+    for (std::size_t size : {std::size_t(1), std::size_t(10007),
+             std::size_t(1000000)})
+    {
+        test_nth_element(size);
+        test_nth_element(hpx::execution::seq, size);
+        test_nth_element(hpx::execution::par, size);
+        test_nth_element(hpx::execution::par_unseq, size);
+
+        test_nth_element_async(hpx::execution::seq(hpx::execution::task), size);
+        test_nth_element_async(hpx::execution::par(hpx::execution::task), size);
+    }
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    nth_element_test();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,170 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////
+int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+struct element
+{
+    std::size_t key;
+    std::size_t value;
+};
+
+std::vector<element> random_elements(std::size_t size)
+{
+    std::uniform_int_distribution<std::size_t> dis(0, size);
+
+    std::vector<element> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        c[i] = element{dis(gen), i};
+    }
+    return c;
+}
+
+std::vector<std::size_t> expected_keys(
+    std::vector<element> const& c, std::size_t size)
+{
+    std::vector<std::size_t> keys(c.size());
+    std::transform(c.begin(), c.end(), keys.begin(),
+        [](element const& e) { return e.key; });
+    std::sort(keys.begin(), keys.end());
+    keys.resize((std::min)(size, keys.size()));
+    return keys;
+}
+
+template <typename Result>
+void verify_partial_sort_copy(std::vector<element> const& c,
+    std::vector<element> const& d, Result const& result)
+{
+    std::vector<std::size_t> const keys = expected_keys(c, d.size());
+
+    HPX_TEST(result.in == c.end());
+    HPX_TEST(result.out == d.begin() + keys.size());
+    HPX_TEST(std::equal(keys.begin(), keys.end(), d.begin(),
+        [](std::size_t k, element const& e) { return k == e.key; }));
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto const key = [](element const& e) { return e.key; };
+
+void test_partial_sort_copy(std::size_t size, std::size_t d_size)
+{
+    std::vector<element> const c = random_elements(size);
+    std::vector<element> d(d_size);
+
+    auto result = hpx::ranges::partial_sort_copy(c.begin(), c.end(),
+        d.begin(), d.end(), std::less<std::size_t>(), key, key);
+    verify_partial_sort_copy(c, d, result);
+
+    std::fill(d.begin(), d.end(), element{0, 0});
+    auto result2 = hpx::ranges::partial_sort_copy(
+        c, d, std::less<std::size_t>(), key, key);
+    verify_partial_sort_copy(c, d, result2);
+}
+
+template <typename ExPolicy>
+void test_partial_sort_copy(
+    ExPolicy&& policy, std::size_t size, std::size_t d_size)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    std::vector<element> const c = random_elements(size);
+    std::vector<element> d(d_size);
+
+    auto result = hpx::ranges::partial_sort_copy(policy, c.begin(), c.end(),
+        d.begin(), d.end(), std::less<std::size_t>(), key, key);
+    verify_partial_sort_copy(c, d, result);
+
+    std::fill(d.begin(), d.end(), element{0, 0});
+    auto result2 = hpx::ranges::partial_sort_copy(
+        policy, c, d, std::less<std::size_t>(), key, key);
+    verify_partial_sort_copy(c, d, result2);
+}
+
+template <typename ExPolicy>
+void test_partial_sort_copy_async(
+    ExPolicy&& policy, std::size_t size, std::size_t d_size)
+{
+    std::vector<element> const c = random_elements(size);
+    std::vector<element> d(d_size);
+
+    auto f = hpx::ranges::partial_sort_copy(
+        policy, c, d, std::less<std::size_t>(), key, key);
+    verify_partial_sort_copy(c, d, f.get());
+}
+
+void partial_sort_copy_test()
+{
+    for (std::size_t size : {std::size_t(1), std::size_t(10007),
+             std::size_t(1000000)})
+    {
+        for (std::size_t d_size : {std::size_t(0), size / 10 + 1, size + 1})
+        {
+            test_partial_sort_copy(size, d_size);
+            test_partial_sort_copy(hpx::execution::seq, size, d_size);
+            test_partial_sort_copy(hpx::execution::par, size, d_size);
+            test_partial_sort_copy(hpx::execution::par_unseq, size, d_size);
+
+            test_partial_sort_copy_async(
+                hpx::execution::seq(hpx::execution::task), size, d_size);
+            test_partial_sort_copy_async(
+                hpx::execution::par(hpx::execution::task), size, d_size);
+        }
+    }
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    partial_sort_copy_test();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
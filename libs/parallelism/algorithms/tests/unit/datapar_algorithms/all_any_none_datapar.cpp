@@ -0,0 +1,152 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/datapar.hpp>
+#include <hpx/include/parallel_all_any_none_of.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+struct is_negative
+{
+    template <typename T>
+    auto operator()(T const& x) const -> decltype(x < 0)
+    {
+        return x < 0;
+    }
+};
+
+template <typename ExPolicy, typename IteratorTag>
+void test_all_any_none(ExPolicy&& policy, IteratorTag)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::uniform_int_distribution<> dis(0, 10006);
+
+    std::vector<int> c(10007, 1);
+
+    HPX_TEST(hpx::none_of(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), is_negative()));
+    HPX_TEST(!hpx::any_of(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), is_negative()));
+    HPX_TEST(!hpx::all_of(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), is_negative()));
+
+    // a single negative element at a random position
+    c[dis(gen)] = -1;
+
+    HPX_TEST(!hpx::none_of(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), is_negative()));
+    HPX_TEST(hpx::any_of(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), is_negative()));
+
+    // all elements but one are negative
+    std::fill(std::begin(c), std::end(c), -1);
+    HPX_TEST(hpx::all_of(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), is_negative()));
+
+    c[dis(gen)] = 1;
+    HPX_TEST(!hpx::all_of(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), is_negative()));
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_all_any_none_async(ExPolicy&& p, IteratorTag)
+{
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::uniform_int_distribution<> dis(0, 10006);
+
+    std::vector<int> c(10007, 1);
+    c[dis(gen)] = -1;
+
+    hpx::future<bool> f = hpx::any_of(
+        p, iterator(std::begin(c)), iterator(std::end(c)), is_negative());
+    f.wait();
+    HPX_TEST(f.get());
+
+    f = hpx::none_of(
+        p, iterator(std::begin(c)), iterator(std::end(c)), is_negative());
+    f.wait();
+    HPX_TEST(!f.get());
+
+    f = hpx::all_of(
+        p, iterator(std::begin(c)), iterator(std::end(c)), is_negative());
+    f.wait();
+    HPX_TEST(!f.get());
+}
+
+template <typename IteratorTag>
+void test_all_any_none()
+{
+    using namespace hpx::execution;
+
+    test_all_any_none(dataseq, IteratorTag());
+    test_all_any_none(datapar, IteratorTag());
+
+    test_all_any_none_async(dataseq(task), IteratorTag());
+    test_all_any_none_async(datapar(task), IteratorTag());
+}
+
+void all_any_none_test()
+{
+    test_all_any_none<std::random_access_iterator_tag>();
+    test_all_any_none<std::forward_iterator_tag>();
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    all_any_none_test();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,144 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/datapar.hpp>
+#include <hpx/include/parallel_equal.hpp>
+#include <hpx/include/parallel_mismatch.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+template <typename ExPolicy, typename IteratorTag>
+void test_equal(ExPolicy&& policy, IteratorTag)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::uniform_int_distribution<> dis(0, 10006);
+
+    std::vector<int> c1(10007);
+    std::iota(std::begin(c1), std::end(c1), 0);
+    std::vector<int> c2 = c1;
+
+    HPX_TEST(hpx::equal(policy, iterator(std::begin(c1)),
+        iterator(std::end(c1)), std::begin(c2)));
+
+    auto result = hpx::mismatch(policy, iterator(std::begin(c1)),
+        iterator(std::end(c1)), std::begin(c2));
+    HPX_TEST(result.first == iterator(std::end(c1)));
+    HPX_TEST(result.second == std::end(c2));
+
+    // introduce a single difference at a random position
+    std::size_t const pos = dis(gen);
+    ++c2[pos];
+
+    HPX_TEST(!hpx::equal(policy, iterator(std::begin(c1)),
+        iterator(std::end(c1)), std::begin(c2)));
+
+    result = hpx::mismatch(policy, iterator(std::begin(c1)),
+        iterator(std::end(c1)), std::begin(c2));
+    HPX_TEST(result.first == iterator(std::begin(c1) + pos));
+    HPX_TEST(result.second == std::begin(c2) + pos);
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_equal_async(ExPolicy&& p, IteratorTag)
+{
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::uniform_int_distribution<> dis(0, 10006);
+
+    std::vector<int> c1(10007);
+    std::iota(std::begin(c1), std::end(c1), 0);
+    std::vector<int> c2 = c1;
+
+    std::size_t const pos = dis(gen);
+    ++c2[pos];
+
+    hpx::future<bool> f = hpx::equal(
+        p, iterator(std::begin(c1)), iterator(std::end(c1)), std::begin(c2));
+    f.wait();
+
+    HPX_TEST(!f.get());
+
+    auto r = hpx::mismatch(
+        p, iterator(std::begin(c1)), iterator(std::end(c1)), std::begin(c2));
+    r.wait();
+
+    HPX_TEST(r.get().first == iterator(std::begin(c1) + pos));
+}
+
+template <typename IteratorTag>
+void test_equal()
+{
+    using namespace hpx::execution;
+
+    test_equal(dataseq, IteratorTag());
+    test_equal(datapar, IteratorTag());
+
+    test_equal_async(dataseq(task), IteratorTag());
+    test_equal_async(datapar(task), IteratorTag());
+}
+
+void equal_test()
+{
+    test_equal<std::random_access_iterator_tag>();
+    test_equal<std::forward_iterator_tag>();
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    equal_test();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
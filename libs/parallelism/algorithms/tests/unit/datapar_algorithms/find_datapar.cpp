@@ -0,0 +1,165 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/datapar.hpp>
+#include <hpx/include/parallel_find.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+struct equal_to_one
+{
+    template <typename T>
+    auto operator()(T const& x) const -> decltype(x == 1)
+    {
+        return x == 1;
+    }
+};
+
+struct greater_than_one
+{
+    template <typename T>
+    auto operator()(T const& x) const -> decltype(x > 1)
+    {
+        return x > 1;
+    }
+};
+
+template <typename ExPolicy, typename IteratorTag>
+void test_find(ExPolicy&& policy, IteratorTag)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::uniform_int_distribution<> dis(0, 10006);
+
+    // fill vector with values above 1, the position of the single element
+    // equal to 1 is random to exercise both full and partial vector-packs
+    std::vector<int> c(10007, 2);
+    std::size_t const pos = dis(gen);
+    c[pos] = 1;
+
+    base_iterator test_index = std::begin(c) + pos;
+
+    iterator index =
+        hpx::find(policy, iterator(std::begin(c)), iterator(std::end(c)), 1);
+    HPX_TEST(index == iterator(test_index));
+
+    index = hpx::find_if(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), equal_to_one());
+    HPX_TEST(index == iterator(test_index));
+
+    index = hpx::find_if_not(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), greater_than_one());
+    HPX_TEST(index == iterator(test_index));
+
+    // no element matches
+    c[pos] = 2;
+
+    index =
+        hpx::find(policy, iterator(std::begin(c)), iterator(std::end(c)), 1);
+    HPX_TEST(index == iterator(std::end(c)));
+
+    index = hpx::find_if(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), equal_to_one());
+    HPX_TEST(index == iterator(std::end(c)));
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_find_async(ExPolicy&& p, IteratorTag)
+{
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::uniform_int_distribution<> dis(0, 10006);
+
+    std::vector<int> c(10007, 2);
+    std::size_t const pos = dis(gen);
+    c[pos] = 1;
+
+    hpx::future<iterator> f =
+        hpx::find(p, iterator(std::begin(c)), iterator(std::end(c)), 1);
+    f.wait();
+
+    base_iterator test_index = std::begin(c) + pos;
+    HPX_TEST(f.get() == iterator(test_index));
+
+    f = hpx::find_if_not(
+        p, iterator(std::begin(c)), iterator(std::end(c)), greater_than_one());
+    f.wait();
+
+    HPX_TEST(f.get() == iterator(test_index));
+}
+
+template <typename IteratorTag>
+void test_find()
+{
+    using namespace hpx::execution;
+
+    test_find(dataseq, IteratorTag());
+    test_find(datapar, IteratorTag());
+
+    test_find_async(dataseq(task), IteratorTag());
+    test_find_async(datapar(task), IteratorTag());
+}
+
+void find_test()
+{
+    test_find<std::random_access_iterator_tag>();
+    test_find<std::forward_iterator_tag>();
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    find_test();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
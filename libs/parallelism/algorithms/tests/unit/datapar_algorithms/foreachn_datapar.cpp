@@ -21,11 +21,11 @@ void test_for_each_n()
 {
     using namespace hpx::execution;
 
-    test_for_each_n(execution::dataseq, IteratorTag());
-    test_for_each_n(execution::datapar, IteratorTag());
+    test_for_each_n(dataseq, IteratorTag());
+    test_for_each_n(datapar, IteratorTag());
 
-    test_for_each_n_async(execution::dataseq(task), IteratorTag());
-    test_for_each_n_async(execution::datapar(task), IteratorTag());
+    test_for_each_n_async(dataseq(task), IteratorTag());
+    test_for_each_n_async(datapar(task), IteratorTag());
 }
 
 void for_each_n_test()
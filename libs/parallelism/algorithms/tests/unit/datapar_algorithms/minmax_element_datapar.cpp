@@ -0,0 +1,144 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/datapar.hpp>
+#include <hpx/include/parallel_minmax.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+template <typename ExPolicy, typename IteratorTag>
+void test_minmax_element(ExPolicy&& policy, IteratorTag)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::uniform_int_distribution<> dis(-1000, 1000);
+
+    std::vector<int> c(10007);
+    for (auto& v : c)
+    {
+        v = dis(gen);
+    }
+
+    // the reference results: the first smallest, the first largest, and the
+    // last largest elements
+    base_iterator ref_min = std::min_element(std::begin(c), std::end(c));
+    base_iterator ref_max = std::max_element(std::begin(c), std::end(c));
+    auto ref_minmax = std::minmax_element(std::begin(c), std::end(c));
+
+    iterator r = hpx::parallel::min_element(
+        policy, iterator(std::begin(c)), iterator(std::end(c)));
+    HPX_TEST(r == iterator(ref_min));
+
+    r = hpx::parallel::max_element(
+        policy, iterator(std::begin(c)), iterator(std::end(c)));
+    HPX_TEST(r == iterator(ref_max));
+
+    auto rr = hpx::parallel::minmax_element(
+        policy, iterator(std::begin(c)), iterator(std::end(c)));
+    HPX_TEST(rr.first == iterator(ref_minmax.first));
+    HPX_TEST(rr.second == iterator(ref_minmax.second));
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_minmax_element_async(ExPolicy&& p, IteratorTag)
+{
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::uniform_int_distribution<> dis(-1000, 1000);
+
+    std::vector<int> c(10007);
+    for (auto& v : c)
+    {
+        v = dis(gen);
+    }
+
+    base_iterator ref_min = std::min_element(std::begin(c), std::end(c));
+    base_iterator ref_max = std::max_element(std::begin(c), std::end(c));
+
+    hpx::future<iterator> f = hpx::parallel::min_element(
+        p, iterator(std::begin(c)), iterator(std::end(c)));
+    f.wait();
+    HPX_TEST(f.get() == iterator(ref_min));
+
+    f = hpx::parallel::max_element(
+        p, iterator(std::begin(c)), iterator(std::end(c)));
+    f.wait();
+    HPX_TEST(f.get() == iterator(ref_max));
+}
+
+template <typename IteratorTag>
+void test_minmax_element()
+{
+    using namespace hpx::execution;
+
+    test_minmax_element(dataseq, IteratorTag());
+    test_minmax_element(datapar, IteratorTag());
+
+    test_minmax_element_async(dataseq(task), IteratorTag());
+    test_minmax_element_async(datapar(task), IteratorTag());
+}
+
+void minmax_element_test()
+{
+    test_minmax_element<std::random_access_iterator_tag>();
+    test_minmax_element<std::forward_iterator_tag>();
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    minmax_element_test();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,143 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/datapar.hpp>
+#include <hpx/include/parallel_reduce.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+struct plus
+{
+    template <typename T1, typename T2>
+    auto operator()(T1 const& t1, T2 const& t2) const -> decltype(t1 + t2)
+    {
+        return t1 + t2;
+    }
+};
+
+template <typename ExPolicy, typename IteratorTag>
+void test_reduce(ExPolicy&& policy, IteratorTag)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::uniform_int_distribution<> dis(0, 1000);
+
+    std::vector<int> c(10007);
+    for (auto& v : c)
+    {
+        v = dis(gen);
+    }
+
+    int const init = dis(gen);
+    int const expected = std::accumulate(std::begin(c), std::end(c), init);
+
+    int r = hpx::reduce(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), init, ::plus());
+    HPX_TEST_EQ(r, expected);
+
+    // a reduction type different from the element type is handled element
+    // by element
+    long const rl = hpx::reduce(policy, iterator(std::begin(c)),
+        iterator(std::end(c)), long(init), ::plus());
+    HPX_TEST_EQ(rl, long(expected));
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_reduce_async(ExPolicy&& p, IteratorTag)
+{
+    typedef std::vector<int>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::uniform_int_distribution<> dis(0, 1000);
+
+    std::vector<int> c(10007);
+    for (auto& v : c)
+    {
+        v = dis(gen);
+    }
+
+    int const init = dis(gen);
+    int const expected = std::accumulate(std::begin(c), std::end(c), init);
+
+    hpx::future<int> f = hpx::reduce(
+        p, iterator(std::begin(c)), iterator(std::end(c)), init, ::plus());
+    f.wait();
+
+    HPX_TEST_EQ(f.get(), expected);
+}
+
+template <typename IteratorTag>
+void test_reduce()
+{
+    using namespace hpx::execution;
+
+    test_reduce(dataseq, IteratorTag());
+    test_reduce(datapar, IteratorTag());
+
+    test_reduce_async(dataseq(task), IteratorTag());
+    test_reduce_async(datapar(task), IteratorTag());
+}
+
+void reduce_test()
+{
+    test_reduce<std::random_access_iterator_tag>();
+    test_reduce<std::forward_iterator_tag>();
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    reduce_test();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
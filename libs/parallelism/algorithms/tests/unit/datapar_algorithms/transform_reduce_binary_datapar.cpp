@@ -20,11 +20,11 @@ void test_transform_reduce_binary()
 {
     using namespace hpx::execution;
 
-    test_transform_reduce_binary(execution::dataseq, IteratorTag());
-    test_transform_reduce_binary(execution::datapar, IteratorTag());
+    test_transform_reduce_binary(dataseq, IteratorTag());
+    test_transform_reduce_binary(datapar, IteratorTag());
 
-    test_transform_reduce_binary_async(execution::dataseq(task), IteratorTag());
-    test_transform_reduce_binary_async(execution::datapar(task), IteratorTag());
+    test_transform_reduce_binary_async(dataseq(task), IteratorTag());
+    test_transform_reduce_binary_async(datapar(task), IteratorTag());
 }
 
 void transform_reduce_binary_test()
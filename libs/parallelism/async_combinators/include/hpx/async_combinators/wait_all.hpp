@@ -113,6 +113,7 @@ namespace hpx {
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <functional>
 #include <iterator>
@@ -338,18 +339,92 @@ namespace hpx { namespace lcos {
         private:
             Tuple const& t_;
         };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Fast path for a single range of futures: a continuation decrementing
+        // a shared counter is attached to all elements which are not ready
+        // yet, the waiting thread is woken up only once the counter reaches
+        // zero.
+        template <typename Range>
+        struct wait_all_range_frame    //-V690
+          : hpx::lcos::detail::future_data<void>
+        {
+        private:
+            typedef hpx::lcos::detail::future_data<void> base_type;
+
+            // workaround gcc regression wrongly instantiating constructors
+            wait_all_range_frame();
+            wait_all_range_frame(wait_all_range_frame const&);
+
+        public:
+            typedef typename base_type::init_no_addref init_no_addref;
+
+            wait_all_range_frame(init_no_addref no_addref, Range const& values)
+              : base_type(no_addref)
+              , values_(values)
+              , count_(0)
+            {
+            }
+
+            void wait_all()
+            {
+                // The counter starts with the number of elements plus one,
+                // the additional count is released after all continuations
+                // have been attached.
+                count_.store(
+                    util::size(values_) + 1, std::memory_order_relaxed);
+
+                std::size_t ready = 1;
+                for (auto&& f : values_)
+                {
+                    auto const& state = traits::detail::get_shared_state(f);
+                    if (state.get() != nullptr && !state->is_ready())
+                    {
+                        state->execute_deferred();
+
+                        // execute_deferred might have made the future ready
+                        if (!state->is_ready())
+                        {
+                            state->set_on_completed(
+                                [this]() -> void { this->on_ready(1); });
+                            continue;
+                        }
+                    }
+                    ++ready;
+                }
+
+                // If there are still futures which are not ready, suspend and
+                // wait.
+                if (count_.fetch_sub(ready, std::memory_order_acq_rel) !=
+                    ready)
+                {
+                    this->wait();
+                }
+            }
+
+        private:
+            void on_ready(std::size_t count)
+            {
+                if (count_.fetch_sub(count, std::memory_order_acq_rel) ==
+                    count)
+                {
+                    this->set_value(util::unused);
+                }
+            }
+
+            Range const& values_;
+            std::atomic<std::size_t> count_;
+        };
     }    // namespace detail
 
     ///////////////////////////////////////////////////////////////////////////
     template <typename Future>
     void wait_all(std::vector<Future> const& values)
     {
-        typedef hpx::tuple<std::vector<Future> const&> result_type;
-        typedef detail::wait_all_frame<result_type> frame_type;
+        typedef detail::wait_all_range_frame<std::vector<Future>> frame_type;
         typedef typename frame_type::init_no_addref init_no_addref;
 
-        result_type data(values);
-        frame_type frame{init_no_addref{}, data};
+        frame_type frame(init_no_addref{}, values);
         frame.wait_all();
     }
 
@@ -369,12 +444,10 @@ namespace hpx { namespace lcos {
     template <typename Future, std::size_t N>
     void wait_all(std::array<Future, N> const& values)
     {
-        typedef hpx::tuple<std::array<Future, N> const&> result_type;
-        typedef detail::wait_all_frame<result_type> frame_type;
+        typedef detail::wait_all_range_frame<std::array<Future, N>> frame_type;
         typedef typename frame_type::init_no_addref init_no_addref;
 
-        result_type data(values);
-        frame_type frame(init_no_addref{}, data);
+        frame_type frame(init_no_addref{}, values);
         frame.wait_all();
     }
 
@@ -143,8 +143,11 @@ namespace hpx {
 #include <hpx/futures/traits/future_traits.hpp>
 #include <hpx/futures/traits/is_future.hpp>
 #include <hpx/futures/traits/is_future_range.hpp>
+#include <hpx/iterator_support/range.hpp>
+#include <hpx/modules/memory.hpp>
 #include <hpx/pack_traversal/pack_traversal_async.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <iterator>
 #include <type_traits>
@@ -240,6 +243,104 @@ namespace hpx { namespace lcos {
             return future_access<typename frame_type::type>::create(
                 std::move(frame));
         }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Fast path for a single range of futures: instead of traversing the
+        // range and attaching a continuation to the next element once the
+        // previous one has become ready, a continuation decrementing a shared
+        // counter is attached to all elements up front. The frame becomes
+        // ready once the counter reaches zero.
+        template <typename Container>
+        class when_all_range_frame : public future_data<Container>
+        {
+        public:
+            typedef hpx::lcos::future<Container> type;
+            typedef hpx::lcos::detail::future_data<Container> base_type;
+
+            when_all_range_frame(typename base_type::init_no_addref no_addref,
+                Container&& values)
+              : base_type(no_addref)
+              , values_(std::move(values))
+              , count_(0)
+            {
+            }
+
+            void attach()
+            {
+                // The counter starts with the number of elements plus one,
+                // the additional count is released after all continuations
+                // have been attached. This keeps the frame from becoming
+                // ready while still iterating over the elements.
+                count_.store(
+                    util::size(values_) + 1, std::memory_order_relaxed);
+
+                // keep the frame alive until all continuations have run
+                intrusive_ptr_add_ref(this);
+
+                std::size_t ready = 1;
+                for (auto&& f : values_)
+                {
+                    auto const& state = traits::detail::get_shared_state(f);
+                    if (state.get() != nullptr && !state->is_ready())
+                    {
+                        state->execute_deferred();
+
+                        // execute_deferred might have made the future ready
+                        if (!state->is_ready())
+                        {
+                            state->set_on_completed(
+                                [this]() -> void { this->on_ready(1); });
+                            continue;
+                        }
+                    }
+                    ++ready;
+                }
+
+                on_ready(ready);
+            }
+
+        private:
+            void on_ready(std::size_t count)
+            {
+                if (count_.fetch_sub(count, std::memory_order_acq_rel) ==
+                    count)
+                {
+                    // release the reference acquired in attach()
+                    hpx::intrusive_ptr<when_all_range_frame> this_(
+                        this, false);
+                    this->set_value(std::move(values_));
+                }
+            }
+
+            Container values_;
+            std::atomic<std::size_t> count_;
+        };
+
+        template <typename Container>
+        future<Container> when_all_range(Container&& values)
+        {
+            typedef detail::when_all_range_frame<Container> frame_type;
+
+            typename frame_type::base_type::init_no_addref no_addref;
+            hpx::intrusive_ptr<frame_type> frame(
+                new frame_type(no_addref, std::move(values)), false);
+            frame->attach();
+
+            using traits::future_access;
+            return future_access<typename frame_type::type>::create(
+                std::move(frame));
+        }
+
+        // a single range of futures uses the fast path
+        template <typename T>
+        typename std::enable_if<
+            traits::is_future_range<typename std::decay<T>::type>::value,
+            future<typename traits::acquire_future<T>::type>>::type
+        when_all_impl(T&& values)
+        {
+            traits::acquire_future_disp func;
+            return when_all_range(func(std::forward<T>(values)));
+        }
     }    // namespace detail
 
     template <typename First, typename Second>
@@ -255,7 +356,7 @@ namespace hpx { namespace lcos {
             typename detail::future_iterator_traits<Iterator>::type>>
     future<Container> when_all(Iterator begin, Iterator end)
     {
-        return detail::when_all_impl(
+        return detail::when_all_range(
             detail::acquire_future_iterators<Iterator, Container>(begin, end));
     }
 
@@ -272,7 +373,7 @@ namespace hpx { namespace lcos {
             typename lcos::detail::future_iterator_traits<Iterator>::type>>
     lcos::future<Container> when_all_n(Iterator begin, std::size_t count)
     {
-        return detail::when_all_impl(
+        return detail::when_all_range(
             detail::acquire_future_n<Iterator, Container>(begin, count));
     }
 
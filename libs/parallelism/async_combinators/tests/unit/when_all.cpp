@@ -12,6 +12,7 @@
 #include <hpx/modules/testing.hpp>
 
 #include <chrono>
+#include <cstddef>
 #include <deque>
 #include <list>
 #include <memory>
@@ -255,6 +256,55 @@ void test_wait_for_all_deferred_futures()
     HPX_TEST(hpx::get<1>(result).is_ready());
 }
 
+void test_wait_for_all_many_futures()
+{
+    std::size_t const count = 10000;
+
+    std::vector<hpx::lcos::local::promise<int>> promises(count);
+    std::vector<hpx::lcos::future<int>> futures;
+    futures.reserve(count);
+    for (auto& p : promises)
+    {
+        futures.push_back(p.get_future());
+    }
+    futures.push_back(hpx::make_ready_future(42));
+
+    hpx::lcos::future<std::vector<hpx::lcos::future<int>>> r =
+        hpx::when_all(futures);
+
+    // the returned future may be released before the inputs become ready
+    hpx::lcos::local::promise<int> late;
+    {
+        std::vector<hpx::lcos::future<int>> late_futures;
+        late_futures.push_back(late.get_future());
+        hpx::when_all(late_futures);
+    }
+    late.set_value(0);
+
+    // make the futures ready concurrently
+    std::vector<hpx::lcos::future<void>> setters;
+    std::size_t const num_setters = 4;
+    for (std::size_t i = 0; i != num_setters; ++i)
+    {
+        setters.push_back(hpx::async([&promises, i, num_setters]() {
+            for (std::size_t j = i; j < promises.size(); j += num_setters)
+            {
+                promises[j].set_value(int(j));
+            }
+        }));
+    }
+
+    std::vector<hpx::lcos::future<int>> result = r.get();
+    hpx::wait_all(setters);
+
+    HPX_TEST_EQ(result.size(), count + 1);
+    for (std::size_t j = 0; j != count; ++j)
+    {
+        HPX_TEST_EQ(result[j].get(), int(j));
+    }
+    HPX_TEST_EQ(result[count].get(), 42);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 using hpx::program_options::options_description;
 using hpx::program_options::variables_map;
@@ -277,6 +327,7 @@ int hpx_main(variables_map&)
         test_wait_for_all_five_futures();
         test_wait_for_all_late_futures();
         test_wait_for_all_deferred_futures();
+        test_wait_for_all_many_futures();
     }
 
     hpx::finalize();
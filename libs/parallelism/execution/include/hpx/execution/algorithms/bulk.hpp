@@ -0,0 +1,124 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/execution_base/receiver.hpp>
+#include <hpx/execution_base/sender.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_fallback_invoke.hpp>
+
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace execution { namespace experimental {
+    namespace detail {
+        template <typename Receiver, typename Shape, typename F>
+        struct bulk_receiver
+        {
+            Receiver receiver_;
+            Shape shape_;
+            F f_;
+
+            void set_error(std::exception_ptr ep) noexcept
+            {
+                hpx::execution::experimental::set_error(
+                    std::move(receiver_), std::move(ep));
+            }
+
+            void set_done() noexcept
+            {
+                hpx::execution::experimental::set_done(std::move(receiver_));
+            }
+
+            template <typename... Ts>
+            void set_value(Ts&&... ts) noexcept
+            {
+                try
+                {
+                    for (Shape i = 0; i != shape_; ++i)
+                    {
+                        HPX_INVOKE(f_, i, ts...);
+                    }
+                    hpx::execution::experimental::set_value(
+                        std::move(receiver_), std::forward<Ts>(ts)...);
+                }
+                catch (...)
+                {
+                    hpx::execution::experimental::set_error(
+                        std::move(receiver_), std::current_exception());
+                }
+            }
+        };
+
+        template <typename Sender, typename Shape, typename F>
+        struct bulk_sender
+        {
+            Sender sender_;
+            Shape shape_;
+            F f_;
+
+            template <template <typename...> class Tuple,
+                template <typename...> class Variant>
+            using value_types = typename hpx::execution::experimental::traits::
+                sender_traits<Sender>::template value_types<Tuple, Variant>;
+
+            template <template <typename...> class Variant>
+            using error_types = Variant<std::exception_ptr>;
+
+            static constexpr bool sends_done =
+                hpx::execution::experimental::traits::sender_traits<
+                    Sender>::sends_done;
+
+            template <typename Receiver>
+            auto connect(Receiver&& receiver) &&
+            {
+                return hpx::execution::experimental::connect(
+                    std::move(sender_),
+                    bulk_receiver<typename std::decay<Receiver>::type, Shape,
+                        F>{std::forward<Receiver>(receiver), shape_,
+                        std::move(f_)});
+            }
+
+            template <typename Receiver>
+            auto connect(Receiver&& receiver) const&
+            {
+                return hpx::execution::experimental::connect(sender_,
+                    bulk_receiver<typename std::decay<Receiver>::type, Shape,
+                        F>{std::forward<Receiver>(receiver), shape_, f_});
+            }
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// bulk(s, shape, f) returns a sender which invokes f(i, values...) for
+    /// each i in [0, shape) with (lvalue references to) the values sent by s
+    /// and then forwards those values. The default implementation invokes f
+    /// sequentially on the thread s completes on, senders may customize bulk
+    /// (using tag_invoke) to run the invocations concurrently.
+    HPX_INLINE_CONSTEXPR_VARIABLE struct bulk_t final
+      : hpx::functional::tag_fallback<bulk_t>
+    {
+    private:
+        // clang-format off
+        template <typename Sender, typename Shape, typename F,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::execution::experimental::traits::is_sender_v<Sender> &&
+                std::is_integral<Shape>::value
+            )>
+        // clang-format on
+        friend constexpr HPX_FORCEINLINE auto tag_fallback_invoke(
+            bulk_t, Sender&& sender, Shape shape, F&& f)
+        {
+            return detail::bulk_sender<typename std::decay<Sender>::type,
+                Shape, typename std::decay<F>::type>{
+                std::forward<Sender>(sender), shape, std::forward<F>(f)};
+        }
+    } bulk{};
+}}}    // namespace hpx::execution::experimental
@@ -272,8 +272,8 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
         template <typename T1, typename T2,
             typename Enable = typename std::enable_if<
                 hpx::traits::is_equality_comparable_with<T1, T2>::value>::type>
-        HPX_HOST_DEVICE HPX_FORCEINLINE constexpr bool operator()(
-            T1&& t1, T2&& t2) const
+        HPX_HOST_DEVICE HPX_FORCEINLINE constexpr auto operator()(
+            T1&& t1, T2&& t2) const -> decltype(t1 == t2)
         {
             return t1 == t2;
         }
@@ -317,8 +317,9 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
     struct less
     {
         template <typename T1, typename T2>
-        HPX_HOST_DEVICE HPX_FORCEINLINE constexpr bool operator()(
+        HPX_HOST_DEVICE HPX_FORCEINLINE constexpr auto operator()(
             T1&& t1, T2&& t2) const
+            -> decltype(std::forward<T1>(t1) < std::forward<T2>(t2))
         {
             return std::forward<T1>(t1) < std::forward<T2>(t2);
         }
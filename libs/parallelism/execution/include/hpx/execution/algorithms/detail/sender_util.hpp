@@ -0,0 +1,112 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/execution_base/sender.hpp>
+#include <hpx/functional/invoke_result.hpp>
+#include <hpx/type_support/pack.hpp>
+
+#include <type_traits>
+
+namespace hpx { namespace execution { namespace experimental {
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        // The sender algorithms support senders which complete with exactly
+        // one set of values (possibly empty) only, errors are always reported
+        // as std::exception_ptr. This avoids having to store the values in a
+        // variant (which is not available in C++14).
+        template <typename... Variants>
+        struct single_variant
+        {
+            static_assert(sizeof...(Variants) == 1,
+                "the sender algorithms require senders sending exactly one set "
+                "of values");
+        };
+
+        template <typename T>
+        struct single_variant<T>
+        {
+            using type = T;
+        };
+
+        // The values sent by the given sender, as hpx::util::pack<Ts...>
+        template <typename Sender>
+        using value_pack_t =
+            typename hpx::execution::experimental::traits::sender_traits<
+                typename std::decay<Sender>::type>::
+                template value_types<hpx::util::pack, single_variant>::type;
+
+        ///////////////////////////////////////////////////////////////////////
+        // Instantiate the given template with the types of a pack
+        template <template <typename...> class Template, typename Pack>
+        struct apply_pack;
+
+        template <template <typename...> class Template, typename... Ts>
+        struct apply_pack<Template, hpx::util::pack<Ts...>>
+        {
+            using type = Template<Ts...>;
+        };
+
+        // Concatenate the types of several packs
+        template <typename... Packs>
+        struct concat_packs
+        {
+            using type = hpx::util::pack<>;
+        };
+
+        template <typename... Ts>
+        struct concat_packs<hpx::util::pack<Ts...>>
+        {
+            using type = hpx::util::pack<Ts...>;
+        };
+
+        template <typename... Ts, typename... Us, typename... Packs>
+        struct concat_packs<hpx::util::pack<Ts...>, hpx::util::pack<Us...>,
+            Packs...> : concat_packs<hpx::util::pack<Ts..., Us...>, Packs...>
+        {
+        };
+
+        // The tuple type used to store the values sent by a sender
+        template <typename Pack>
+        struct decayed_tuple;
+
+        template <typename... Ts>
+        struct decayed_tuple<hpx::util::pack<Ts...>>
+        {
+            using type = hpx::tuple<typename std::decay<Ts>::type...>;
+        };
+
+        template <typename Pack>
+        using decayed_tuple_t = typename decayed_tuple<Pack>::type;
+
+        ///////////////////////////////////////////////////////////////////////
+        // The result of invoking a function with the values of a pack
+        template <typename F, typename Pack>
+        struct invoke_result_pack;
+
+        template <typename F, typename... Ts>
+        struct invoke_result_pack<F, hpx::util::pack<Ts...>>
+          : hpx::util::invoke_result<F, Ts...>
+        {
+        };
+
+        // The single set of values sent by a function returning the given type
+        template <template <typename...> class Tuple, typename R>
+        struct result_tuple
+        {
+            using type = Tuple<R>;
+        };
+
+        template <template <typename...> class Tuple>
+        struct result_tuple<Tuple, void>
+        {
+            using type = Tuple<>;
+        };
+    }    // namespace detail
+}}}    // namespace hpx::execution::experimental
@@ -0,0 +1,93 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/execution_base/receiver.hpp>
+#include <hpx/execution_base/sender.hpp>
+#include <hpx/functional/invoke_fused.hpp>
+#include <hpx/functional/tag_fallback_invoke.hpp>
+
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace execution { namespace experimental {
+    namespace detail {
+        template <typename Receiver, typename... Ts>
+        struct just_operation_state
+        {
+            Receiver receiver_;
+            hpx::tuple<Ts...> ts_;
+
+            void start() noexcept
+            {
+                try
+                {
+                    hpx::util::invoke_fused(
+                        [this](Ts&... ts) {
+                            hpx::execution::experimental::set_value(
+                                std::move(receiver_), std::move(ts)...);
+                        },
+                        ts_);
+                }
+                catch (...)
+                {
+                    hpx::execution::experimental::set_error(
+                        std::move(receiver_), std::current_exception());
+                }
+            }
+        };
+
+        template <typename... Ts>
+        struct just_sender
+        {
+            hpx::tuple<Ts...> ts_;
+
+            template <template <typename...> class Tuple,
+                template <typename...> class Variant>
+            using value_types = Variant<Tuple<Ts...>>;
+
+            template <template <typename...> class Variant>
+            using error_types = Variant<std::exception_ptr>;
+
+            static constexpr bool sends_done = false;
+
+            template <typename Receiver>
+            just_operation_state<typename std::decay<Receiver>::type, Ts...>
+            connect(Receiver&& receiver) &&
+            {
+                return {std::forward<Receiver>(receiver), std::move(ts_)};
+            }
+
+            template <typename Receiver>
+            just_operation_state<typename std::decay<Receiver>::type, Ts...>
+            connect(Receiver&& receiver) const&
+            {
+                return {std::forward<Receiver>(receiver), ts_};
+            }
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// just is a sender factory: `just(ts...)` returns a sender which
+    /// completes synchronously (on the thread starting it) with the given
+    /// values.
+    HPX_INLINE_CONSTEXPR_VARIABLE struct just_t final
+      : hpx::functional::tag_fallback<just_t>
+    {
+    private:
+        template <typename... Ts>
+        friend constexpr HPX_FORCEINLINE auto tag_fallback_invoke(
+            just_t, Ts&&... ts)
+        {
+            return detail::just_sender<typename std::decay<Ts>::type...>{
+                hpx::make_tuple(std::forward<Ts>(ts)...)};
+        }
+    } just{};
+}}}    // namespace hpx::execution::experimental
@@ -0,0 +1,207 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/datastructures/optional.hpp>
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/execution/algorithms/detail/sender_util.hpp>
+#include <hpx/execution_base/operation_state.hpp>
+#include <hpx/execution_base/receiver.hpp>
+#include <hpx/execution_base/sender.hpp>
+#include <hpx/functional/invoke_fused.hpp>
+#include <hpx/functional/tag_fallback_invoke.hpp>
+
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace execution { namespace experimental {
+    namespace detail {
+        template <typename OperationState>
+        struct let_value_predecessor_receiver
+        {
+            OperationState* op_state_;
+
+            void set_error(std::exception_ptr ep) noexcept
+            {
+                hpx::execution::experimental::set_error(
+                    std::move(op_state_->receiver_), std::move(ep));
+            }
+
+            void set_done() noexcept
+            {
+                hpx::execution::experimental::set_done(
+                    std::move(op_state_->receiver_));
+            }
+
+            template <typename... Ts>
+            void set_value(Ts&&... ts) noexcept
+            {
+                op_state_->set_value(std::forward<Ts>(ts)...);
+            }
+        };
+
+        template <typename Sender, typename F>
+        struct let_value_successor_sender
+        {
+            using type = typename std::decay<
+                typename hpx::util::detail::invoke_fused_result<F&,
+                    decayed_tuple_t<value_pack_t<Sender>>&>::type>::type;
+        };
+
+        template <typename Sender, typename Receiver, typename F>
+        struct let_value_operation_state
+        {
+        private:
+            using predecessor_receiver_type =
+                let_value_predecessor_receiver<let_value_operation_state>;
+            using predecessor_operation_state_type =
+                decltype(hpx::execution::experimental::connect(
+                    std::declval<Sender>(),
+                    std::declval<predecessor_receiver_type>()));
+
+            using values_type = decayed_tuple_t<value_pack_t<Sender>>;
+            using successor_sender_type =
+                typename let_value_successor_sender<Sender, F>::type;
+            using successor_operation_state_type =
+                decltype(hpx::execution::experimental::connect(
+                    std::declval<successor_sender_type>(),
+                    std::declval<Receiver>()));
+
+            friend struct let_value_predecessor_receiver<
+                let_value_operation_state>;
+
+        public:
+            let_value_operation_state(
+                Sender&& sender, Receiver&& receiver, F&& f)
+              : sender_(std::move(sender))
+              , receiver_(std::move(receiver))
+              , f_(std::move(f))
+            {
+            }
+
+            void start() noexcept
+            {
+                // the predecessor is connected only now to make sure that its
+                // receiver refers to the final location of this operation
+                // state
+                try
+                {
+                    predecessor_op_state_.emplace(
+                        hpx::execution::experimental::connect(
+                            std::move(sender_),
+                            predecessor_receiver_type{this}));
+                }
+                catch (...)
+                {
+                    hpx::execution::experimental::set_error(
+                        std::move(receiver_), std::current_exception());
+                    return;
+                }
+
+                hpx::execution::experimental::start(*predecessor_op_state_);
+            }
+
+        private:
+            template <typename... Ts>
+            void set_value(Ts&&... ts) noexcept
+            {
+                try
+                {
+                    // the values are kept alive until the successor completes
+                    values_.emplace(std::forward<Ts>(ts)...);
+                    successor_op_state_.emplace(
+                        hpx::execution::experimental::connect(
+                            hpx::util::invoke_fused(f_, *values_),
+                            std::move(receiver_)));
+                }
+                catch (...)
+                {
+                    hpx::execution::experimental::set_error(
+                        std::move(receiver_), std::current_exception());
+                    return;
+                }
+
+                hpx::execution::experimental::start(*successor_op_state_);
+            }
+
+            Sender sender_;
+            Receiver receiver_;
+            F f_;
+
+            hpx::util::optional<predecessor_operation_state_type>
+                predecessor_op_state_;
+            hpx::util::optional<values_type> values_;
+            hpx::util::optional<successor_operation_state_type>
+                successor_op_state_;
+        };
+
+        template <typename Sender, typename F>
+        struct let_value_sender
+        {
+            Sender sender_;
+            F f_;
+
+            using successor_sender_type =
+                typename let_value_successor_sender<Sender, F>::type;
+
+            template <template <typename...> class Tuple,
+                template <typename...> class Variant>
+            using value_types = typename hpx::execution::experimental::traits::
+                sender_traits<successor_sender_type>::template value_types<
+                    Tuple, Variant>;
+
+            template <template <typename...> class Variant>
+            using error_types = Variant<std::exception_ptr>;
+
+            static constexpr bool sends_done =
+                hpx::execution::experimental::traits::sender_traits<
+                    Sender>::sends_done ||
+                hpx::execution::experimental::traits::sender_traits<
+                    successor_sender_type>::sends_done;
+
+            template <typename Receiver>
+            let_value_operation_state<Sender,
+                typename std::decay<Receiver>::type, F>
+            connect(Receiver&& receiver) &&
+            {
+                return {std::move(sender_),
+                    typename std::decay<Receiver>::type(
+                        std::forward<Receiver>(receiver)),
+                    std::move(f_)};
+            }
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// let_value(s, f) returns a sender which invokes f with lvalue
+    /// references to the values sent by s. f has to return a sender, the
+    /// returned sender completes as the sender returned by f. The values sent
+    /// by s are kept alive until the sender returned by f completes. The
+    /// operation states of both senders are embedded into the operation
+    /// state of the returned sender.
+    HPX_INLINE_CONSTEXPR_VARIABLE struct let_value_t final
+      : hpx::functional::tag_fallback<let_value_t>
+    {
+    private:
+        // clang-format off
+        template <typename Sender, typename F,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::execution::experimental::traits::is_sender_v<Sender>
+            )>
+        // clang-format on
+        friend constexpr HPX_FORCEINLINE auto tag_fallback_invoke(
+            let_value_t, Sender&& sender, F&& f)
+        {
+            return detail::let_value_sender<typename std::decay<Sender>::type,
+                typename std::decay<F>::type>{
+                std::forward<Sender>(sender), std::forward<F>(f)};
+        }
+    } let_value{};
+}}}    // namespace hpx::execution::experimental
@@ -0,0 +1,176 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/datastructures/optional.hpp>
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/execution/algorithms/detail/sender_util.hpp>
+#include <hpx/execution_base/operation_state.hpp>
+#include <hpx/execution_base/receiver.hpp>
+#include <hpx/execution_base/sender.hpp>
+#include <hpx/functional/tag_fallback_invoke.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/synchronization/detail/condition_variable.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <exception>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace execution { namespace experimental {
+    namespace detail {
+        template <typename Sender>
+        struct sync_wait_state
+        {
+            using mutex_type = hpx::lcos::local::spinlock;
+            using values_type = decayed_tuple_t<value_pack_t<Sender>>;
+
+            mutex_type mtx_;
+            hpx::lcos::local::detail::condition_variable cond_;
+            bool completed_ = false;
+
+            hpx::util::optional<values_type> values_;
+            std::exception_ptr error_;
+            bool done_ = false;
+
+            template <typename F>
+            void complete(F&& f) noexcept
+            {
+                std::unique_lock<mutex_type> l(mtx_);
+                f();
+                completed_ = true;
+
+                // the waiting thread can't return before the lock has been
+                // released
+                cond_.notify_all(std::move(l));
+            }
+
+            void wait()
+            {
+                std::unique_lock<mutex_type> l(mtx_);
+                while (!completed_)
+                {
+                    cond_.wait(l, "sync_wait");
+                }
+            }
+        };
+
+        template <typename Sender>
+        struct sync_wait_receiver
+        {
+            sync_wait_state<Sender>* state_;
+
+            void set_error(std::exception_ptr ep) noexcept
+            {
+                state_->complete([&]() { state_->error_ = std::move(ep); });
+            }
+
+            void set_done() noexcept
+            {
+                state_->complete([&]() { state_->done_ = true; });
+            }
+
+            template <typename... Ts>
+            void set_value(Ts&&... ts) noexcept
+            {
+                state_->complete([&]() {
+                    try
+                    {
+                        state_->values_.emplace(std::forward<Ts>(ts)...);
+                    }
+                    catch (...)
+                    {
+                        state_->error_ = std::current_exception();
+                    }
+                });
+            }
+        };
+
+        template <typename Values>
+        void sync_wait_get(hpx::util::optional<Values>&, std::true_type)
+        {
+        }
+
+        template <typename Values>
+        typename hpx::tuple_element<0, Values>::type sync_wait_get(
+            hpx::util::optional<Values>& values, std::false_type)
+        {
+            return std::move(hpx::get<0>(*values));
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// sync_wait(s) starts the given sender and blocks the calling thread
+    /// (HPX thread or not) until it completes. It returns the value sent by s
+    /// (nothing if s sends no values, a hpx::tuple if s sends more than one
+    /// value), rethrows the exception s completed with, or throws an
+    /// hpx::exception (hpx::future_cancelled) if s was canceled. The
+    /// operation state of s lives on the stack of the calling thread.
+    HPX_INLINE_CONSTEXPR_VARIABLE struct sync_wait_t final
+      : hpx::functional::tag_fallback<sync_wait_t>
+    {
+    private:
+        template <typename Sender>
+        static auto get_result(
+            detail::sync_wait_state<Sender>& state, std::true_type)
+        {
+            // more than one value is returned as a tuple
+            return std::move(*state.values_);
+        }
+
+        template <typename Sender>
+        static auto get_result(
+            detail::sync_wait_state<Sender>& state, std::false_type)
+        {
+            using values_type =
+                typename detail::sync_wait_state<Sender>::values_type;
+            return detail::sync_wait_get(state.values_,
+                std::integral_constant<bool,
+                    hpx::tuple_size<values_type>::value == 0>{});
+        }
+
+        // clang-format off
+        template <typename Sender,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::execution::experimental::traits::is_sender_v<Sender>
+            )>
+        // clang-format on
+        friend auto tag_fallback_invoke(sync_wait_t, Sender&& sender)
+        {
+            using state_type =
+                detail::sync_wait_state<typename std::decay<Sender>::type>;
+            using values_type = typename state_type::values_type;
+
+            state_type state;
+            auto op_state = hpx::execution::experimental::connect(
+                std::forward<Sender>(sender),
+                detail::sync_wait_receiver<typename std::decay<Sender>::type>{
+                    &state});
+            hpx::execution::experimental::start(op_state);
+
+            state.wait();
+
+            if (state.error_)
+            {
+                std::rethrow_exception(std::move(state.error_));
+            }
+
+            if (state.done_)
+            {
+                HPX_THROW_EXCEPTION(hpx::future_cancelled, "sync_wait",
+                    "the sender passed to sync_wait was canceled");
+            }
+
+            return get_result(state,
+                std::integral_constant<bool,
+                    (hpx::tuple_size<values_type>::value > 1)>{});
+        }
+    } sync_wait{};
+}}}    // namespace hpx::execution::experimental
@@ -0,0 +1,137 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/execution/algorithms/detail/sender_util.hpp>
+#include <hpx/execution_base/receiver.hpp>
+#include <hpx/execution_base/sender.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_fallback_invoke.hpp>
+#include <hpx/type_support/pack.hpp>
+
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace execution { namespace experimental {
+    namespace detail {
+        template <typename Receiver, typename F>
+        struct then_receiver
+        {
+            Receiver receiver_;
+            F f_;
+
+            void set_error(std::exception_ptr ep) noexcept
+            {
+                hpx::execution::experimental::set_error(
+                    std::move(receiver_), std::move(ep));
+            }
+
+            void set_done() noexcept
+            {
+                hpx::execution::experimental::set_done(std::move(receiver_));
+            }
+
+        private:
+            template <typename... Ts>
+            void set_value_helper(std::true_type, Ts&&... ts)
+            {
+                HPX_INVOKE(std::move(f_), std::forward<Ts>(ts)...);
+                hpx::execution::experimental::set_value(std::move(receiver_));
+            }
+
+            template <typename... Ts>
+            void set_value_helper(std::false_type, Ts&&... ts)
+            {
+                hpx::execution::experimental::set_value(std::move(receiver_),
+                    HPX_INVOKE(std::move(f_), std::forward<Ts>(ts)...));
+            }
+
+        public:
+            template <typename... Ts>
+            void set_value(Ts&&... ts) noexcept
+            {
+                using is_void = std::is_void<
+                    typename hpx::util::invoke_result<F, Ts...>::type>;
+
+                try
+                {
+                    set_value_helper(is_void{}, std::forward<Ts>(ts)...);
+                }
+                catch (...)
+                {
+                    hpx::execution::experimental::set_error(
+                        std::move(receiver_), std::current_exception());
+                }
+            }
+        };
+
+        template <typename Sender, typename F>
+        struct then_sender
+        {
+            Sender sender_;
+            F f_;
+
+            template <template <typename...> class Tuple,
+                template <typename...> class Variant>
+            using value_types = Variant<typename result_tuple<Tuple,
+                typename invoke_result_pack<F,
+                    value_pack_t<Sender>>::type>::type>;
+
+            template <template <typename...> class Variant>
+            using error_types = Variant<std::exception_ptr>;
+
+            static constexpr bool sends_done =
+                hpx::execution::experimental::traits::sender_traits<
+                    Sender>::sends_done;
+
+            template <typename Receiver>
+            auto connect(Receiver&& receiver) &&
+            {
+                return hpx::execution::experimental::connect(
+                    std::move(sender_),
+                    then_receiver<typename std::decay<Receiver>::type, F>{
+                        std::forward<Receiver>(receiver), std::move(f_)});
+            }
+
+            template <typename Receiver>
+            auto connect(Receiver&& receiver) const&
+            {
+                return hpx::execution::experimental::connect(sender_,
+                    then_receiver<typename std::decay<Receiver>::type, F>{
+                        std::forward<Receiver>(receiver), f_});
+            }
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// then(s, f) returns a sender which invokes f with the values sent by
+    /// s and sends the result of f (if any). Exceptions thrown by f are
+    /// reported through the error channel. The receiver of the continuation
+    /// is embedded into the operation state of s, no allocation is needed
+    /// for chaining continuations.
+    HPX_INLINE_CONSTEXPR_VARIABLE struct then_t final
+      : hpx::functional::tag_fallback<then_t>
+    {
+    private:
+        // clang-format off
+        template <typename Sender, typename F,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::execution::experimental::traits::is_sender_v<Sender>
+            )>
+        // clang-format on
+        friend constexpr HPX_FORCEINLINE auto tag_fallback_invoke(
+            then_t, Sender&& sender, F&& f)
+        {
+            return detail::then_sender<typename std::decay<Sender>::type,
+                typename std::decay<F>::type>{
+                std::forward<Sender>(sender), std::forward<F>(f)};
+        }
+    } then{};
+}}}    // namespace hpx::execution::experimental
@@ -0,0 +1,289 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/datastructures/optional.hpp>
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/execution/algorithms/detail/sender_util.hpp>
+#include <hpx/execution_base/operation_state.hpp>
+#include <hpx/execution_base/receiver.hpp>
+#include <hpx/execution_base/sender.hpp>
+#include <hpx/functional/invoke_fused.hpp>
+#include <hpx/functional/tag_fallback_invoke.hpp>
+#include <hpx/type_support/pack.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace execution { namespace experimental {
+    namespace detail {
+        template <typename OperationState, std::size_t I>
+        struct when_all_receiver
+        {
+            OperationState* op_state_;
+
+            void set_error(std::exception_ptr ep) noexcept
+            {
+                op_state_->set_error(std::move(ep));
+            }
+
+            void set_done() noexcept
+            {
+                op_state_->set_done();
+            }
+
+            template <typename... Ts>
+            void set_value(Ts&&... ts) noexcept
+            {
+                op_state_->template set_value<I>(std::forward<Ts>(ts)...);
+            }
+        };
+
+        template <typename Receiver, typename... Senders>
+        struct when_all_operation_state
+        {
+        private:
+            using index_pack_type =
+                typename hpx::util::make_index_pack<sizeof...(Senders)>::type;
+
+            template <std::size_t I>
+            using sender_type =
+                typename hpx::util::at_index<I, Senders...>::type;
+
+            template <std::size_t I>
+            using operation_state_type =
+                decltype(hpx::execution::experimental::connect(
+                    std::declval<sender_type<I>>(),
+                    std::declval<
+                        when_all_receiver<when_all_operation_state, I>>()));
+
+            template <typename IndexPack>
+            struct operation_states;
+
+            template <std::size_t... Is>
+            struct operation_states<hpx::util::index_pack<Is...>>
+            {
+                using type = hpx::tuple<
+                    hpx::util::optional<operation_state_type<Is>>...>;
+            };
+
+        public:
+            when_all_operation_state(
+                Receiver&& receiver, hpx::tuple<Senders...>&& senders)
+              : receiver_(std::move(receiver))
+              , senders_(std::move(senders))
+              , count_(sizeof...(Senders))
+              , has_error_(false)
+              , done_(false)
+            {
+            }
+
+            // operation states must not be moved once they have been started,
+            // the move constructor is needed for returning them from connect
+            // in C++14 only
+            when_all_operation_state(when_all_operation_state&& rhs)
+              : receiver_(std::move(rhs.receiver_))
+              , senders_(std::move(rhs.senders_))
+              , count_(sizeof...(Senders))
+              , has_error_(false)
+              , done_(false)
+            {
+            }
+
+            when_all_operation_state& operator=(
+                when_all_operation_state&&) = delete;
+
+            void start() noexcept
+            {
+                if (sizeof...(Senders) == 0)
+                {
+                    finish();
+                    return;
+                }
+                start_helper(index_pack_type{});
+            }
+
+            template <std::size_t I, typename... Ts>
+            void set_value(Ts&&... ts) noexcept
+            {
+                try
+                {
+                    hpx::get<I>(values_).emplace(std::forward<Ts>(ts)...);
+                }
+                catch (...)
+                {
+                    set_error(std::current_exception());
+                    return;
+                }
+
+                if (--count_ == 0)
+                    finish();
+            }
+
+            void set_error(std::exception_ptr ep) noexcept
+            {
+                if (!has_error_.exchange(true))
+                    error_ = std::move(ep);
+
+                if (--count_ == 0)
+                    finish();
+            }
+
+            void set_done() noexcept
+            {
+                done_ = true;
+
+                if (--count_ == 0)
+                    finish();
+            }
+
+        private:
+            template <std::size_t... Is>
+            void start_helper(hpx::util::index_pack<Is...>) noexcept
+            {
+                // the child senders are connected only now to make sure that
+                // their receivers refer to the final location of this
+                // operation state
+                try
+                {
+                    int const sequencer[] = {0,
+                        (hpx::get<Is>(op_states_).emplace(
+                             hpx::execution::experimental::connect(
+                                 std::move(hpx::get<Is>(senders_)),
+                                 when_all_receiver<when_all_operation_state,
+                                     Is>{this})),
+                            0)...};
+                    (void) sequencer;
+                }
+                catch (...)
+                {
+                    hpx::execution::experimental::set_error(
+                        std::move(receiver_), std::current_exception());
+                    return;
+                }
+
+                // this operation state may be destroyed as soon as the last
+                // child operation completes
+                int const sequencer[] = {0,
+                    (hpx::execution::experimental::start(
+                         *hpx::get<Is>(op_states_)),
+                        0)...};
+                (void) sequencer;
+            }
+
+            template <std::size_t... Is>
+            void set_value_helper(hpx::util::index_pack<Is...>)
+            {
+                hpx::util::invoke_fused(
+                    [this](auto&&... ts) {
+                        hpx::execution::experimental::set_value(
+                            std::move(receiver_),
+                            std::forward<decltype(ts)>(ts)...);
+                    },
+                    hpx::tuple_cat(std::move(*hpx::get<Is>(values_))...));
+            }
+
+            void finish() noexcept
+            {
+                if (has_error_)
+                {
+                    hpx::execution::experimental::set_error(
+                        std::move(receiver_), std::move(error_));
+                }
+                else if (done_)
+                {
+                    hpx::execution::experimental::set_done(
+                        std::move(receiver_));
+                }
+                else
+                {
+                    try
+                    {
+                        set_value_helper(index_pack_type{});
+                    }
+                    catch (...)
+                    {
+                        hpx::execution::experimental::set_error(
+                            std::move(receiver_), std::current_exception());
+                    }
+                }
+            }
+
+            Receiver receiver_;
+            hpx::tuple<Senders...> senders_;
+            typename operation_states<index_pack_type>::type op_states_;
+            hpx::tuple<hpx::util::optional<
+                decayed_tuple_t<value_pack_t<Senders>>>...>
+                values_;
+
+            std::atomic<std::size_t> count_;
+            std::atomic<bool> has_error_;
+            std::atomic<bool> done_;
+            std::exception_ptr error_;
+        };
+
+        template <typename... Senders>
+        struct when_all_sender
+        {
+            hpx::tuple<Senders...> senders_;
+
+            template <template <typename...> class Tuple,
+                template <typename...> class Variant>
+            using value_types = Variant<typename apply_pack<Tuple,
+                typename concat_packs<value_pack_t<Senders>...>::type>::type>;
+
+            template <template <typename...> class Variant>
+            using error_types = Variant<std::exception_ptr>;
+
+            static constexpr bool sends_done = hpx::util::any_of<
+                std::integral_constant<bool,
+                    hpx::execution::experimental::traits::sender_traits<
+                        Senders>::sends_done>...>::value;
+
+            template <typename Receiver>
+            when_all_operation_state<typename std::decay<Receiver>::type,
+                Senders...>
+            connect(Receiver&& receiver) &&
+            {
+                return {std::forward<Receiver>(receiver), std::move(senders_)};
+            }
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// when_all(ss...) returns a sender which completes once all given
+    /// senders have completed. It sends the values of all senders (in the
+    /// order the senders were given). If any of the senders completes with
+    /// an error (or is canceled) the returned sender completes with the
+    /// (first) error (or is canceled) after all senders have completed. The
+    /// operation states of all senders are embedded into the operation state
+    /// of the returned sender.
+    HPX_INLINE_CONSTEXPR_VARIABLE struct when_all_t final
+      : hpx::functional::tag_fallback<when_all_t>
+    {
+    private:
+        // clang-format off
+        template <typename... Senders,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::util::all_of<hpx::execution::experimental::traits::
+                    is_sender<Senders>...>::value
+            )>
+        // clang-format on
+        friend constexpr HPX_FORCEINLINE auto tag_fallback_invoke(
+            when_all_t, Senders&&... senders)
+        {
+            return detail::when_all_sender<
+                typename std::decay<Senders>::type...>{
+                hpx::make_tuple(std::forward<Senders>(senders)...)};
+        }
+    } when_all{};
+}}}    // namespace hpx::execution::experimental
@@ -8,7 +8,7 @@
 #pragma once
 
 #include <hpx/config.hpp>
-#include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_base/traits/is_launch_policy.hpp>
@@ -62,8 +62,9 @@ namespace hpx { namespace lcos { namespace detail {
 
             typename hpx::traits::detail::shared_state_ptr<result_type>::type
                 p = detail::make_continuation_alloc<continuation_result_type>(
-                    hpx::util::internal_allocator<>{}, std::move(fut),
-                    std::forward<Policy_>(policy), std::forward<F>(f));
+                    hpx::util::thread_local_caching_allocator<>{},
+                    std::move(fut), std::forward<Policy_>(policy),
+                    std::forward<F>(f));
             return hpx::traits::future_access<future<result_type>>::create(
                 std::move(p));
         }
@@ -0,0 +1,378 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/adaptive_chunk_size.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/execution/traits/is_executor_parameters.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/threading_base/thread_helpers.hpp>
+
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/execution_base/execution.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Loop iterations are divided into pieces and then assigned to threads.
+    /// The number of loop iterations combined is determined based on the
+    /// measured cost per iteration and the measured scheduling overhead per
+    /// chunk of the previous invocations of the same parallel algorithm.
+    /// This executor parameters type makes sure that each chunk runs for at
+    /// least a given multiple of the scheduling overhead, creating fewer
+    /// chunks (and thus using fewer cores) for small inputs and up to
+    /// \a chunks_per_core chunks per core for large inputs.
+    ///
+    /// The measurements are shared by all copies of an \a adaptive_chunk_size
+    /// object, an object should be created once per call site (e.g. as a
+    /// static variable) and reused for all invocations of the algorithm.
+    /// Concurrent invocations are measured separately and merged into the
+    /// shared history once they have finished. The first invocation measures
+    /// the execution time of 1% of the iterations to bootstrap the cost per
+    /// iteration.
+    ///
+    struct adaptive_chunk_size
+    {
+    public:
+        /// Construct an \a adaptive_chunk_size executor parameters object
+        ///
+        /// \param overhead_ratio   [in] The minimal ratio of the execution
+        ///                         time of a chunk and the scheduling overhead
+        ///                         per chunk.
+        /// \param chunks_per_core  [in] The maximal number of chunks created
+        ///                         per core.
+        ///
+        /// \note Default constructed \a adaptive_chunk_size executor parameter
+        ///       types make sure that the scheduling overhead is at most 10%
+        ///       of the execution time of each chunk and that each chunk runs
+        ///       for at least 10 microseconds.
+        ///
+        explicit adaptive_chunk_size(std::uint64_t overhead_ratio = 10,
+            std::uint64_t chunks_per_core = 4)
+          : overhead_ratio_(overhead_ratio)
+          , chunks_per_core_(chunks_per_core)
+          , min_time_(10000)
+          , data_(std::make_shared<shared_data>())
+        {
+        }
+
+        /// Construct an \a adaptive_chunk_size executor parameters object
+        ///
+        /// \param rel_time         [in] The minimal time for which any of the
+        ///                         scheduled chunks should run.
+        /// \param overhead_ratio   [in] The minimal ratio of the execution
+        ///                         time of a chunk and the scheduling overhead
+        ///                         per chunk.
+        /// \param chunks_per_core  [in] The maximal number of chunks created
+        ///                         per core.
+        ///
+        explicit adaptive_chunk_size(
+            hpx::chrono::steady_duration const& rel_time,
+            std::uint64_t overhead_ratio = 10,
+            std::uint64_t chunks_per_core = 4)
+          : overhead_ratio_(overhead_ratio)
+          , chunks_per_core_(chunks_per_core)
+          , min_time_(rel_time.value().count())
+          , data_(std::make_shared<shared_data>())
+        {
+        }
+
+        /// Return the currently estimated execution time per iteration in
+        /// nanoseconds (zero if no estimate is available yet).
+        std::uint64_t get_iteration_time() const
+        {
+            std::lock_guard<mutex_type> l(data_->mtx_);
+            return data_->iteration_time_;
+        }
+
+        /// Return the currently estimated scheduling overhead per chunk in
+        /// nanoseconds (zero if no estimate is available yet).
+        std::uint64_t get_overhead_time() const
+        {
+            std::lock_guard<mutex_type> l(data_->mtx_);
+            return data_->overhead_time_;
+        }
+
+        /// \cond NOINTERNAL
+        // The timing hooks are invoked on (possibly different) temporary
+        // copies of the parameters object, the measurements of a running
+        // invocation are kept with the shared history instead. An invocation
+        // is identified by the thread which started it and by the executor
+        // object passed to the hooks.
+        template <typename Executor>
+        void mark_begin_execution(Executor&& exec)
+        {
+            invocation c;
+            c.thread_ = hpx::threads::get_self_id();
+            c.exec_ = std::addressof(exec);
+            c.begin_ = hpx::chrono::high_resolution_clock::now();
+
+            std::lock_guard<mutex_type> l(data_->mtx_);
+            data_->running_.push_back(c);
+        }
+
+        template <typename Executor>
+        void mark_end_of_scheduling(Executor&& exec)
+        {
+            std::uint64_t const end_of_scheduling =
+                hpx::chrono::high_resolution_clock::now();
+
+            std::lock_guard<mutex_type> l(data_->mtx_);
+            if (invocation* c = data_->scheduling(std::addressof(exec)))
+            {
+                c->end_of_scheduling_ = end_of_scheduling;
+            }
+        }
+
+        template <typename Executor>
+        void mark_end_execution(Executor&& exec)
+        {
+            std::uint64_t const end = hpx::chrono::high_resolution_clock::now();
+
+            std::lock_guard<mutex_type> l(data_->mtx_);
+            data_->finish(std::addressof(exec), end);
+        }
+
+        // Estimate a chunk size based on number of cores used and the history
+        // of the previous invocations.
+        template <typename Executor, typename F>
+        std::size_t get_chunk_size(
+            Executor&& exec, F&& f, std::size_t cores, std::size_t count)
+        {
+            std::uint64_t iteration_time = 0;
+            std::uint64_t overhead_time = 0;
+            {
+                std::lock_guard<mutex_type> l(data_->mtx_);
+                iteration_time = data_->iteration_time_;
+                overhead_time = data_->overhead_time_;
+            }
+
+            // bootstrap the cost per iteration by timing 1% of the iterations
+            if (iteration_time == 0 && count >= 100)
+            {
+                using hpx::chrono::high_resolution_clock;
+                std::uint64_t t = high_resolution_clock::now();
+
+                // use executor to launch given function for measurements
+                std::size_t test_chunk_size =
+                    hpx::parallel::execution::sync_execute(
+                        std::forward<Executor>(exec), f, count / 100);
+
+                if (test_chunk_size != 0)
+                {
+                    t = high_resolution_clock::now() - t;
+                    iteration_time = (std::max)(
+                        std::uint64_t(1), t / std::uint64_t(test_chunk_size));
+                    count -= test_chunk_size;
+
+                    std::lock_guard<mutex_type> l(data_->mtx_);
+                    if (invocation* c = data_->scheduling(nullptr))
+                    {
+                        c->test_time_ += t;
+                    }
+                    if (data_->iteration_time_ == 0)
+                    {
+                        data_->iteration_time_ = iteration_time;
+                    }
+                }
+            }
+
+            std::size_t const max_chunks = chunks_per_core_ * cores;
+            std::size_t chunk_size = (count + max_chunks - 1) / max_chunks;
+
+            if (iteration_time != 0)
+            {
+                // each chunk should run for a multiple of the overhead
+                std::uint64_t const target_time =
+                    (std::max)(min_time_, overhead_ratio_ * overhead_time);
+                std::size_t const min_chunk_size = static_cast<std::size_t>(
+                    (target_time + iteration_time - 1) / iteration_time);
+
+                chunk_size = (std::max)(chunk_size, min_chunk_size);
+            }
+
+            chunk_size =
+                (std::max)(std::size_t(1), (std::min)(chunk_size, count));
+
+            std::lock_guard<mutex_type> l(data_->mtx_);
+            if (invocation* c = data_->scheduling(nullptr))
+            {
+                c->count_ += count;
+                c->chunks_ += (count + chunk_size - 1) / chunk_size;
+                c->cores_ = cores;
+            }
+
+            return chunk_size;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        using mutex_type = hpx::lcos::local::spinlock;
+
+        // data collected for a single invocation of an algorithm
+        struct invocation
+        {
+            hpx::threads::thread_id_type thread_;
+            void const* exec_ = nullptr;
+            std::uint64_t begin_ = 0;
+            std::uint64_t end_of_scheduling_ = 0;
+            std::uint64_t test_time_ = 0;
+            std::size_t count_ = 0;
+            std::size_t chunks_ = 0;
+            std::size_t cores_ = 0;
+        };
+
+        struct shared_data
+        {
+            // Update the estimates using exponential smoothing, the weight of
+            // the newest sample is 1/4.
+            static std::uint64_t smooth(std::uint64_t old_value,
+                std::uint64_t new_value) noexcept
+            {
+                return old_value == 0 ? new_value :
+                                        (3 * old_value + new_value) / 4;
+            }
+
+            // Return the invocation started by the current thread which is
+            // still scheduling its chunks, the most recently started one
+            // first. get_chunk_size may be passed a different executor
+            // object than the timing hooks, it doesn't check the executor.
+            invocation* scheduling(void const* exec) noexcept
+            {
+                hpx::threads::thread_id_type const id =
+                    hpx::threads::get_self_id();
+                for (auto it = running_.rbegin(); it != running_.rend(); ++it)
+                {
+                    if (it->thread_ == id && it->end_of_scheduling_ == 0 &&
+                        (exec == nullptr || it->exec_ == exec))
+                    {
+                        return &*it;
+                    }
+                }
+                return nullptr;
+            }
+
+            // Remove the finished invocation running on the given executor
+            // and merge its measurements into the history. The executor of
+            // an asynchronous invocation is owned by that invocation and
+            // identifies it, even if it finishes on a different thread.
+            void finish(void const* exec, std::uint64_t end) noexcept
+            {
+                hpx::threads::thread_id_type const id =
+                    hpx::threads::get_self_id();
+
+                auto found = running_.rend();
+                for (auto it = running_.rbegin(); it != running_.rend(); ++it)
+                {
+                    if (it->exec_ == exec)
+                    {
+                        if (it->thread_ == id)
+                        {
+                            found = it;
+                            break;
+                        }
+                        if (found == running_.rend())
+                        {
+                            found = it;
+                        }
+                    }
+                }
+
+                if (found != running_.rend())
+                {
+                    update(*found, end);
+                    running_.erase(std::next(found).base());
+                }
+            }
+
+            // Merge the measurements of a finished invocation into the
+            // history.
+            void update(invocation const& c, std::uint64_t end) noexcept
+            {
+                if (c.begin_ == 0 || c.chunks_ == 0 || c.count_ == 0)
+                {
+                    return;
+                }
+
+                std::uint64_t const elapsed = end - c.begin_ - c.test_time_;
+
+                // the time spent scheduling the chunks
+                std::uint64_t scheduling = 0;
+                if (c.end_of_scheduling_ > c.begin_ + c.test_time_)
+                {
+                    scheduling =
+                        c.end_of_scheduling_ - c.begin_ - c.test_time_;
+                }
+                overhead_time_ = smooth(overhead_time_, scheduling / c.chunks_);
+
+                // the remaining time was spent executing the iterations on
+                // all cores which got a chunk
+                if (elapsed > scheduling)
+                {
+                    std::uint64_t const cores =
+                        (std::min)(c.cores_, c.chunks_);
+                    iteration_time_ = smooth(iteration_time_,
+                        (std::max)(std::uint64_t(1),
+                            (elapsed - scheduling) * cores / c.count_));
+                }
+            }
+
+            mutable mutex_type mtx_;
+            std::uint64_t iteration_time_ = 0;    // nanoseconds
+            std::uint64_t overhead_time_ = 0;     // nanoseconds
+
+            // the invocations which are currently running
+            std::vector<invocation> running_;
+        };
+
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, const unsigned int /* version */)
+        {
+            // the history is local to each locality
+            // clang-format off
+            ar & overhead_ratio_ & chunks_per_core_ & min_time_;
+            // clang-format on
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::uint64_t overhead_ratio_;
+        std::uint64_t chunks_per_core_;
+
+        // minimal time for one chunk (nanoseconds)
+        std::uint64_t min_time_;
+
+        std::shared_ptr<shared_data> data_;
+        /// \endcond
+    };
+}}    // namespace hpx::execution
+
+namespace hpx { namespace parallel { namespace execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<hpx::execution::adaptive_chunk_size>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}}}    // namespace hpx::parallel::execution
@@ -885,4 +885,18 @@ namespace hpx { namespace execution { namespace experimental {
       : hpx::functional::tag<get_hint_t>
     {
     } get_hint{};
+
+    // Executors supporting make_with_stacksize allow to select the stack size
+    // of the threads they create. Tasks which never suspend may use
+    // threads::thread_stacksize::nostack to run directly on the stack of the
+    // worker thread, any attempt to suspend such a task raises an error.
+    HPX_INLINE_CONSTEXPR_VARIABLE struct make_with_stacksize_t
+      : hpx::functional::tag<make_with_stacksize_t>
+    {
+    } make_with_stacksize{};
+
+    HPX_INLINE_CONSTEXPR_VARIABLE struct get_stacksize_t
+      : hpx::functional::tag<get_stacksize_t>
+    {
+    } get_stacksize{};
 }}}    // namespace hpx::execution::experimental
@@ -0,0 +1,82 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_EXPERIMENTAL_SIMD)
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+
+#include <experimental/simd>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace parallel { namespace traits {
+    ///////////////////////////////////////////////////////////////////////////
+    // rebinding keeps the number of elements of the original pack, this
+    // ensures that packs for different element types can be used in lockstep
+    template <typename T, typename Abi, typename NewT>
+    struct rebind_pack<std::experimental::simd<T, Abi>, NewT>
+    {
+        typedef std::experimental::simd<NewT,
+            std::experimental::simd_abi::deduce_t<NewT,
+                std::experimental::simd<T, Abi>::size()>>
+            type;
+    };
+
+    // don't wrap types twice
+    template <typename T, typename Abi1, typename NewT, typename Abi2>
+    struct rebind_pack<std::experimental::simd<T, Abi1>,
+        std::experimental::simd<NewT, Abi2>>
+    {
+        typedef std::experimental::simd<NewT, Abi2> type;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename V, typename ValueType, typename Enable>
+    struct vector_pack_load
+    {
+        typedef typename rebind_pack<V, ValueType>::type value_type;
+
+        template <typename Iter>
+        static value_type aligned(Iter const& iter)
+        {
+            return value_type(
+                std::addressof(*iter), std::experimental::vector_aligned);
+        }
+
+        template <typename Iter>
+        static value_type unaligned(Iter const& iter)
+        {
+            return value_type(
+                std::addressof(*iter), std::experimental::element_aligned);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename V, typename ValueType, typename Enable>
+    struct vector_pack_store
+    {
+        template <typename Iter>
+        static void aligned(V const& value, Iter const& iter)
+        {
+            value.copy_to(
+                std::addressof(*iter), std::experimental::vector_aligned);
+        }
+
+        template <typename Iter>
+        static void unaligned(V const& value, Iter const& iter)
+        {
+            value.copy_to(
+                std::addressof(*iter), std::experimental::element_aligned);
+        }
+    };
+}}}    // namespace hpx::parallel::traits
+
+#endif
@@ -0,0 +1,77 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_EXPERIMENTAL_SIMD)
+
+#include <cstddef>
+#include <type_traits>
+
+#include <experimental/simd>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace parallel { namespace traits {
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        // specifying both, N and an Abi is not allowed
+        template <typename T, std::size_t N, typename Abi>
+        struct vector_pack_type;
+
+        template <typename T, std::size_t N>
+        struct vector_pack_type<T, N, void>
+        {
+            typedef std::experimental::simd<T,
+                std::experimental::simd_abi::fixed_size<N>>
+                type;
+        };
+
+        template <typename T, typename Abi>
+        struct vector_pack_type<T, 0, Abi>
+        {
+            typedef std::experimental::simd<T, Abi> type;
+        };
+
+        template <typename T>
+        struct vector_pack_type<T, 0, void>
+        {
+            typedef std::experimental::native_simd<T> type;
+        };
+
+        template <typename T, typename Abi>
+        struct vector_pack_type<T, 1, Abi>
+        {
+            typedef std::experimental::simd<T,
+                std::experimental::simd_abi::scalar>
+                type;
+        };
+
+        template <typename T>
+        struct vector_pack_type<T, 1, void>
+        {
+            typedef std::experimental::simd<T,
+                std::experimental::simd_abi::scalar>
+                type;
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, std::size_t N, typename Abi>
+    struct vector_pack_type : detail::vector_pack_type<T, N, Abi>
+    {
+    };
+
+    // don't wrap types twice
+    template <typename T, std::size_t N, typename Abi1, typename Abi2>
+    struct vector_pack_type<std::experimental::simd<T, Abi1>, N, Abi2>
+    {
+        typedef std::experimental::simd<T, Abi1> type;
+    };
+}}}    // namespace hpx::parallel::traits
+
+#endif
@@ -22,6 +22,7 @@ namespace hpx { namespace parallel { namespace traits {
 
 #if !defined(__CUDACC__)
 #include <hpx/execution/traits/detail/vc/vector_pack_count_bits.hpp>
+#include <hpx/execution/traits/detail/simd/vector_pack_count_bits.hpp>
 #endif
 
 #endif
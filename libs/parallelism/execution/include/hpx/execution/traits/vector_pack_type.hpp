@@ -37,6 +37,7 @@ namespace hpx { namespace parallel { namespace traits {
 
 #if !defined(__CUDACC__)
 #include <hpx/execution/traits/detail/vc/vector_pack_type.hpp>
+#include <hpx/execution/traits/detail/simd/vector_pack_type.hpp>
 #endif
 
 #endif
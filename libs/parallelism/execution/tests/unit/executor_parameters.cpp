@@ -13,6 +13,8 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <iostream>
 #include <iterator>
@@ -131,6 +133,95 @@ void test_persistent_auto_chunk_size()
     }
 }
 
+void test_adaptive_chunk_size()
+{
+    {
+        hpx::execution::adaptive_chunk_size acs;
+        parameters_test(acs);
+
+        // the history is shared between all copies
+        HPX_TEST_NEQ(acs.get_iteration_time(), std::uint64_t(0));
+    }
+
+    {
+        hpx::execution::adaptive_chunk_size acs(
+            std::chrono::microseconds(100), 20, 8);
+        parameters_test(acs);
+    }
+
+    {
+        // repeated invocations measure both the cost per iteration and the
+        // scheduling overhead per chunk
+        hpx::execution::adaptive_chunk_size acs;
+        hpx::execution::parallel_executor exec;
+
+        std::vector<int> c(10007);
+        for (int i = 0; i != 10; ++i)
+        {
+            hpx::for_each(hpx::execution::par.on(exec).with(acs),
+                std::begin(c), std::end(c), [](int& v) { ++v; });
+        }
+        HPX_TEST(std::all_of(
+            std::begin(c), std::end(c), [](int v) { return v == 10; }));
+
+        std::uint64_t const iteration_time = acs.get_iteration_time();
+        std::uint64_t const overhead_time = acs.get_overhead_time();
+        HPX_TEST_NEQ(iteration_time, std::uint64_t(0));
+        HPX_TEST_NEQ(overhead_time, std::uint64_t(0));
+
+        // the chunks are made large enough to run for at least 10 times the
+        // overhead and at least 10us, but there are no more than 4 chunks
+        // per core and a chunk never exceeds the input
+        std::size_t const cores = 4;
+        std::uint64_t const target_time =
+            (std::max)(std::uint64_t(10000), 10 * overhead_time);
+        std::size_t const min_chunk_size = static_cast<std::size_t>(
+            (target_time + iteration_time - 1) / iteration_time);
+
+        for (std::size_t count : {std::size_t(1), std::size_t(1000),
+                 std::size_t(100000), std::size_t(10000000)})
+        {
+            std::size_t const expected = (std::min)(count,
+                (std::max)((count + 4 * cores - 1) / (4 * cores),
+                    min_chunk_size));
+            HPX_TEST_EQ(acs.get_chunk_size(exec,
+                            [](std::size_t) { return std::size_t(0); }, cores,
+                            count),
+                expected);
+        }
+    }
+
+    {
+        // concurrent invocations sharing the same history are measured
+        // independently
+        hpx::execution::adaptive_chunk_size acs;
+
+        std::vector<int> c1(10007), c2(10007);
+        auto f1 = hpx::async([&]() {
+            for (int i = 0; i != 10; ++i)
+            {
+                hpx::for_each(hpx::execution::par.with(acs), std::begin(c1),
+                    std::end(c1), [](int& v) { ++v; });
+            }
+        });
+        auto f2 = hpx::async([&]() {
+            for (int i = 0; i != 10; ++i)
+            {
+                hpx::for_each(hpx::execution::par.with(acs), std::begin(c2),
+                    std::end(c2), [](int& v) { ++v; });
+            }
+        });
+        hpx::wait_all(f1, f2);
+
+        HPX_TEST(std::all_of(
+            std::begin(c1), std::end(c1), [](int v) { return v == 10; }));
+        HPX_TEST(std::all_of(
+            std::begin(c2), std::end(c2), [](int v) { return v == 10; }));
+        HPX_TEST_NEQ(acs.get_iteration_time(), std::uint64_t(0));
+        HPX_TEST_NEQ(acs.get_overhead_time(), std::uint64_t(0));
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 struct timer_hooks_parameters
 {
@@ -188,6 +279,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
     test_guided_chunk_size();
     test_auto_chunk_size();
     test_persistent_auto_chunk_size();
+    test_adaptive_chunk_size();
 
     test_combined_hooks();
 
@@ -0,0 +1,175 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/execution/algorithms/bulk.hpp>
+#include <hpx/execution/algorithms/just.hpp>
+#include <hpx/execution/algorithms/let_value.hpp>
+#include <hpx/execution/algorithms/sync_wait.hpp>
+#include <hpx/execution/algorithms/then.hpp>
+#include <hpx/execution/algorithms/when_all.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ex = hpx::execution::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_just()
+{
+    static_assert(ex::traits::is_sender_v<decltype(ex::just())>,
+        "just() should return a sender");
+
+    ex::sync_wait(ex::just());
+    HPX_TEST_EQ(ex::sync_wait(ex::just(42)), 42);
+    HPX_TEST_EQ(ex::sync_wait(ex::just(std::string("42"))), std::string("42"));
+
+    auto t = ex::sync_wait(ex::just(42, 3.0));
+    HPX_TEST_EQ(hpx::get<0>(t), 42);
+    HPX_TEST_EQ(hpx::get<1>(t), 3.0);
+}
+
+void test_then()
+{
+    auto s1 = ex::then(ex::just(21), [](int i) { return 2 * i; });
+    static_assert(ex::traits::is_sender_v<decltype(s1)>,
+        "then() should return a sender");
+    HPX_TEST_EQ(ex::sync_wait(std::move(s1)), 42);
+
+    // a chain of continuations, changing the value types along the way
+    auto s2 = ex::then(
+        ex::then(ex::then(ex::just(), []() { return 42; }),
+            [](int i) { return std::to_string(i); }),
+        [](std::string s) { return s + "!"; });
+    HPX_TEST_EQ(ex::sync_wait(std::move(s2)), std::string("42!"));
+
+    // continuations without a result
+    bool called = false;
+    ex::sync_wait(ex::then(ex::just(42), [&](int i) {
+        HPX_TEST_EQ(i, 42);
+        called = true;
+    }));
+    HPX_TEST(called);
+
+    // senders can be connected more than once if they are copyable
+    auto s3 = ex::then(ex::just(1), [](int i) { return i + 1; });
+    HPX_TEST_EQ(ex::sync_wait(s3), 2);
+    HPX_TEST_EQ(ex::sync_wait(s3), 2);
+}
+
+void test_bulk()
+{
+    std::vector<int> v(100, 0);
+    auto s = ex::bulk(ex::just(3), v.size(),
+        [&](std::size_t i, int& value) { v[i] = static_cast<int>(i) * value; });
+    HPX_TEST_EQ(ex::sync_wait(std::move(s)), 3);
+
+    for (std::size_t i = 0; i != v.size(); ++i)
+    {
+        HPX_TEST_EQ(v[i], static_cast<int>(3 * i));
+    }
+}
+
+void test_when_all()
+{
+    auto t = ex::sync_wait(ex::when_all(ex::just(42), ex::just(),
+        ex::then(ex::just(1), [](int i) { return std::to_string(i); })));
+
+    HPX_TEST_EQ(hpx::get<0>(t), 42);
+    HPX_TEST_EQ(hpx::get<1>(t), std::string("1"));
+
+    ex::sync_wait(ex::when_all());
+    ex::sync_wait(ex::when_all(ex::just(), ex::just()));
+
+    HPX_TEST_EQ(ex::sync_wait(ex::when_all(ex::just(42))), 42);
+}
+
+void test_let_value()
+{
+    auto s = ex::let_value(ex::just(std::string("hello")),
+        [](std::string& str) {
+            return ex::then(ex::just(), [&str]() { return str + " world"; });
+        });
+    HPX_TEST_EQ(ex::sync_wait(std::move(s)), std::string("hello world"));
+
+    HPX_TEST_EQ(ex::sync_wait(ex::let_value(ex::just(),
+                    []() { return ex::just(42); })),
+        42);
+}
+
+void test_errors()
+{
+    bool caught = false;
+    try
+    {
+        ex::sync_wait(ex::then(ex::then(ex::just(42),
+                                   [](int) -> int {
+                                       throw std::runtime_error("error");
+                                   }),
+            [](int i) {
+                HPX_TEST(false);
+                return i;
+            }));
+    }
+    catch (std::runtime_error const&)
+    {
+        caught = true;
+    }
+    HPX_TEST(caught);
+
+    caught = false;
+    try
+    {
+        ex::sync_wait(ex::when_all(ex::just(42),
+            ex::then(ex::just(), []() { throw std::runtime_error("error"); })));
+    }
+    catch (std::runtime_error const&)
+    {
+        caught = true;
+    }
+    HPX_TEST(caught);
+
+    caught = false;
+    try
+    {
+        ex::sync_wait(ex::let_value(ex::just(), []() {
+            throw std::runtime_error("error");
+            return ex::just();
+        }));
+    }
+    catch (std::runtime_error const&)
+    {
+        caught = true;
+    }
+    HPX_TEST(caught);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_just();
+    test_then();
+    test_bulk();
+    test_when_all();
+    test_let_value();
+    test_errors();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -17,14 +17,19 @@
 #include <hpx/execution/detail/post_policy_dispatch.hpp>
 #include <hpx/execution/executors/execution.hpp>
 #include <hpx/execution/executors/fused_bulk_execute.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/functional/deferred_call.hpp>
 #include <hpx/futures/future.hpp>
+#include <hpx/futures/futures_factory.hpp>
 #include <hpx/futures/traits/future_traits.hpp>
 #include <hpx/iterator_support/range.hpp>
 #include <hpx/pack_traversal/unwrap.hpp>
 #include <hpx/synchronization/latch.hpp>
+#include <hpx/threading_base/register_thread.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
 
 #include <algorithm>
@@ -35,6 +40,53 @@
 #include <vector>
 
 namespace hpx { namespace parallel { namespace execution { namespace detail {
+    // Return whether the threads for a bulk operation using the given launch
+    // policy can be created in one go. In this case spawning them never
+    // suspends the spawning thread.
+    inline bool can_spawn_bulk(launch policy)
+    {
+        return hpx::detail::has_async_policy(policy) &&
+            policy != launch::sync && policy != launch::fork;
+    }
+
+    // Launch the invocations of f for the elements [part_begin, part_end) of
+    // the shape (starting at it). If the tasks run asynchronously, the
+    // threads for all of them are created in one go.
+    template <typename Result, typename Iter, typename F, typename... Ts>
+    void bulk_async_execute_part(std::vector<hpx::future<Result>>& results,
+        threads::thread_pool_base* pool, threads::thread_priority priority,
+        threads::thread_stacksize stacksize,
+        threads::thread_schedule_hint hint, launch policy,
+        std::size_t part_begin, std::size_t part_end, Iter it, F& f,
+        Ts&... ts)
+    {
+        if (!can_spawn_bulk(policy))
+        {
+            for (std::size_t part_i = part_begin; part_i < part_end; ++part_i)
+            {
+                results[part_i] = hpx::detail::async_launch_policy_dispatch<
+                    decltype(policy)>::call(policy, pool, priority, stacksize,
+                    hint, f, *it, ts...);
+                ++it;
+            }
+            return;
+        }
+
+        std::vector<threads::thread_init_data> data;
+        data.reserve(part_end - part_begin);
+        for (std::size_t part_i = part_begin; part_i < part_end; ++part_i)
+        {
+            lcos::local::futures_factory<Result()> p(
+                hpx::util::deferred_call(f, *it, ts...));
+            data.push_back(p.get_thread_init_data(
+                "async_launch_policy_dispatch", priority, stacksize, hint));
+            results[part_i] = p.get_future();
+            ++it;
+        }
+
+        threads::register_work_bulk(data.data(), data.size(), pool);
+    }
+
     template <typename F, typename S, typename... Ts>
     std::vector<
         hpx::future<typename detail::bulk_function_result<F, S, Ts...>::type>>
@@ -58,6 +110,12 @@ namespace hpx { namespace parallel { namespace execution { namespace detail {
         std::size_t const size = hpx::util::size(shape);
         results.resize(size);
 
+        // the threads spawning the tasks of a partition don't need a stack
+        // of their own as they never suspend
+        threads::thread_stacksize const spawn_stacksize =
+            can_spawn_bulk(policy) ? threads::thread_stacksize::nostack :
+                                     threads::thread_stacksize::small_;
+
         lcos::local::latch l(size);
         std::size_t part_begin = 0;
         auto it = std::begin(shape);
@@ -72,19 +130,12 @@ namespace hpx { namespace parallel { namespace execution { namespace detail {
             if (part_size > hierarchical_threshold)
             {
                 detail::post_policy_dispatch<decltype(policy)>::call(policy,
-                    desc, pool, priority, threads::thread_stacksize::small_,
-                    hint,
+                    desc, pool, priority, spawn_stacksize, hint,
                     [&, hint, part_begin, part_end, part_size, f,
                         it]() mutable {
-                        for (std::size_t part_i = part_begin; part_i < part_end;
-                             ++part_i)
-                        {
-                            results[part_i] =
-                                hpx::detail::async_launch_policy_dispatch<
-                                    decltype(policy)>::call(policy, pool,
-                                    priority, stacksize, hint, f, *it, ts...);
-                            ++it;
-                        }
+                        bulk_async_execute_part(results, pool, priority,
+                            stacksize, hint, policy, part_begin, part_end, it,
+                            f, ts...);
                         l.count_down(part_size);
                     });
 
@@ -92,22 +143,26 @@ namespace hpx { namespace parallel { namespace execution { namespace detail {
             }
             else
             {
-                for (std::size_t part_i = part_begin; part_i < part_end;
-                     ++part_i)
-                {
-                    results[part_i] =
-                        hpx::detail::async_launch_policy_dispatch<decltype(
-                            policy)>::call(policy, pool, priority, stacksize,
-                            hint, f, *it, ts...);
-                    ++it;
-                }
+                bulk_async_execute_part(results, pool, priority, stacksize,
+                    hint, policy, part_begin, part_end, it, f, ts...);
+                std::advance(it, part_size);
                 l.count_down(part_size);
             }
 
             part_begin = part_end;
         }
 
-        l.wait();
+        // a stackless caller can't suspend on the latch, it polls instead
+        threads::thread_data* self = threads::get_self_id_data();
+        if (self != nullptr && self->is_stackless())
+        {
+            hpx::util::yield_while([&l]() { return !l.try_wait(); },
+                "hierarchical_bulk_async_execute_helper");
+        }
+        else
+        {
+            l.wait();
+        }
 
         return results;
     }
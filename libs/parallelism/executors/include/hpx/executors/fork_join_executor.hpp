@@ -12,22 +12,28 @@
 #include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/concurrency/detail/contiguous_index_queue.hpp>
 #include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/datastructures/optional.hpp>
 #include <hpx/execution/detail/async_launch_policy_dispatch.hpp>
 #include <hpx/execution/executors/execution.hpp>
 #include <hpx/execution/executors/static_chunk_size.hpp>
 #include <hpx/execution/traits/is_executor.hpp>
 #include <hpx/functional/invoke.hpp>
 #include <hpx/functional/invoke_fused.hpp>
+#include <hpx/iterator_support/range.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/threading/thread.hpp>
+#include <hpx/threading_base/thread_helpers.hpp>
 #include <hpx/timing/high_resolution_timer.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
+#include <iterator>
 #include <memory>
+#include <mutex>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -49,6 +55,16 @@ namespace hpx { namespace execution { namespace experimental {
     /// worker threads is a slow operation the executor should be reused
     /// whenever possible for multiple adjacent parallel algorithms or
     /// invocations of bulk_(a)sync_execute.
+    ///
+    /// Besides bulk execution the executor provides native reductions and
+    /// scans (bulk_sync_reduce and bulk_sync_scan) which combine the
+    /// partial results of the worker threads without creating futures.
+    ///
+    /// Parallel regions may be nested: work scheduled from within a running
+    /// parallel region through the same executor, or through any other
+    /// fork_join_executor on the same thread pool, is executed inline by the
+    /// calling thread. Executors created from within such a region start
+    /// their worker threads only once they are used outside of it.
     class fork_join_executor
     {
     public:
@@ -88,6 +104,8 @@ namespace hpx { namespace execution { namespace experimental {
                 std::vector<hpx::util::cache_aligned_data<queue_type>>;
             using thread_states_type = std::vector<
                 hpx::util::cache_aligned_data<std::atomic<thread_state>>>;
+            using thread_ids_type =
+                std::vector<std::atomic<threads::thread_id_type>>;
             using thread_function_helper_type = void(void*, void const*, void*,
                 std::size_t, std::size_t, loop_schedule, queues_type&,
                 thread_states_type&, hpx::lcos::local::spinlock&,
@@ -101,9 +119,15 @@ namespace hpx { namespace execution { namespace experimental {
             threads::thread_stacksize stacksize_ =
                 threads::thread_stacksize::small_;
             loop_schedule schedule_ = loop_schedule::static_;
-            std::size_t main_thread_;
+            std::size_t main_thread_ = 0;
             std::size_t num_threads_;
+            bool threads_started_ = false;
+            std::atomic<bool> region_active_{false};
             thread_states_type thread_states_;
+
+            // The HPX threads taking part in the parallel regions, the entry
+            // of the main thread is set only while a region is running.
+            thread_ids_type thread_ids_;
             hpx::lcos::local::spinlock exception_mutex_;
             std::exception_ptr exception_;
             std::chrono::nanoseconds yield_delay_;
@@ -136,6 +160,7 @@ namespace hpx { namespace execution { namespace experimental {
                 hpx::lcos::local::spinlock& exception_mutex_;
                 std::exception_ptr& exception_;
                 std::chrono::nanoseconds& yield_delay_;
+                std::atomic<threads::thread_id_type>& thread_id_;
 
                 // Changing data for each parallel region.
                 std::atomic<thread_function_helper_type*>&
@@ -168,6 +193,8 @@ namespace hpx { namespace execution { namespace experimental {
                 void operator()()
                 {
                     HPX_ASSERT(thread_state_ == thread_state::starting);
+                    thread_id_.store(threads::get_self_id(),
+                        std::memory_order_relaxed);
                     set_state_this_thread(thread_state::idle);
 
                     do
@@ -220,8 +247,9 @@ namespace hpx { namespace execution { namespace experimental {
 
             void init_threads()
             {
-                main_thread_ = get_local_worker_thread_num();
-                num_threads_ = pool_->get_os_thread_count();
+                threads_started_ = true;
+                main_thread_ =
+                    num_threads_ == 1 ? 0 : get_local_worker_thread_num();
                 queues_.resize(num_threads_);
 
                 for (std::size_t t = 0; t < num_threads_; ++t)
@@ -240,12 +268,88 @@ namespace hpx { namespace execution { namespace experimental {
                         priority_, stacksize_, hint,
                         thread_function{num_threads_, t, schedule_,
                             thread_states_[t].data_, exception_mutex_,
-                            exception_, yield_delay_, thread_function_helper_,
-                            element_function_, shape_, size_, argument_pack_,
-                            queues_, thread_states_});
+                            exception_, yield_delay_, thread_ids_[t],
+                            thread_function_helper_, element_function_, shape_,
+                            size_, argument_pack_, queues_, thread_states_});
                 }
 
                 wait_state_all(thread_state::idle);
+
+                region_registry& registry = get_region_registry();
+                std::lock_guard<hpx::lcos::local::spinlock> l(registry.mtx_);
+                registry.executors_.push_back(this);
+            }
+
+            // All executors whose worker threads have been started. This is
+            // used to find the parallel region the calling HPX thread takes
+            // part in, if any.
+            struct region_registry
+            {
+                hpx::lcos::local::spinlock mtx_;
+                std::vector<shared_data const*> executors_;
+            };
+
+            static region_registry& get_region_registry()
+            {
+                static region_registry registry;
+                return registry;
+            }
+
+            // Return whether the given HPX thread takes part in a region of
+            // this executor which is currently running.
+            bool is_participant(threads::thread_id_type const& id) const
+                noexcept
+            {
+                if (!region_active_.load(std::memory_order_acquire))
+                {
+                    return false;
+                }
+
+                for (auto const& thread_id : thread_ids_)
+                {
+                    if (thread_id.load(std::memory_order_relaxed) == id)
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            // The worker threads of a running region occupy all cores of its
+            // pool. Regions started from within a region of this executor, or
+            // of any other executor on the same pool, therefore run inline.
+            // The participants are identified by their HPX thread id, which
+            // stays the same if a thread is resumed on a different core.
+            bool in_parallel_region() const
+            {
+                if (region_active_.load(std::memory_order_acquire))
+                {
+                    return true;
+                }
+
+                threads::thread_id_type const id = threads::get_self_id();
+                if (!id)
+                {
+                    return false;
+                }
+
+                region_registry& registry = get_region_registry();
+                std::lock_guard<hpx::lcos::local::spinlock> l(registry.mtx_);
+                for (shared_data const* executor : registry.executors_)
+                {
+                    if (executor->pool_ == pool_ &&
+                        executor->is_participant(id))
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            static std::size_t get_part_begin(std::size_t thread_index,
+                std::size_t num_threads, std::size_t size) noexcept
+            {
+                return (thread_index * size) / num_threads;
             }
 
             static void init_local_work_queue(queue_type& queue,
@@ -253,9 +357,9 @@ namespace hpx { namespace execution { namespace experimental {
                 std::size_t size)
             {
                 auto const part_begin = static_cast<std::uint32_t>(
-                    (thread_index * size) / num_threads);
+                    get_part_begin(thread_index, num_threads, size));
                 auto const part_end = static_cast<std::uint32_t>(
-                    ((thread_index + 1) * size) / num_threads);
+                    get_part_begin(thread_index + 1, num_threads, size));
                 queue.reset(part_begin, part_end);
             }
 
@@ -269,16 +373,38 @@ namespace hpx { namespace execution { namespace experimental {
               , schedule_(schedule)
               , num_threads_(pool_->get_os_thread_count())
               , thread_states_(num_threads_)
+              , thread_ids_(num_threads_)
               , exception_mutex_()
               , exception_()
               , yield_delay_(yield_delay)
             {
                 HPX_ASSERT(pool_);
-                init_threads();
+
+                // The worker threads could not start while the cores of the
+                // pool are busy with the current region, defer starting them
+                // until the first region which is not nested.
+                if (!in_parallel_region())
+                {
+                    init_threads();
+                }
             }
 
             ~shared_data()
             {
+                if (!threads_started_)
+                {
+                    return;
+                }
+
+                {
+                    region_registry& registry = get_region_registry();
+                    std::lock_guard<hpx::lcos::local::spinlock> l(
+                        registry.mtx_);
+                    registry.executors_.erase(
+                        std::find(registry.executors_.begin(),
+                            registry.executors_.end(), this));
+                }
+
                 set_state_all(thread_state::stopping);
                 set_state_main_thread(thread_state::stopped);
                 wait_state_all(thread_state::stopped);
@@ -416,35 +542,76 @@ namespace hpx { namespace execution { namespace experimental {
                 };
             };
 
-        public:
-            template <typename F, typename S, typename... Ts>
-            void bulk_sync_execute(F&& f, S const& shape, Ts&&... ts)
+            /// This struct implements a parallel region which invokes the
+            /// given function once on each worker thread, passing the index
+            /// of the worker thread and the number of worker threads. It is
+            /// used for the reductions and scans.
+            template <typename F>
+            struct region_function_helper
             {
-                // Set the data for this parallel region
-                element_function_ = static_cast<void*>(&f);
-                shape_ = static_cast<void const*>(&shape);
-                size_ = hpx::util::size(shape);
-                auto argument_pack = hpx::make_tuple<>(std::forward<Ts>(ts)...);
-                argument_pack_ = static_cast<void*>(&argument_pack);
+                static void call(void* region_function_void, void const*,
+                    void*, std::size_t thread_index, std::size_t num_threads,
+                    loop_schedule, queues_type&,
+                    thread_states_type& thread_states,
+                    hpx::lcos::local::spinlock& exception_mutex,
+                    std::exception_ptr& exception)
+                {
+                    thread_states[thread_index].data_ = thread_state::active;
+                    try
+                    {
+                        F& region_function =
+                            *static_cast<F*>(region_function_void);
+                        region_function(thread_index, num_threads);
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard<hpx::lcos::local::spinlock> l(
+                            exception_mutex);
+                        if (!exception)
+                        {
+                            exception = std::current_exception();
+                        }
+                    }
+                    thread_states[thread_index].data_ = thread_state::idle;
+                }
+            };
+
+            /// Run a single parallel region using the given helper, the
+            /// calling thread participates as the main thread.
+            template <typename Helper>
+            void run_region(void* element_function, void const* shape,
+                void* argument_pack)
+            {
+                element_function_ = element_function;
+                shape_ = shape;
+                argument_pack_ = argument_pack;
                 thread_function_helper_ =
-                    static_cast<thread_function_helper_type*>(
-                        &thread_function_helper<typename std::decay<F>::type,
-                            typename std::decay<S>::type,
-                            decltype(argument_pack)>::call);
+                    static_cast<thread_function_helper_type*>(&Helper::call);
+
+                if (!threads_started_)
+                {
+                    init_threads();
+                }
+
+                thread_ids_[main_thread_].store(
+                    threads::get_self_id(), std::memory_order_relaxed);
+                region_active_.store(true, std::memory_order_release);
 
                 // Signal all worker threads to start partitioning work for
                 // themselves, and then starting the actual work.
                 set_state_all(thread_state::partitioning_work);
 
                 // Start work on the main thread.
-                thread_function_helper<typename std::decay<F>::type,
-                    typename std::decay<S>::type,
-                    decltype(argument_pack)>::call(element_function_, shape_,
-                    argument_pack_, main_thread_, num_threads_, schedule_,
-                    queues_, thread_states_, exception_mutex_, exception_);
+                Helper::call(element_function_, shape_, argument_pack_,
+                    main_thread_, num_threads_, schedule_, queues_,
+                    thread_states_, exception_mutex_, exception_);
 
                 wait_state_all(thread_state::idle);
 
+                region_active_.store(false, std::memory_order_release);
+                thread_ids_[main_thread_].store(
+                    threads::invalid_thread_id, std::memory_order_relaxed);
+
                 if (exception_)
                 {
                     std::rethrow_exception(std::move(exception_));
@@ -452,29 +619,266 @@ namespace hpx { namespace execution { namespace experimental {
             }
 
             template <typename F, typename S, typename... Ts>
-            std::vector<hpx::future<typename hpx::parallel::execution::detail::
-                    bulk_function_result<F, S, Ts...>::type>>
-            bulk_async_execute(F&& f, S const& shape, Ts&&... ts)
+            void bulk_sync_execute_void(F&& f, S const& shape, Ts&&... ts)
+            {
+                // Nested parallel regions are executed inline.
+                if (in_parallel_region())
+                {
+                    auto const end = hpx::util::end(shape);
+                    for (auto it = hpx::util::begin(shape); it != end; ++it)
+                    {
+                        hpx::util::invoke(f, *it, ts...);
+                    }
+                    return;
+                }
+
+                // Set the data for this parallel region
+                size_ = hpx::util::size(shape);
+                auto argument_pack = hpx::make_tuple<>(std::forward<Ts>(ts)...);
+
+                run_region<thread_function_helper<typename std::decay<F>::type,
+                    typename std::decay<S>::type, decltype(argument_pack)>>(
+                    static_cast<void*>(&f), static_cast<void const*>(&shape),
+                    static_cast<void*>(&argument_pack));
+            }
+
+            // Invoke the given function once for each worker thread, or once
+            // on the calling thread if this is a nested parallel region.
+            template <typename F>
+            void run_per_thread(F&& f)
+            {
+                if (in_parallel_region())
+                {
+                    f(std::size_t(0), std::size_t(1));
+                    return;
+                }
+
+                using helper_type =
+                    region_function_helper<typename std::decay<F>::type>;
+                run_region<helper_type>(
+                    static_cast<void*>(&f), nullptr, nullptr);
+            }
+
+            template <typename T>
+            using partial_results_type = std::vector<
+                hpx::util::cache_aligned_data<hpx::util::optional<T>>>;
+
+            // Each worker thread reduces the elements of its (static) part of
+            // the shape.
+            template <typename T, typename F, typename S, typename Reduce>
+            partial_results_type<T> reduce_partitions(
+                F& f, S const& shape, Reduce& r)
+            {
+                partial_results_type<T> partials(num_threads_);
+
+                auto const first = hpx::util::begin(shape);
+                std::size_t const size = hpx::util::size(shape);
+
+                run_per_thread([&](std::size_t thread_index,
+                                   std::size_t num_threads) {
+                    std::size_t const part_begin =
+                        get_part_begin(thread_index, num_threads, size);
+                    std::size_t const part_end =
+                        get_part_begin(thread_index + 1, num_threads, size);
+                    if (part_begin == part_end)
+                    {
+                        return;
+                    }
+
+                    auto it = first;
+                    std::advance(it, part_begin);
+
+                    T val = hpx::util::invoke(f, *it);
+                    for (std::size_t i = part_begin + 1; i != part_end; ++i)
+                    {
+                        val = hpx::util::invoke(
+                            r, std::move(val), hpx::util::invoke(f, *++it));
+                    }
+                    partials[thread_index].data_.emplace(std::move(val));
+                });
+
+                return partials;
+            }
+
+        public:
+            template <typename F, typename S, typename... Ts>
+            void bulk_sync_execute(
+                std::true_type, F&& f, S const& shape, Ts&&... ts)
+            {
+                bulk_sync_execute_void(
+                    std::forward<F>(f), shape, std::forward<Ts>(ts)...);
+            }
+
+            template <typename F, typename S, typename... Ts>
+            std::vector<typename hpx::parallel::execution::detail::
+                    bulk_function_result<F, S, Ts...>::type>
+            bulk_sync_execute(
+                std::false_type, F&& f, S const& shape, Ts&&... ts)
+            {
+                using result_type = typename hpx::parallel::execution::
+                    detail::bulk_function_result<F, S, Ts...>::type;
+
+                // Every invocation stores its result in its own slot.
+                std::size_t const size = hpx::util::size(shape);
+                std::vector<hpx::util::optional<result_type>> results(size);
+
+                auto const first = hpx::util::begin(shape);
+                bulk_sync_execute_void(
+                    [&](std::size_t i) {
+                        auto it = first;
+                        std::advance(it, i);
+                        results[i].emplace(hpx::util::invoke(f, *it, ts...));
+                    },
+                    hpx::parallel::execution::detail::make_counting_shape(
+                        size));
+
+                std::vector<result_type> v;
+                v.reserve(size);
+                for (auto& result : results)
+                {
+                    v.push_back(std::move(*result));
+                }
+                return v;
+            }
+
+            template <typename F, typename S, typename... Ts>
+            std::vector<hpx::future<void>> bulk_async_execute(
+                std::true_type, F&& f, S const& shape, Ts&&... ts)
             {
                 // Forward to the synchronous version as we can't create
                 // futures to the completion of the parallel region (this HPX
                 // thread participates in computation).
-                using result_type = typename hpx::parallel::execution::detail::
-                    bulk_function_result<F, S, Ts...>::type;
+                std::vector<hpx::future<void>> v;
+                try
+                {
+                    bulk_sync_execute_void(
+                        std::forward<F>(f), shape, std::forward<Ts>(ts)...);
+                }
+                catch (...)
+                {
+                    v.push_back(hpx::make_exceptional_future<void>(
+                        std::current_exception()));
+                }
+
+                return v;
+            }
+
+            template <typename F, typename S, typename... Ts>
+            std::vector<hpx::future<typename hpx::parallel::execution::detail::
+                    bulk_function_result<F, S, Ts...>::type>>
+            bulk_async_execute(
+                std::false_type, F&& f, S const& shape, Ts&&... ts)
+            {
+                using result_type = typename hpx::parallel::execution::
+                    detail::bulk_function_result<F, S, Ts...>::type;
+
                 std::vector<hpx::future<result_type>> v;
                 try
                 {
-                    bulk_sync_execute(
+                    auto results = bulk_sync_execute(std::false_type{},
                         std::forward<F>(f), shape, std::forward<Ts>(ts)...);
+
+                    v.reserve(results.size());
+                    for (auto& result : results)
+                    {
+                        v.push_back(hpx::make_ready_future(std::move(result)));
+                    }
                 }
                 catch (...)
                 {
+                    v.clear();
                     v.push_back(hpx::make_exceptional_future<result_type>(
                         std::current_exception()));
                 }
 
                 return v;
             }
+
+            template <typename F, typename S, typename T, typename Reduce>
+            T bulk_sync_reduce(F&& f, S const& shape, T init, Reduce&& r)
+            {
+                partial_results_type<T> partials =
+                    reduce_partitions<T>(f, shape, r);
+
+                // Combine the partial results in a tree, keeping the order of
+                // the partitions.
+                std::size_t const num_partials = partials.size();
+                for (std::size_t stride = 1; stride < num_partials;
+                     stride *= 2)
+                {
+                    for (std::size_t i = 0; i + stride < num_partials;
+                         i += 2 * stride)
+                    {
+                        auto& lhs = partials[i].data_;
+                        auto& rhs = partials[i + stride].data_;
+                        if (!rhs)
+                        {
+                            continue;
+                        }
+
+                        if (!lhs)
+                        {
+                            lhs = std::move(rhs);
+                        }
+                        else
+                        {
+                            lhs.emplace(hpx::util::invoke(
+                                r, std::move(*lhs), std::move(*rhs)));
+                        }
+                    }
+                }
+
+                if (num_partials == 0 || !partials[0].data_)
+                {
+                    return init;
+                }
+                return hpx::util::invoke(
+                    r, std::move(init), std::move(*partials[0].data_));
+            }
+
+            template <typename F, typename G, typename S, typename T,
+                typename Op>
+            T bulk_sync_scan(F&& f, G&& g, S const& shape, T init, Op&& op)
+            {
+                partial_results_type<T> partials =
+                    reduce_partitions<T>(f, shape, op);
+
+                // Turn the partial results into the exclusive prefixes of the
+                // partitions.
+                T prefix = std::move(init);
+                for (auto& partial : partials)
+                {
+                    hpx::util::optional<T> part = std::move(partial.data_);
+                    partial.data_.emplace(prefix);
+                    if (part)
+                    {
+                        prefix = hpx::util::invoke(
+                            op, std::move(prefix), std::move(*part));
+                    }
+                }
+
+                auto const first = hpx::util::begin(shape);
+                std::size_t const size = hpx::util::size(shape);
+
+                run_per_thread([&](std::size_t thread_index,
+                                   std::size_t num_threads) {
+                    std::size_t const part_begin =
+                        get_part_begin(thread_index, num_threads, size);
+                    std::size_t const part_end =
+                        get_part_begin(thread_index + 1, num_threads, size);
+
+                    auto it = first;
+                    std::advance(it, part_begin);
+
+                    T& acc = *partials[thread_index].data_;
+                    for (std::size_t i = part_begin; i != part_end; ++i, ++it)
+                    {
+                        hpx::util::invoke(g, *it, acc);
+                    }
+                });
+
+                return prefix;
+            }
         };
 
     private:
@@ -482,18 +886,82 @@ namespace hpx { namespace execution { namespace experimental {
 
     public:
         template <typename F, typename S, typename... Ts>
-        void bulk_sync_execute(F&& f, S const& shape, Ts&&... ts)
+        decltype(auto) bulk_sync_execute(F&& f, S const& shape, Ts&&... ts)
         {
-            shared_data_->bulk_sync_execute(
-                std::forward<F>(f), shape, std::forward<Ts>(ts)...);
+            using result_type = typename hpx::parallel::execution::detail::
+                bulk_function_result<F, S, Ts...>::type;
+
+            return shared_data_->bulk_sync_execute(
+                std::is_void<result_type>{}, std::forward<F>(f), shape,
+                std::forward<Ts>(ts)...);
         }
 
         template <typename F, typename S, typename... Ts>
         decltype(auto) bulk_async_execute(F&& f, S const& shape, Ts&&... ts)
         {
+            using result_type = typename hpx::parallel::execution::detail::
+                bulk_function_result<F, S, Ts...>::type;
+
             return shared_data_->bulk_async_execute(
-                std::forward<F>(f), shape, std::forward<Ts>(ts)...);
+                std::is_void<result_type>{}, std::forward<F>(f), shape,
+                std::forward<Ts>(ts)...);
         }
+        /// \endcond
+
+        /// \brief Reduce the results of invoking a function for all elements
+        ///        of the shape.
+        ///
+        /// Each worker thread reduces the results for a contiguous part of
+        /// the shape, the cache-line padded partial results are then
+        /// combined in a tree without creating any futures. The partitions
+        /// are assigned statically regardless of the loop schedule.
+        ///
+        /// \param f     The function invoked for each element of the shape,
+        ///              its result is convertible to T.
+        /// \param shape The shape of the loop.
+        /// \param init  The initial value of the reduction.
+        /// \param r     The associative binary reduction operation.
+        ///
+        /// \returns The reduction of init and all results of f.
+        template <typename F, typename S, typename T, typename Reduce>
+        T bulk_sync_reduce(F&& f, S const& shape, T init, Reduce&& r)
+        {
+            return shared_data_->bulk_sync_reduce(std::forward<F>(f), shape,
+                std::move(init), std::forward<Reduce>(r));
+        }
+
+        /// \brief Perform a scan over the results of invoking a function for
+        ///        all elements of the shape.
+        ///
+        /// The scan is performed in two parallel regions: the first one
+        /// reduces the results of f for the partition of each worker thread,
+        /// the second one invokes g(element, acc) for all elements of a
+        /// partition in order. On entry acc holds the reduction of init and
+        /// the results of f for all preceding elements, g is responsible for
+        /// combining the result for the current element into acc (e.g. after
+        /// storing acc for an exclusive scan, or before for an inclusive
+        /// scan).
+        ///
+        /// \param f     The function invoked for each element of the shape
+        ///              during the first phase, its result is convertible to
+        ///              T.
+        /// \param g     The function invoked for each element of the shape
+        ///              during the second phase.
+        /// \param shape The shape of the loop.
+        /// \param init  The initial value of the scan.
+        /// \param op    The associative binary operation used by the scan.
+        ///
+        /// \returns The reduction of init and all results of f.
+        template <typename F, typename G, typename S, typename T,
+            typename Op>
+        T bulk_sync_scan(F&& f, G&& g, S const& shape, T init, Op&& op)
+        {
+            return shared_data_->bulk_sync_scan(std::forward<F>(f),
+                std::forward<G>(g), shape, std::move(init),
+                std::forward<Op>(op));
+        }
+
+        /// \cond NOINTERNAL
 
         bool operator==(fork_join_executor const& rhs) const noexcept
         {
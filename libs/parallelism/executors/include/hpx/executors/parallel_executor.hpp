@@ -9,7 +9,7 @@
 #pragma once
 
 #include <hpx/config.hpp>
-#include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/execution/algorithms/detail/predicates.hpp>
@@ -183,6 +183,23 @@ namespace hpx { namespace execution {
             return exec.schedulehint_;
         }
 
+        friend parallel_policy_executor tag_invoke(
+            hpx::execution::experimental::make_with_stacksize_t,
+            parallel_policy_executor const& exec,
+            hpx::threads::thread_stacksize stacksize)
+        {
+            auto exec_with_stacksize = exec;
+            exec_with_stacksize.stacksize_ = stacksize;
+            return exec_with_stacksize;
+        }
+
+        friend hpx::threads::thread_stacksize tag_invoke(
+            hpx::execution::experimental::get_stacksize_t,
+            parallel_policy_executor const& exec)
+        {
+            return exec.stacksize_;
+        }
+
         /// \cond NOINTERNAL
         bool operator==(parallel_policy_executor const& rhs) const noexcept
         {
@@ -243,7 +260,7 @@ namespace hpx { namespace execution {
 
             typename hpx::traits::detail::shared_state_ptr<result_type>::type
                 p = lcos::detail::make_continuation_alloc_nounwrap<result_type>(
-                    hpx::util::internal_allocator<>{},
+                    hpx::util::thread_local_caching_allocator<>{},
                     std::forward<Future>(predecessor), policy_,
                     std::move(func));
 
@@ -0,0 +1,141 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/execution/detail/post_policy_dispatch.hpp>
+#include <hpx/execution_base/receiver.hpp>
+#include <hpx/execution_base/sender.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/thread_helpers.hpp>
+#include <hpx/threading_base/thread_pool_base.hpp>
+
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace execution { namespace experimental {
+    namespace detail {
+        struct thread_pool_scheduler_sender;
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A scheduler creating senders which complete on a new HPX thread run on
+    /// the given thread pool. The operation state returned from connecting
+    /// such a sender embeds the receiver, the only allocation needed when
+    /// starting it is the one for the HPX thread itself.
+    struct thread_pool_scheduler
+    {
+        constexpr thread_pool_scheduler() = default;
+
+        explicit thread_pool_scheduler(threads::thread_pool_base* pool,
+            threads::thread_priority priority =
+                threads::thread_priority::default_,
+            threads::thread_stacksize stacksize =
+                threads::thread_stacksize::default_,
+            threads::thread_schedule_hint schedulehint = {})
+          : pool_(pool)
+          , priority_(priority)
+          , stacksize_(stacksize)
+          , schedulehint_(schedulehint)
+        {
+        }
+
+        /// \cond NOINTERNAL
+        bool operator==(thread_pool_scheduler const& rhs) const noexcept
+        {
+            return pool_ == rhs.pool_ && priority_ == rhs.priority_ &&
+                stacksize_ == rhs.stacksize_ &&
+                schedulehint_ == rhs.schedulehint_;
+        }
+
+        bool operator!=(thread_pool_scheduler const& rhs) const noexcept
+        {
+            return !(*this == rhs);
+        }
+
+        threads::thread_pool_base* get_thread_pool() const
+        {
+            return pool_ ? pool_ : threads::detail::get_self_or_default_pool();
+        }
+
+        template <typename F>
+        void execute(F&& f) const
+        {
+            hpx::util::thread_description desc("thread_pool_scheduler");
+
+            parallel::execution::detail::post_policy_dispatch<
+                hpx::launch::async_policy>::call(hpx::launch::async, desc,
+                get_thread_pool(), priority_, stacksize_, schedulehint_,
+                std::forward<F>(f));
+        }
+
+        detail::thread_pool_scheduler_sender schedule() const;
+        /// \endcond
+
+    private:
+        threads::thread_pool_base* pool_ = nullptr;
+        threads::thread_priority priority_ = threads::thread_priority::default_;
+        threads::thread_stacksize stacksize_ =
+            threads::thread_stacksize::default_;
+        threads::thread_schedule_hint schedulehint_ = {};
+    };
+
+    namespace detail {
+        template <typename Receiver>
+        struct thread_pool_scheduler_operation_state
+        {
+            thread_pool_scheduler scheduler_;
+            Receiver receiver_;
+
+            void start() noexcept
+            {
+                try
+                {
+                    scheduler_.execute([this]() {
+                        hpx::execution::experimental::set_value(
+                            std::move(receiver_));
+                    });
+                }
+                catch (...)
+                {
+                    hpx::execution::experimental::set_error(
+                        std::move(receiver_), std::current_exception());
+                }
+            }
+        };
+
+        struct thread_pool_scheduler_sender
+        {
+            thread_pool_scheduler scheduler_;
+
+            template <template <typename...> class Tuple,
+                template <typename...> class Variant>
+            using value_types = Variant<Tuple<>>;
+
+            template <template <typename...> class Variant>
+            using error_types = Variant<std::exception_ptr>;
+
+            static constexpr bool sends_done = false;
+
+            template <typename Receiver>
+            thread_pool_scheduler_operation_state<
+                typename std::decay<Receiver>::type>
+            connect(Receiver&& receiver) const
+            {
+                return {scheduler_, std::forward<Receiver>(receiver)};
+            }
+        };
+    }    // namespace detail
+
+    inline detail::thread_pool_scheduler_sender
+    thread_pool_scheduler::schedule() const
+    {
+        return {*this};
+    }
+}}}    // namespace hpx::execution::experimental
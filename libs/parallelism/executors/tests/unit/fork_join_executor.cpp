@@ -12,8 +12,11 @@
 #include <hpx/modules/timing.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <cstddef>
 #include <cstdlib>
 #include <iterator>
+#include <memory>
 #include <numeric>
 #include <string>
 #include <vector>
@@ -141,6 +144,204 @@ void test_bulk_async_exception()
     HPX_TEST(caught_exception);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+int bulk_test_result(int value, int passed_through)    //-V813
+{
+    HPX_TEST_EQ(passed_through, 42);
+    return value + passed_through;
+}
+
+void test_bulk_sync_result()
+{
+    using executor = hpx::execution::experimental::fork_join_executor;
+
+    std::size_t const n = 107;
+    std::vector<int> v(n);
+    std::iota(std::begin(v), std::end(v), 0);
+
+    executor exec;
+    std::vector<int> results = hpx::parallel::execution::bulk_sync_execute(
+        exec, &bulk_test_result, v, 42);
+
+    HPX_TEST_EQ(results.size(), n);
+    for (std::size_t i = 0; i != n; ++i)
+    {
+        HPX_TEST_EQ(results[i], int(i) + 42);
+    }
+
+    std::vector<hpx::future<int>> futures =
+        hpx::parallel::execution::bulk_async_execute(
+            exec, &bulk_test_result, v, 42);
+
+    HPX_TEST_EQ(futures.size(), n);
+    for (std::size_t i = 0; i != n; ++i)
+    {
+        HPX_TEST_EQ(futures[i].get(), int(i) + 42);
+    }
+
+    // the algorithms rely on the results of the bulk execution
+    auto policy = hpx::execution::par.on(exec);
+    HPX_TEST_EQ(hpx::reduce(policy, std::begin(v), std::end(v), 0),
+        std::accumulate(std::begin(v), std::end(v), 0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_bulk_sync_reduce()
+{
+    using executor = hpx::execution::experimental::fork_join_executor;
+
+    executor exec;
+    for (std::size_t n : {0, 1, 3, 107, 10007})
+    {
+        std::vector<int> v(n);
+        std::iota(std::begin(v), std::end(v), 1);
+
+        int sum = exec.bulk_sync_reduce([](int i) { return i; }, v, 42,
+            [](int lhs, int rhs) { return lhs + rhs; });
+        HPX_TEST_EQ(sum, std::accumulate(std::begin(v), std::end(v), 42));
+
+        // non-commutative reductions preserve the order of the elements
+        std::string str = exec.bulk_sync_reduce(
+            [](int i) { return std::to_string(i % 10); }, v, std::string(),
+            [](std::string const& lhs, std::string const& rhs) {
+                return lhs + rhs;
+            });
+
+        std::string expected;
+        for (int i : v)
+        {
+            expected += std::to_string(i % 10);
+        }
+        HPX_TEST_EQ(str, expected);
+    }
+}
+
+void test_bulk_sync_scan()
+{
+    using executor = hpx::execution::experimental::fork_join_executor;
+
+    executor exec;
+    for (std::size_t n : {0, 1, 3, 107, 10007})
+    {
+        std::vector<int> v(n);
+        std::iota(std::begin(v), std::end(v), 1);
+
+        std::vector<int> expected(n);
+        std::partial_sum(std::begin(v), std::end(v), std::begin(expected));
+
+        // inclusive scan
+        std::vector<int> inclusive(n);
+        int total = exec.bulk_sync_scan([&](std::size_t i) { return v[i]; },
+            [&](std::size_t i, int& acc) {
+                acc += v[i];
+                inclusive[i] = acc;
+            },
+            hpx::util::make_iterator_range(
+                hpx::util::make_counting_iterator(std::size_t(0)),
+                hpx::util::make_counting_iterator(n)),
+            0, [](int lhs, int rhs) { return lhs + rhs; });
+
+        HPX_TEST(inclusive == expected);
+        HPX_TEST_EQ(total, n == 0 ? 0 : expected.back());
+
+        // exclusive scan
+        std::vector<int> exclusive(n);
+        exec.bulk_sync_scan([&](std::size_t i) { return v[i]; },
+            [&](std::size_t i, int& acc) {
+                exclusive[i] = acc;
+                acc += v[i];
+            },
+            hpx::util::make_iterator_range(
+                hpx::util::make_counting_iterator(std::size_t(0)),
+                hpx::util::make_counting_iterator(n)),
+            0, [](int lhs, int rhs) { return lhs + rhs; });
+
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            HPX_TEST_EQ(exclusive[i], expected[i] - v[i]);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_nested()
+{
+    using executor = hpx::execution::experimental::fork_join_executor;
+
+    std::size_t const n = 17;
+    std::vector<int> v(n);
+    std::iota(std::begin(v), std::end(v), 0);
+
+    executor exec;
+    std::atomic<std::size_t> inner_count(0);
+    std::atomic<int> inner_sum(0);
+
+    hpx::parallel::execution::bulk_sync_execute(
+        exec,
+        [&](int) {
+            // nested regions on the same executor run inline
+            hpx::parallel::execution::bulk_sync_execute(
+                exec, [&](int) { ++inner_count; }, v);
+
+            inner_sum += exec.bulk_sync_reduce([](int i) { return i; }, v, 0,
+                [](int lhs, int rhs) { return lhs + rhs; });
+
+            // so do regions on executors created inside a region
+            executor inner_exec;
+            hpx::parallel::execution::bulk_sync_execute(
+                inner_exec, [&](int) { ++inner_count; }, v);
+        },
+        v);
+
+    HPX_TEST_EQ(inner_count.load(), 2 * n * n);
+    HPX_TEST_EQ(inner_sum.load(),
+        int(n) * std::accumulate(std::begin(v), std::end(v), 0));
+
+    // participants are recognized by their HPX thread, even after they
+    // were suspended (and possibly resumed on a different core)
+    executor other_exec;
+    inner_count = 0;
+    hpx::parallel::execution::bulk_sync_execute(
+        exec,
+        [&](int) {
+            hpx::threads::thread_id_type const id =
+                hpx::threads::get_self_id();
+            hpx::this_thread::yield();
+
+            hpx::parallel::execution::bulk_sync_execute(
+                other_exec,
+                [&](int) {
+                    HPX_TEST_EQ(hpx::threads::get_self_id(), id);
+                    ++inner_count;
+                },
+                v);
+        },
+        v);
+    HPX_TEST_EQ(inner_count.load(), n * n);
+
+    // an executor created inside a region starts its worker threads once it
+    // is used outside of the region
+    std::unique_ptr<executor> deferred_exec;
+    hpx::parallel::execution::bulk_sync_execute(
+        exec,
+        [&](int i) {
+            if (i == 0)
+            {
+                deferred_exec.reset(new executor());
+            }
+        },
+        v);
+
+    HPX_TEST(deferred_exec);
+    inner_count = 0;
+    hpx::parallel::execution::bulk_sync_execute(
+        *deferred_exec, [&](int) { ++inner_count; }, v);
+    HPX_TEST_EQ(inner_count.load(), n);
+    HPX_TEST_EQ(deferred_exec->bulk_sync_reduce([](int i) { return i; }, v,
+                    0, [](int lhs, int rhs) { return lhs + rhs; }),
+        std::accumulate(std::begin(v), std::end(v), 0));
+}
+
 void static_check_executor()
 {
     using namespace hpx::traits;
@@ -171,6 +372,10 @@ int hpx_main()
     test_bulk_async();
     test_bulk_sync_exception();
     test_bulk_async_exception();
+    test_bulk_sync_result();
+    test_bulk_sync_reduce();
+    test_bulk_sync_scan();
+    test_nested();
 
     return hpx::finalize();
 }
@@ -0,0 +1,86 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Tasks running without a stack of their own must not be suspended, verify
+// that attempting to do so is reported as an error.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos_local.hpp>
+#include <hpx/include/parallel_executors.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <chrono>
+
+int hpx_main()
+{
+    hpx::execution::parallel_executor exec;
+    HPX_TEST(hpx::execution::experimental::get_stacksize(exec) ==
+        hpx::threads::thread_stacksize::default_);
+
+    auto stackless_exec = hpx::execution::experimental::make_with_stacksize(
+        exec, hpx::threads::thread_stacksize::nostack);
+    HPX_TEST(hpx::execution::experimental::get_stacksize(stackless_exec) ==
+        hpx::threads::thread_stacksize::nostack);
+
+    // tasks which don't suspend run normally
+    {
+        hpx::future<int> f = hpx::async(stackless_exec, []() { return 42; });
+        HPX_TEST_EQ(f.get(), 42);
+    }
+
+    // suspending is reported as an error
+    {
+        hpx::future<void> f = hpx::async(stackless_exec, []() {
+            hpx::this_thread::suspend(std::chrono::milliseconds(1));
+        });
+
+        bool caught_exception = false;
+        try
+        {
+            f.get();
+        }
+        catch (hpx::exception const& e)
+        {
+            HPX_TEST_EQ(e.get_error(), hpx::invalid_status);
+            caught_exception = true;
+        }
+        HPX_TEST(caught_exception);
+    }
+
+    // blocking on a future which is not ready is reported as an error
+    {
+        hpx::lcos::local::promise<void> p;
+        hpx::shared_future<void> not_ready = p.get_future();
+
+        hpx::future<void> f =
+            hpx::async(stackless_exec, [not_ready]() { not_ready.get(); });
+
+        bool caught_exception = false;
+        try
+        {
+            f.get();
+        }
+        catch (hpx::exception const& e)
+        {
+            HPX_TEST_EQ(e.get_error(), hpx::invalid_status);
+            caught_exception = true;
+        }
+        HPX_TEST(caught_exception);
+
+        p.set_value();
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,155 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/execution/algorithms/bulk.hpp>
+#include <hpx/execution/algorithms/just.hpp>
+#include <hpx/execution/algorithms/let_value.hpp>
+#include <hpx/execution/algorithms/sync_wait.hpp>
+#include <hpx/execution/algorithms/then.hpp>
+#include <hpx/execution/algorithms/when_all.hpp>
+#include <hpx/executors/thread_pool_scheduler.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading.hpp>
+#include <hpx/threading_base/thread_helpers.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace ex = hpx::execution::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_schedule()
+{
+    ex::thread_pool_scheduler sched;
+    static_assert(ex::traits::is_scheduler_v<ex::thread_pool_scheduler>,
+        "thread_pool_scheduler should be a scheduler");
+    static_assert(ex::traits::is_sender_v<decltype(ex::schedule(sched))>,
+        "schedule should return a sender");
+
+    HPX_TEST(sched == ex::thread_pool_scheduler());
+    HPX_TEST(sched.get_thread_pool() != nullptr);
+
+    hpx::thread::id parent_id = hpx::this_thread::get_id();
+    hpx::thread::id id = ex::sync_wait(ex::then(ex::schedule(sched),
+        []() { return hpx::this_thread::get_id(); }));
+
+    HPX_TEST_NEQ(id, parent_id);
+    HPX_TEST_NEQ(id, hpx::thread::id());
+}
+
+void test_then_chain()
+{
+    ex::thread_pool_scheduler sched;
+
+    auto s = ex::then(
+        ex::then(
+            ex::then(ex::schedule(sched), []() { return 1; }),
+            [](int i) { return i + 1; }),
+        [](int i) { return std::to_string(i); });
+
+    HPX_TEST_EQ(ex::sync_wait(std::move(s)), std::string("2"));
+}
+
+void test_when_all()
+{
+    ex::thread_pool_scheduler sched;
+    std::atomic<std::size_t> count(0);
+
+    auto work = [&]() {
+        return ex::then(ex::schedule(sched), [&]() {
+            ++count;
+            return hpx::this_thread::get_id();
+        });
+    };
+
+    auto t = ex::sync_wait(ex::when_all(work(), work(), work(), work()));
+
+    HPX_TEST_EQ(count.load(), std::size_t(4));
+    HPX_TEST_NEQ(hpx::get<0>(t), hpx::thread::id());
+    HPX_TEST_NEQ(hpx::get<3>(t), hpx::thread::id());
+}
+
+void test_bulk()
+{
+    ex::thread_pool_scheduler sched;
+    std::atomic<std::size_t> sum(0);
+
+    ex::sync_wait(ex::bulk(ex::schedule(sched), std::size_t(100),
+        [&](std::size_t i) { sum += i; }));
+
+    HPX_TEST_EQ(sum.load(), std::size_t(4950));
+}
+
+void test_let_value()
+{
+    ex::thread_pool_scheduler sched;
+
+    auto s = ex::let_value(ex::then(ex::schedule(sched), []() { return 21; }),
+        [sched](int& i) {
+            return ex::then(ex::schedule(sched), [&i]() { return 2 * i; });
+        });
+
+    HPX_TEST_EQ(ex::sync_wait(std::move(s)), 42);
+}
+
+void test_pool()
+{
+    hpx::threads::thread_pool_base* pool = hpx::this_thread::get_pool();
+    ex::thread_pool_scheduler sched(pool,
+        hpx::threads::thread_priority::high,
+        hpx::threads::thread_stacksize::small_);
+
+    HPX_TEST_EQ(sched.get_thread_pool(), pool);
+    HPX_TEST(sched != ex::thread_pool_scheduler());
+
+    bool const on_pool = ex::sync_wait(ex::then(ex::schedule(sched),
+        [pool]() { return hpx::this_thread::get_pool() == pool; }));
+    HPX_TEST(on_pool);
+}
+
+void test_errors()
+{
+    ex::thread_pool_scheduler sched;
+
+    bool caught = false;
+    try
+    {
+        ex::sync_wait(ex::then(ex::schedule(sched),
+            []() { throw std::runtime_error("error"); }));
+    }
+    catch (std::runtime_error const&)
+    {
+        caught = true;
+    }
+    HPX_TEST(caught);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_schedule();
+    test_then_chain();
+    test_when_all();
+    test_bulk();
+    test_let_value();
+    test_pool();
+    test_errors();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
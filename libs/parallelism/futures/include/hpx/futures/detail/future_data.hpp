@@ -22,6 +22,7 @@
 #include <hpx/thread_support/atomic_count.hpp>
 #include <hpx/threading_base/annotated_function.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/type_support/unused.hpp>
 
 #include <boost/container/small_vector.hpp>
@@ -29,6 +30,7 @@
 #include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <memory>
 #include <mutex>
@@ -198,12 +200,18 @@ namespace hpx { namespace lcos { namespace detail {
     {
         future_data_base()
           : state_(empty)
+          , on_completed_(nullptr)
+          , first_callback_used_(false)
+          , waiters_(nullptr)
         {
         }
 
         future_data_base(init_no_addref no_addref)
           : future_data_refcnt_base(no_addref)
           , state_(empty)
+          , on_completed_(nullptr)
+          , first_callback_used_(false)
+          , waiters_(nullptr)
         {
         }
 
@@ -301,10 +309,55 @@ namespace hpx { namespace lcos { namespace detail {
         }
 
     protected:
+        // Atomically change the state from 'empty' to the given (ready)
+        // state, wake up all waiting threads, and invoke all registered
+        // continuations. Returns false if the state was not 'empty'.
+        bool set_ready(state s);
+
+        // Release all registered (but not yet invoked) continuations.
+        void reset_on_completed() noexcept;
+
+    private:
+        // Continuations are kept in an intrusive lock-free list (pushed in
+        // reverse order of registration). The first continuation is stored
+        // inline as most futures have at most one.
+        struct completed_callback_node
+        {
+            completed_callback_type callback_;
+            completed_callback_node* next_ = nullptr;
+        };
+
+        // Marks the list of continuations as closed, set once the shared
+        // state has become ready.
+        static completed_callback_node* closed_list() noexcept
+        {
+            return reinterpret_cast<completed_callback_node*>(
+                std::uintptr_t(1));
+        }
+
+        void release_node(completed_callback_node* node) noexcept;
+
+        // The mutex and condition variable used for blocking in wait() are
+        // created only once a thread actually has to block.
+        struct waiters_data
+        {
+            mutex_type mtx_;
+            local::detail::condition_variable cond_;
+        };
+
+        waiters_data* get_waiters();
+
+    protected:
+        // protects data members of derived shared states, not used for
+        // managing the state itself
         mutable mutex_type mtx_;
         std::atomic<state> state_;    // current state
-        completed_callback_vector_type on_completed_;
-        local::detail::condition_variable cond_;    // threads waiting in read
+
+    private:
+        std::atomic<completed_callback_node*> on_completed_;
+        std::atomic<bool> first_callback_used_;
+        completed_callback_node first_callback_;
+        std::atomic<waiters_data*> waiters_;    // threads waiting in read
     };
 
     struct in_place
@@ -420,48 +473,18 @@ namespace hpx { namespace lcos { namespace detail {
             result_type* value_ptr = reinterpret_cast<result_type*>(&storage_);
             construct(value_ptr, std::forward<Ts>(ts)...);
 
-            // At this point the lock needs to be acquired to safely access the
-            // registered continuations
-            std::unique_lock<mutex_type> l(mtx_);
-
-            // handle all threads waiting for the future to become ready
-            auto on_completed = std::move(on_completed_);
-            on_completed_.clear();
-
             // The value has been set, changing the state to 'value' at this
             // point signals to all other threads that this future is ready.
-            state expected = empty;
-            if (!state_.compare_exchange_strong(
-                    expected, value, std::memory_order_release))
+            // This also wakes up all waiting threads and invokes the
+            // registered continuations.
+            if (!this->set_ready(value))
             {
                 // this future should be 'empty' still (it can't be made ready
                 // more than once).
-                l.unlock();
                 HPX_THROW_EXCEPTION(promise_already_satisfied,
                     "future_data_base::set_value",
                     "data has already been set for this future");
-                return;
             }
-
-            // Note: we use notify_one repeatedly instead of notify_all as we
-            //       know: a) that most of the time we have at most one thread
-            //       waiting on the future (most futures are not shared), and
-            //       b) our implementation of condition_variable::notify_one
-            //       relinquishes the lock before resuming the waiting thread
-            //       which avoids suspension of this thread when it tries to
-            //       re-lock the mutex while exiting from condition_variable::wait
-            while (
-                cond_.notify_one(std::move(l), threads::thread_priority::boost))
-            {
-                l = std::unique_lock<mutex_type>(mtx_);
-            }
-
-            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
-            //       it unlocked when returning.
-
-            // invoke the callback (continuation) function
-            if (!on_completed.empty())
-                handle_on_completed(std::move(on_completed));
         }
 
         void set_exception(std::exception_ptr data) override
@@ -477,48 +500,18 @@ namespace hpx { namespace lcos { namespace detail {
                 reinterpret_cast<std::exception_ptr*>(&storage_);
             ::new ((void*) exception_ptr) std::exception_ptr(std::move(data));
 
-            // At this point the lock needs to be acquired to safely access the
-            // registered continuations
-            std::unique_lock<mutex_type> l(mtx_);
-
-            // handle all threads waiting for the future to become ready
-            auto on_completed = std::move(on_completed_);
-            on_completed_.clear();
-
             // The value has been set, changing the state to 'exception' at this
             // point signals to all other threads that this future is ready.
-            state expected = empty;
-            if (!state_.compare_exchange_strong(
-                    expected, exception, std::memory_order_release))
+            // This also wakes up all waiting threads and invokes the
+            // registered continuations.
+            if (!this->set_ready(exception))
             {
                 // this future should be 'empty' still (it can't be made ready
                 // more than once).
-                l.unlock();
                 HPX_THROW_EXCEPTION(promise_already_satisfied,
                     "future_data_base::set_exception",
                     "data has already been set for this future");
-                return;
             }
-
-            // Note: we use notify_one repeatedly instead of notify_all as we
-            //       know: a) that most of the time we have at most one thread
-            //       waiting on the future (most futures are not shared), and
-            //       b) our implementation of condition_variable::notify_one
-            //       relinquishes the lock before resuming the waiting thread
-            //       which avoids suspension of this thread when it tries to
-            //       re-lock the mutex while exiting from condition_variable::wait
-            while (
-                cond_.notify_one(std::move(l), threads::thread_priority::boost))
-            {
-                l = std::unique_lock<mutex_type>(mtx_);
-            }
-
-            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
-            //       it unlocked when returning.
-
-            // invoke the callback (continuation) function
-            if (!on_completed.empty())
-                handle_on_completed(std::move(on_completed));
         }
 
         // helper functions for setting data (if successful) or the error (if
@@ -631,7 +624,7 @@ namespace hpx { namespace lcos { namespace detail {
                 break;
             }
 
-            on_completed_.clear();
+            this->reset_on_completed();
         }
 
         std::exception_ptr get_exception_ptr() const override
@@ -642,11 +635,9 @@ namespace hpx { namespace lcos { namespace detail {
 
     protected:
         using base_type::mtx_;
-        using base_type::on_completed_;
         using base_type::state_;
 
     private:
-        using base_type::cond_;
         typename future_data_storage<Result>::type storage_;
     };
 
@@ -913,6 +904,17 @@ namespace hpx { namespace lcos { namespace detail {
             return threads::invalid_thread_id;
         }
 
+        // prepare running in a separate thread, the thread is created by the
+        // caller
+        virtual threads::thread_init_data get_thread_init_data(
+            const char* /*annotation*/, threads::thread_priority /*priority*/,
+            threads::thread_stacksize /*stacksize*/,
+            threads::thread_schedule_hint /*schedulehint*/)
+        {
+            HPX_ASSERT(false);    // shouldn't ever be called
+            return threads::thread_init_data();
+        }
+
     protected:
         static void run_impl(future_base_type this_)
         {
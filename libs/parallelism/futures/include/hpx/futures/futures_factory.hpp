@@ -8,7 +8,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/allocator_support/allocator_deleter.hpp>
-#include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/execution_base/execution.hpp>
@@ -20,6 +20,7 @@
 #include <hpx/modules/memory.hpp>
 #include <hpx/threading_base/thread_description.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/threading_base/thread_num_tss.hpp>
 
 #include <cstddef>
@@ -157,6 +158,24 @@ namespace hpx { namespace lcos { namespace local {
                 threads::register_work(data, pool, ec);
                 return threads::invalid_thread_id;
             }
+
+            threads::thread_init_data get_thread_init_data(
+                const char* annotation, threads::thread_priority priority,
+                threads::thread_stacksize stacksize,
+                threads::thread_schedule_hint schedulehint) override
+            {
+                this->check_started();
+
+                typedef typename Base::future_base_type future_base_type;
+                future_base_type this_(this);
+
+                return threads::thread_init_data(
+                    threads::make_thread_function_nullary(util::deferred_call(
+                        &base_type::run_impl, std::move(this_))),
+                    util::thread_description(f_, annotation), priority,
+                    schedulehint, stacksize,
+                    threads::thread_schedule_state::pending);
+            }
         };
 
         template <typename Allocator, typename Result, typename F,
@@ -727,14 +746,24 @@ namespace hpx { namespace lcos { namespace local {
                 typename std::decay<F>::type, futures_factory>::value>::type>
         explicit futures_factory(F&& f)
           : task_(detail::create_task_object<Result, Cancelable>::call(
-                hpx::util::internal_allocator<>{}, std::forward<F>(f)))
+                hpx::util::thread_local_caching_allocator<>{},
+                std::forward<F>(f)))
           , future_obtained_(false)
         {
         }
 
         explicit futures_factory(Result (*f)())
           : task_(detail::create_task_object<Result, Cancelable>::call(
-                hpx::util::internal_allocator<>{}, f))
+                hpx::util::thread_local_caching_allocator<>{}, f))
+          , future_obtained_(false)
+        {
+        }
+
+        // the shared state is allocated using the given allocator
+        template <typename Allocator, typename F>
+        futures_factory(std::allocator_arg_t, Allocator const& a, F&& f)
+          : task_(detail::create_task_object<Result, Cancelable>::call(
+                a, std::forward<F>(f)))
           , future_obtained_(false)
         {
         }
@@ -816,6 +845,29 @@ namespace hpx { namespace lcos { namespace local {
                 schedulehint, ec);
         }
 
+        // Return the data needed to run the task on a new thread without
+        // creating that thread. This allows for creating the threads for
+        // many tasks at once (see threads::register_work_bulk).
+        threads::thread_init_data get_thread_init_data(
+            const char* annotation = "futures_factory::apply",
+            threads::thread_priority priority =
+                threads::thread_priority::default_,
+            threads::thread_stacksize stacksize =
+                threads::thread_stacksize::default_,
+            threads::thread_schedule_hint schedulehint =
+                threads::thread_schedule_hint()) const
+        {
+            if (!task_)
+            {
+                HPX_THROW_EXCEPTION(task_moved,
+                    "futures_factory<Result()>::get_thread_init_data()",
+                    "futures_factory invalid (has it been moved?)");
+                return threads::thread_init_data();
+            }
+            return task_->get_thread_init_data(
+                annotation, priority, stacksize, schedulehint);
+        }
+
         // This is the same as get_future, except that it moves the
         // shared state into the returned future.
         lcos::future<Result> get_future(error_code& ec = throws)
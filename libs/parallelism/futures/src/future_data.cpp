@@ -21,6 +21,7 @@
 #include <cstddef>
 #include <exception>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <utility>
 
@@ -81,7 +82,11 @@ namespace hpx { namespace lcos { namespace detail {
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    future_data_base<traits::detail::future_data_void>::~future_data_base() {}
+    future_data_base<traits::detail::future_data_void>::~future_data_base()
+    {
+        reset_on_completed();
+        delete waiters_.load(std::memory_order_relaxed);
+    }
 
     static util::unused_type unused_;
 
@@ -236,6 +241,127 @@ namespace hpx { namespace lcos { namespace detail {
     future_data_base<traits::detail::future_data_void>::handle_on_completed<
         completed_callback_vector_type>(completed_callback_vector_type&&);
 
+    ///////////////////////////////////////////////////////////////////////////
+    void future_data_base<traits::detail::future_data_void>::release_node(
+        completed_callback_node* node) noexcept
+    {
+        if (node == &first_callback_)
+        {
+            node->callback_.reset();
+            node->next_ = nullptr;
+        }
+        else
+        {
+            delete node;
+        }
+    }
+
+    void future_data_base<
+        traits::detail::future_data_void>::reset_on_completed() noexcept
+    {
+        // no synchronization is required as semantics guarantee a single
+        // writer and no reader
+        completed_callback_node* head =
+            on_completed_.exchange(nullptr, std::memory_order_acquire);
+        if (head != closed_list())
+        {
+            while (head != nullptr)
+            {
+                completed_callback_node* next = head->next_;
+                release_node(head);
+                head = next;
+            }
+        }
+        first_callback_used_.store(false, std::memory_order_relaxed);
+    }
+
+    future_data_base<traits::detail::future_data_void>::waiters_data*
+    future_data_base<traits::detail::future_data_void>::get_waiters()
+    {
+        waiters_data* waiters = waiters_.load(std::memory_order_acquire);
+        if (waiters == nullptr)
+        {
+            std::unique_ptr<waiters_data> new_waiters(new waiters_data);
+
+            // Note: this has to be sequentially consistent with the state
+            //       change in set_ready as the state is re-checked after
+            //       installing the data.
+            if (waiters_.compare_exchange_strong(waiters, new_waiters.get(),
+                    std::memory_order_seq_cst))
+            {
+                waiters = new_waiters.release();
+            }
+        }
+        return waiters;
+    }
+
+    bool future_data_base<traits::detail::future_data_void>::set_ready(
+        state s)
+    {
+        state expected = empty;
+        if (!state_.compare_exchange_strong(
+                expected, s, std::memory_order_seq_cst))
+        {
+            return false;
+        }
+
+        // Close the list of continuations, any continuation registered from
+        // now on will be invoked directly. The list is stored in reverse
+        // order of registration.
+        completed_callback_node* head =
+            on_completed_.exchange(closed_list(), std::memory_order_acq_rel);
+
+        completed_callback_vector_type on_completed;
+        if (head != nullptr)
+        {
+            completed_callback_node* prev = nullptr;
+            while (head != nullptr)
+            {
+                completed_callback_node* next = head->next_;
+                head->next_ = prev;
+                prev = head;
+                head = next;
+            }
+
+            while (prev != nullptr)
+            {
+                completed_callback_node* next = prev->next_;
+                on_completed.push_back(std::move(prev->callback_));
+                release_node(prev);
+                prev = next;
+            }
+        }
+
+        // handle all threads waiting for the future to become ready, if no
+        // thread has ever blocked there is nothing to do
+        waiters_data* waiters = waiters_.load(std::memory_order_seq_cst);
+        if (waiters != nullptr)
+        {
+            // Note: we use notify_one repeatedly instead of notify_all as we
+            //       know: a) that most of the time we have at most one thread
+            //       waiting on the future (most futures are not shared), and
+            //       b) our implementation of condition_variable::notify_one
+            //       relinquishes the lock before resuming the waiting thread
+            //       which avoids suspension of this thread when it tries to
+            //       re-lock the mutex while exiting from condition_variable::wait
+            std::unique_lock<mutex_type> l(waiters->mtx_);
+            while (waiters->cond_.notify_one(
+                std::move(l), threads::thread_priority::boost))
+            {
+                l = std::unique_lock<mutex_type>(waiters->mtx_);
+            }
+
+            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
+            //       it unlocked when returning.
+        }
+
+        // invoke the callback (continuation) functions
+        if (!on_completed.empty())
+            handle_on_completed(std::move(on_completed));
+
+        return true;
+    }
+
     /// Set the callback which needs to be invoked when the future becomes
     /// ready. If the future is ready the function will be invoked
     /// immediately.
@@ -249,22 +375,36 @@ namespace hpx { namespace lcos { namespace detail {
         {
             // invoke the callback (continuation) function right away
             handle_on_completed(std::move(data_sink));
+            return;
+        }
+
+        completed_callback_node* node = nullptr;
+        if (!first_callback_used_.exchange(true, std::memory_order_relaxed))
+        {
+            node = &first_callback_;
         }
         else
         {
-            std::unique_lock<mutex_type> l(mtx_);
-            if (is_ready())
-            {
-                l.unlock();
+            node = new completed_callback_node;
+        }
+        node->callback_ = std::move(data_sink);
 
-                // invoke the callback (continuation) function
-                handle_on_completed(std::move(data_sink));
-            }
-            else
+        completed_callback_node* head =
+            on_completed_.load(std::memory_order_acquire);
+        do
+        {
+            if (head == closed_list())
             {
-                on_completed_.push_back(std::move(data_sink));
+                // the future has become ready in the meantime, invoke the
+                // callback (continuation) function directly
+                completed_callback_type f = std::move(node->callback_);
+                release_node(node);
+                handle_on_completed(std::move(f));
+                return;
             }
-        }
+            node->next_ = head;
+        } while (!on_completed_.compare_exchange_weak(head, node,
+            std::memory_order_release, std::memory_order_acquire));
     }
 
     future_data_base<traits::detail::future_data_void>::state
@@ -274,11 +414,13 @@ namespace hpx { namespace lcos { namespace detail {
         state s = state_.load(std::memory_order_acquire);
         if (s == empty)
         {
-            std::unique_lock<mutex_type> l(mtx_);
-            s = state_.load(std::memory_order_relaxed);
+            waiters_data* waiters = get_waiters();
+
+            std::unique_lock<mutex_type> l(waiters->mtx_);
+            s = state_.load(std::memory_order_seq_cst);
             if (s == empty)
             {
-                cond_.wait(l, "future_data_base::wait", ec);
+                waiters->cond_.wait(l, "future_data_base::wait", ec);
                 if (ec)
                     return s;
             }
@@ -296,11 +438,14 @@ namespace hpx { namespace lcos { namespace detail {
         // block if this entry is empty
         if (state_.load(std::memory_order_acquire) == empty)
         {
-            std::unique_lock<mutex_type> l(mtx_);
-            if (state_.load(std::memory_order_relaxed) == empty)
+            waiters_data* waiters = get_waiters();
+
+            std::unique_lock<mutex_type> l(waiters->mtx_);
+            if (state_.load(std::memory_order_seq_cst) == empty)
             {
-                threads::thread_restart_state const reason = cond_.wait_until(
-                    l, abs_time, "future_data_base::wait_until", ec);
+                threads::thread_restart_state const reason =
+                    waiters->cond_.wait_until(
+                        l, abs_time, "future_data_base::wait_until", ec);
                 if (ec)
                     return future_status::uninitialized;
 
@@ -0,0 +1,155 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that continuations registered with and threads blocking
+// on a shared state are reliably handled while the shared state concurrently
+// becomes ready.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr std::size_t num_iterations = 1000;
+constexpr std::size_t num_continuations = 8;
+
+void test_continuations_race()
+{
+    for (std::size_t i = 0; i != num_iterations; ++i)
+    {
+        hpx::lcos::local::promise<int> p;
+        hpx::shared_future<int> f = p.get_future();
+
+        std::atomic<std::size_t> count(0);
+        std::vector<hpx::future<void>> registrations;
+        registrations.reserve(num_continuations);
+
+        for (std::size_t j = 0; j != num_continuations; ++j)
+        {
+            registrations.push_back(hpx::async([f, &count]() {
+                f.then(hpx::launch::sync,
+                    [&count](hpx::shared_future<int>&& result) {
+                        HPX_TEST_EQ(result.get(), 42);
+                        ++count;
+                    });
+            }));
+        }
+
+        p.set_value(42);
+        hpx::wait_all(registrations);
+
+        HPX_TEST_EQ(count.load(), num_continuations);
+    }
+}
+
+void test_continuations_order()
+{
+    hpx::lcos::local::promise<void> p;
+    hpx::shared_future<void> f = p.get_future();
+
+    // continuations registered from the same thread run in order of
+    // registration
+    std::vector<std::size_t> order;
+    for (std::size_t j = 0; j != num_continuations; ++j)
+    {
+        f.then(hpx::launch::sync,
+            [&order, j](hpx::shared_future<void>&&) { order.push_back(j); });
+    }
+
+    p.set_value();
+
+    HPX_TEST_EQ(order.size(), num_continuations);
+    for (std::size_t j = 0; j != order.size(); ++j)
+    {
+        HPX_TEST_EQ(order[j], j);
+    }
+}
+
+void test_waiters_race()
+{
+    for (std::size_t i = 0; i != num_iterations; ++i)
+    {
+        hpx::lcos::local::promise<int> p;
+        hpx::shared_future<int> f = p.get_future();
+
+        std::vector<hpx::future<int>> waiters;
+        waiters.reserve(num_continuations);
+
+        for (std::size_t j = 0; j != num_continuations; ++j)
+        {
+            waiters.push_back(hpx::async([f]() { return f.get(); }));
+        }
+
+        hpx::async([&p]() { p.set_value(42); }).get();
+
+        for (auto&& w : waiters)
+        {
+            HPX_TEST_EQ(w.get(), 42);
+        }
+    }
+}
+
+void test_exception()
+{
+    hpx::lcos::local::promise<int> p;
+    hpx::shared_future<int> f = p.get_future();
+
+    hpx::future<bool> waiter = hpx::async([f]() {
+        try
+        {
+            f.get();
+        }
+        catch (std::runtime_error const&)
+        {
+            return true;
+        }
+        return false;
+    });
+
+    p.set_exception(std::make_exception_ptr(std::runtime_error("error")));
+
+    HPX_TEST(waiter.get());
+    HPX_TEST(f.has_exception());
+
+    // the shared state can't become ready twice
+    bool caught = false;
+    try
+    {
+        p.set_value(42);
+    }
+    catch (hpx::exception const& e)
+    {
+        caught = true;
+        HPX_TEST_EQ(e.get_error(), hpx::promise_already_satisfied);
+    }
+    HPX_TEST(caught);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_continuations_race();
+    test_continuations_order();
+    test_waiters_race();
+    test_exception();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,344 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/futures.hpp>
+#include <hpx/synchronization/no_mutex.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace lcos { namespace local {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Describes how a \a ring_receive_buffer handles generations (steps)
+    /// which are not yet covered by its window.
+    enum class out_of_window_policy
+    {
+        /// Throw an exception (error code \a hpx::out_of_range).
+        throw_exception,
+
+        /// Yield until the slot for the generation has been recycled, i.e.
+        /// until the generation which currently occupies the slot has been
+        /// both stored and received (and all futures referring to it were
+        /// released).
+        wait
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A receive buffer with the same interface as \a receive_buffer which
+    /// keeps the values for a sliding window of \a capacity consecutive
+    /// generations (steps) in a fixed-size ring. The slot for a generation is
+    /// selected by the generation modulo the capacity. Each slot is a shared
+    /// state which is reused for all generations mapped to it, storing and
+    /// receiving a value is lock-free and does not allocate.
+    ///
+    /// A slot is recycled for the generation \a capacity steps ahead once its
+    /// current generation has been both stored and received and the future
+    /// returned from \a receive (and all of its copies) has been released.
+    /// Every generation must be stored and received exactly once. Attempts to
+    /// access a generation which has already been recycled always throw,
+    /// accesses to generations ahead of the window are handled as specified
+    /// by the \a out_of_window_policy.
+    template <typename T>
+    struct ring_receive_buffer
+    {
+        static_assert(!std::is_void<T>::value,
+            "ring_receive_buffer does not support void values");
+
+    protected:
+        enum slot_flags : std::uint32_t
+        {
+            writer = 0x01,       // the value is being stored
+            value_set = 0x02,    // the value has been stored
+            receiver = 0x04,     // the future has been retrieved
+            released = 0x08      // all futures have been released
+        };
+
+        // A slot keeps a permanent reference to itself, it is never deleted
+        // through the futures referring to it. Instead, the slot is recycled
+        // for the next generation mapped to it once the last of those
+        // futures is released and the value has been stored.
+        struct slot : lcos::detail::future_data<T>
+        {
+            using base_type = lcos::detail::future_data<T>;
+            using init_no_addref = typename base_type::init_no_addref;
+
+            slot()
+              : base_type(init_no_addref{})
+              , generation_(0)
+              , flags_(0)
+              , capacity_(0)
+            {
+            }
+
+            bool requires_delete() override
+            {
+                // the only remaining reference is the one held by the buffer
+                if (1 == --this->count_ &&
+                    (flags_.load(std::memory_order_acquire) & receiver))
+                {
+                    std::uint32_t const old =
+                        flags_.fetch_or(released, std::memory_order_acq_rel);
+                    if (!(old & released) && (old & value_set))
+                    {
+                        recycle();
+                    }
+                }
+                return false;
+            }
+
+            void destroy() override
+            {
+                HPX_ASSERT(false);
+            }
+
+            void recycle()
+            {
+                this->reset();
+                flags_.store(0, std::memory_order_relaxed);
+
+                // publish the slot for the next generation
+                generation_.store(
+                    generation_.load(std::memory_order_relaxed) + capacity_,
+                    std::memory_order_release);
+            }
+
+            std::atomic<std::size_t> generation_;
+            std::atomic<std::uint32_t> flags_;
+            std::size_t capacity_;
+        };
+
+    public:
+        /// Construct a receive buffer for a window of (at least) \a capacity
+        /// consecutive generations, starting at generation zero.
+        explicit ring_receive_buffer(std::size_t capacity,
+            out_of_window_policy policy = out_of_window_policy::throw_exception)
+          : capacity_(round_up_to_power_of_two(capacity))
+          , slots_(new slot[capacity_])
+          , policy_(policy)
+        {
+            for (std::size_t i = 0; i != capacity_; ++i)
+            {
+                slots_[i].generation_.store(i, std::memory_order_relaxed);
+                slots_[i].capacity_ = capacity_;
+            }
+        }
+
+        ring_receive_buffer(ring_receive_buffer&& other) noexcept
+          : capacity_(other.capacity_)
+          , slots_(std::move(other.slots_))
+          , policy_(other.policy_)
+        {
+            other.capacity_ = 0;
+        }
+
+        ~ring_receive_buffer()
+        {
+            HPX_ASSERT(empty());
+        }
+
+        ring_receive_buffer& operator=(ring_receive_buffer&& other) noexcept
+        {
+            if (this != &other)
+            {
+                capacity_ = other.capacity_;
+                slots_ = std::move(other.slots_);
+                policy_ = other.policy_;
+                other.capacity_ = 0;
+            }
+            return *this;
+        }
+
+        std::size_t capacity() const noexcept
+        {
+            return capacity_;
+        }
+
+        hpx::future<T> receive(std::size_t step)
+        {
+            slot& s = get_slot(step, "ring_receive_buffer::receive");
+
+            // only the receiver which marks the slot creates a future, a
+            // duplicate receive must not touch the reference count of the
+            // slot as the future of the first receiver still refers to it
+            std::uint32_t const old =
+                s.flags_.fetch_or(receiver, std::memory_order_acq_rel);
+            if (old & receiver)
+            {
+                HPX_THROW_EXCEPTION(invalid_status,
+                    "ring_receive_buffer::receive",
+                    "the given generation has been received already");
+            }
+
+            // no future referring to the slot exists yet, so it can't be
+            // released (and the slot recycled) before this one is created
+            using traits::future_access;
+            return future_access<hpx::future<T>>::create(&s);
+        }
+
+        bool try_receive(std::size_t step, hpx::future<T>* f = nullptr)
+        {
+            if (capacity_ == 0)
+                return false;
+
+            slot& s = slots_[step & (capacity_ - 1)];
+            if (s.generation_.load(std::memory_order_acquire) != step ||
+                !(s.flags_.load(std::memory_order_acquire) & writer))
+            {
+                return false;
+            }
+
+            if (f != nullptr)
+            {
+                *f = receive(step);
+            }
+            return true;
+        }
+
+        template <typename Lock = hpx::lcos::local::no_mutex>
+        void store_received(std::size_t step, T&& val, Lock* lock = nullptr)
+        {
+            slot& s = get_slot(step, "ring_receive_buffer::store_received");
+
+            std::uint32_t old =
+                s.flags_.fetch_or(writer, std::memory_order_acq_rel);
+            if (old & writer)
+            {
+                HPX_THROW_EXCEPTION(invalid_status,
+                    "ring_receive_buffer::store_received",
+                    "the given generation has been stored already");
+            }
+
+            if (lock)
+                lock->unlock();
+
+            s.set_value(std::move(val));
+
+            old = s.flags_.fetch_or(value_set, std::memory_order_acq_rel);
+            if (old & released)
+            {
+                s.recycle();
+            }
+        }
+
+        /// Return whether no generation is currently pending, i.e. all
+        /// generations which were stored or received have been recycled.
+        bool empty() const
+        {
+            for (std::size_t i = 0; i != capacity_; ++i)
+            {
+                if (slots_[i].flags_.load(std::memory_order_acquire) != 0)
+                    return false;
+            }
+            return true;
+        }
+
+        // return the number of canceled (or deleted) buffer entries
+        std::size_t cancel_waiting(
+            std::exception_ptr const& e, bool force_delete_entries = false)
+        {
+            std::size_t count = 0;
+            for (std::size_t i = 0; i != capacity_; ++i)
+            {
+                slot& s = slots_[i];
+                std::uint32_t flags = s.flags_.load(std::memory_order_acquire);
+
+                // set the exception for all generations which have been
+                // received but not stored yet
+                while ((flags & receiver) && !(flags & writer))
+                {
+                    if (s.flags_.compare_exchange_weak(flags, flags | writer,
+                            std::memory_order_acq_rel))
+                    {
+                        s.set_exception(e);
+                        flags = s.flags_.fetch_or(
+                            value_set, std::memory_order_acq_rel);
+                        if (flags & released)
+                        {
+                            s.recycle();
+                        }
+                        ++count;
+                        break;
+                    }
+                }
+
+                // drop all values which have been stored but not received
+                if (force_delete_entries)
+                {
+                    flags = writer | value_set;
+                    if (s.flags_.compare_exchange_strong(flags,
+                            flags | receiver | released,
+                            std::memory_order_acq_rel))
+                    {
+                        s.recycle();
+                        ++count;
+                    }
+                }
+            }
+            return count;
+        }
+
+    protected:
+        static std::size_t round_up_to_power_of_two(std::size_t capacity)
+        {
+            std::size_t result = 1;
+            while (result < capacity)
+                result <<= 1;
+            return result;
+        }
+
+        slot& get_slot(std::size_t step, char const* function_name)
+        {
+            HPX_ASSERT(capacity_ != 0);
+
+            slot& s = slots_[step & (capacity_ - 1)];
+            std::size_t const generation =
+                s.generation_.load(std::memory_order_acquire);
+            if (generation == step)
+                return s;
+
+            if (step < generation)
+            {
+                HPX_THROW_EXCEPTION(invalid_status, function_name,
+                    "the given generation has been recycled already");
+            }
+
+            if (policy_ == out_of_window_policy::throw_exception)
+            {
+                HPX_THROW_EXCEPTION(out_of_range, function_name,
+                    "the given generation is ahead of the window of the "
+                    "receive buffer");
+            }
+
+            // wait for the slot to be recycled up to the given generation
+            util::yield_while([&]() {
+                return s.generation_.load(std::memory_order_acquire) < step;
+            });
+
+            if (s.generation_.load(std::memory_order_acquire) != step)
+            {
+                HPX_THROW_EXCEPTION(invalid_status, function_name,
+                    "the given generation has been recycled already");
+            }
+            return s;
+        }
+
+    private:
+        std::size_t capacity_;
+        std::unique_ptr<slot[]> slots_;
+        out_of_window_policy policy_;
+    };
+}}}    // namespace hpx::lcos::local
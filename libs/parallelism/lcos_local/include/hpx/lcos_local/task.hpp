@@ -0,0 +1,474 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file lcos_local/task.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_CXX20_COROUTINES)
+
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/datastructures/optional.hpp>
+#include <hpx/lcos_local/channel.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/futures.hpp>
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace hpx {
+    template <typename T = void>
+    class task;
+
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        // The coroutine frames of tasks are allocated from the thread local
+        // caches of the worker thread creating them.
+        struct task_frame_allocator
+        {
+            static void* allocate(std::size_t size)
+            {
+#if !defined(HPX_HAVE_SANITIZERS) && !defined(HPX_HAVE_VALGRIND)
+                if (size <= util::detail::thread_local_cache_max_size)
+                {
+                    return util::detail::thread_local_cache_allocate(size);
+                }
+#endif
+                return ::operator new(size);
+            }
+
+            static void deallocate(void* p, std::size_t size) noexcept
+            {
+#if !defined(HPX_HAVE_SANITIZERS) && !defined(HPX_HAVE_VALGRIND)
+                if (size <= util::detail::thread_local_cache_max_size)
+                {
+                    util::detail::thread_local_cache_deallocate(p, size);
+                    return;
+                }
+#endif
+                ::operator delete(p);
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Awaiting a future suspends the coroutine until the future becomes
+        // ready. The coroutine is resumed directly from the thread making the
+        // future ready, no new HPX thread is created.
+        template <typename Future>
+        class future_awaiter
+        {
+        public:
+            explicit future_awaiter(Future&& f) noexcept
+              : f_(std::move(f))
+            {
+            }
+
+            bool await_ready() const
+            {
+                return f_.is_ready();
+            }
+
+            bool await_suspend(std::coroutine_handle<> h)
+            {
+                auto const& state = traits::detail::get_shared_state(f_);
+                state->execute_deferred();
+
+                // execute_deferred might have made the future ready
+                if (state->is_ready())
+                    return false;
+
+                state->set_on_completed([h]() { h.resume(); });
+                return true;
+            }
+
+            decltype(auto) await_resume()
+            {
+                return f_.get();
+            }
+
+        private:
+            Future f_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        class task_promise_base
+        {
+            // Transfers control back to the awaiting coroutine once the task
+            // has finished executing.
+            struct final_awaiter
+            {
+                bool await_ready() const noexcept
+                {
+                    return false;
+                }
+
+                template <typename Promise>
+                std::coroutine_handle<> await_suspend(
+                    std::coroutine_handle<Promise> h) noexcept
+                {
+                    return h.promise().continuation_;
+                }
+
+                void await_resume() const noexcept {}
+            };
+
+        public:
+            task_promise_base() noexcept
+              : continuation_(std::noop_coroutine())
+            {
+            }
+
+            // tasks are started lazily, i.e. once they are awaited
+            std::suspend_always initial_suspend() const noexcept
+            {
+                return {};
+            }
+
+            final_awaiter final_suspend() const noexcept
+            {
+                return {};
+            }
+
+            void unhandled_exception() noexcept
+            {
+                exception_ = std::current_exception();
+            }
+
+            void set_continuation(std::coroutine_handle<> h) noexcept
+            {
+                continuation_ = h;
+            }
+
+            // Awaitables other than the ones handled below (e.g. tasks) are
+            // used as they are.
+            template <typename Awaitable>
+            Awaitable&& await_transform(Awaitable&& a) noexcept
+            {
+                return std::forward<Awaitable>(a);
+            }
+
+            template <typename T>
+            future_awaiter<hpx::future<T>> await_transform(hpx::future<T>&& f)
+            {
+                return future_awaiter<hpx::future<T>>(std::move(f));
+            }
+
+            template <typename T>
+            future_awaiter<hpx::future<T>> await_transform(hpx::future<T>& f)
+            {
+                return future_awaiter<hpx::future<T>>(std::move(f));
+            }
+
+            template <typename T>
+            future_awaiter<hpx::shared_future<T>> await_transform(
+                hpx::shared_future<T>&& f)
+            {
+                return future_awaiter<hpx::shared_future<T>>(std::move(f));
+            }
+
+            template <typename T>
+            future_awaiter<hpx::shared_future<T>> await_transform(
+                hpx::shared_future<T>& f)
+            {
+                return future_awaiter<hpx::shared_future<T>>(
+                    hpx::shared_future<T>(f));
+            }
+
+            template <typename T>
+            future_awaiter<hpx::shared_future<T>> await_transform(
+                hpx::shared_future<T> const& f)
+            {
+                return future_awaiter<hpx::shared_future<T>>(
+                    hpx::shared_future<T>(f));
+            }
+
+            // Awaiting a channel receives the next value from it
+            template <typename T>
+            future_awaiter<hpx::future<T>> await_transform(
+                lcos::local::channel<T>& c)
+            {
+                return future_awaiter<hpx::future<T>>(c.get());
+            }
+
+            template <typename T>
+            future_awaiter<hpx::future<T>> await_transform(
+                lcos::local::one_element_channel<T>& c)
+            {
+                return future_awaiter<hpx::future<T>>(c.get());
+            }
+
+            template <typename T>
+            future_awaiter<hpx::future<T>> await_transform(
+                lcos::local::receive_channel<T>& c)
+            {
+                return future_awaiter<hpx::future<T>>(c.get());
+            }
+
+            HPX_NODISCARD static void* operator new(std::size_t size)
+            {
+                return task_frame_allocator::allocate(size);
+            }
+
+            static void operator delete(void* p, std::size_t size) noexcept
+            {
+                task_frame_allocator::deallocate(p, size);
+            }
+
+        protected:
+            void rethrow_if_exception()
+            {
+                if (exception_)
+                {
+                    std::rethrow_exception(exception_);
+                }
+            }
+
+        private:
+            std::coroutine_handle<> continuation_;
+            std::exception_ptr exception_;
+        };
+
+        template <typename T>
+        class task_promise : public task_promise_base
+        {
+        public:
+            task<T> get_return_object() noexcept;
+
+            template <typename U>
+            void return_value(U&& value)
+            {
+                value_.emplace(std::forward<U>(value));
+            }
+
+            T result()
+            {
+                rethrow_if_exception();
+                HPX_ASSERT(value_.has_value());
+                return std::move(*value_);
+            }
+
+        private:
+            util::optional<T> value_;
+        };
+
+        template <>
+        class task_promise<void> : public task_promise_base
+        {
+        public:
+            task<void> get_return_object() noexcept;
+
+            void return_void() noexcept {}
+
+            void result()
+            {
+                rethrow_if_exception();
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // A coroutine which starts eagerly and destroys itself once it has
+        // finished executing, used to run a task from non-coroutine code.
+        struct detached_task
+        {
+            struct promise_type
+            {
+                detached_task get_return_object() const noexcept
+                {
+                    return {};
+                }
+
+                std::suspend_never initial_suspend() const noexcept
+                {
+                    return {};
+                }
+
+                std::suspend_never final_suspend() const noexcept
+                {
+                    return {};
+                }
+
+                void return_void() const noexcept {}
+
+                void unhandled_exception() const noexcept
+                {
+                    std::terminate();
+                }
+
+                HPX_NODISCARD static void* operator new(std::size_t size)
+                {
+                    return task_frame_allocator::allocate(size);
+                }
+
+                static void operator delete(void* p, std::size_t size) noexcept
+                {
+                    task_frame_allocator::deallocate(p, size);
+                }
+            };
+        };
+
+        template <typename T>
+        detached_task run_task(task<T> t, lcos::local::promise<T> p)
+        {
+            std::exception_ptr e;
+            try
+            {
+                if constexpr (std::is_void_v<T>)
+                {
+                    co_await std::move(t);
+                    p.set_value();
+                }
+                else
+                {
+                    p.set_value(co_await std::move(t));
+                }
+                co_return;
+            }
+            catch (...)
+            {
+                e = std::current_exception();
+            }
+            p.set_exception(std::move(e));
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A lazily started coroutine producing a value of type \a T. A task
+    /// starts executing once it is awaited (using co_await) by another
+    /// coroutine or once \a get_future is called. Awaiting a task transfers
+    /// control to it directly (symmetric transfer), the awaiting coroutine is
+    /// resumed directly once the task has finished executing. Neither starting
+    /// nor resuming a task creates a new HPX thread.
+    ///
+    /// Inside a task, co_await can be applied to other tasks, to futures and
+    /// shared futures, and to channels (receiving the next value). Awaiting a
+    /// future suspends the task until the future becomes ready, the task is
+    /// resumed by the thread making the future ready.
+    ///
+    /// The coroutine frames of tasks are allocated from the thread local
+    /// caches of the worker threads.
+    template <typename T>
+    class task
+    {
+    public:
+        using promise_type = detail::task_promise<T>;
+        using handle_type = std::coroutine_handle<promise_type>;
+
+        task() noexcept = default;
+
+        explicit task(handle_type h) noexcept
+          : h_(h)
+        {
+        }
+
+        task(task&& rhs) noexcept
+          : h_(std::exchange(rhs.h_, nullptr))
+        {
+        }
+
+        task& operator=(task&& rhs) noexcept
+        {
+            if (this != &rhs)
+            {
+                if (h_)
+                    h_.destroy();
+                h_ = std::exchange(rhs.h_, nullptr);
+            }
+            return *this;
+        }
+
+        ~task()
+        {
+            if (h_)
+                h_.destroy();
+        }
+
+        /// Return whether this task refers to a coroutine
+        bool valid() const noexcept
+        {
+            return static_cast<bool>(h_);
+        }
+
+        /// Return whether this task has finished executing
+        bool is_ready() const noexcept
+        {
+            return h_ && h_.done();
+        }
+
+        auto operator co_await() && noexcept
+        {
+            struct awaiter
+            {
+                bool await_ready() const noexcept
+                {
+                    return h_.done();
+                }
+
+                // start the task, it will resume the awaiting coroutine once
+                // it has finished executing
+                std::coroutine_handle<> await_suspend(
+                    std::coroutine_handle<> awaiting) noexcept
+                {
+                    h_.promise().set_continuation(awaiting);
+                    return h_;
+                }
+
+                T await_resume()
+                {
+                    return h_.promise().result();
+                }
+
+                handle_type h_;
+            };
+
+            HPX_ASSERT(h_);
+            return awaiter{h_};
+        }
+
+        /// Start executing this task on the calling thread and return a
+        /// future which becomes ready once the task has finished executing.
+        /// The task is invalidated by this operation.
+        hpx::future<T> get_future() &&
+        {
+            if (!h_)
+            {
+                HPX_THROW_EXCEPTION(no_state, "task::get_future",
+                    "this task has no valid coroutine");
+            }
+
+            lcos::local::promise<T> p;
+            hpx::future<T> f = p.get_future();
+            detail::run_task(std::move(*this), std::move(p));
+            return f;
+        }
+
+    private:
+        handle_type h_;
+    };
+
+    namespace detail {
+        template <typename T>
+        task<T> task_promise<T>::get_return_object() noexcept
+        {
+            return task<T>(
+                std::coroutine_handle<task_promise<T>>::from_promise(*this));
+        }
+
+        inline task<void> task_promise<void>::get_return_object() noexcept
+        {
+            return task<void>(
+                std::coroutine_handle<task_promise<void>>::from_promise(*this));
+        }
+    }    // namespace detail
+}    // namespace hpx
+
+#endif    // HPX_HAVE_CXX20_COROUTINES
@@ -0,0 +1,136 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the map based receive_buffer with the ring based
+// ring_receive_buffer, both for storing and receiving from the same thread
+// and for a producer and a consumer running concurrently.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/include/lcos_local.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+#if HPX_DEBUG
+constexpr std::size_t NUM_STEPS = 100000;
+#else
+constexpr std::size_t NUM_STEPS = 10000000;
+#endif
+
+// the size of the window of the ring based receive buffer
+constexpr std::size_t CAPACITY = 64;
+
+using map_buffer = hpx::lcos::local::receive_buffer<std::size_t>;
+using ring_buffer = hpx::lcos::local::ring_receive_buffer<std::size_t>;
+
+map_buffer make_buffer(map_buffer*)
+{
+    return map_buffer();
+}
+
+ring_buffer make_buffer(ring_buffer*)
+{
+    return ring_buffer(CAPACITY, hpx::lcos::local::out_of_window_policy::wait);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void report(char const* name, char const* test, double elapsed)
+{
+    std::cout << name << ", " << test << ": " << (NUM_STEPS / elapsed)
+              << " [steps/s] (" << (elapsed / NUM_STEPS) << " [s/step])\n";
+}
+
+// Store and receive each step from the same thread, this measures the
+// overhead of the buffer itself.
+template <typename Buffer>
+void test_sequential(char const* name)
+{
+    Buffer buffer = make_buffer(static_cast<Buffer*>(nullptr));
+
+    std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+
+    std::size_t sum = 0;
+    for (std::size_t i = 0; i != NUM_STEPS; ++i)
+    {
+        hpx::future<std::size_t> f = buffer.receive(i);
+        buffer.store_received(i, std::size_t(i));
+        sum += f.get();
+    }
+
+    std::uint64_t end = hpx::chrono::high_resolution_clock::now();
+
+    if (sum != NUM_STEPS * (NUM_STEPS - 1) / 2)
+    {
+        std::cout << "Error!\n";
+    }
+
+    report(name, "sequential", static_cast<double>(end - start) / 1e9);
+}
+
+// Store and receive the steps from two concurrently running threads
+template <typename Buffer>
+void producer(Buffer& buffer)
+{
+    for (std::size_t i = 0; i != NUM_STEPS; ++i)
+    {
+        buffer.store_received(i, std::size_t(i));
+    }
+}
+
+template <typename Buffer>
+std::size_t consumer(Buffer& buffer)
+{
+    std::size_t sum = 0;
+    for (std::size_t i = 0; i != NUM_STEPS; ++i)
+    {
+        sum += buffer.receive(i).get();
+    }
+    return sum;
+}
+
+template <typename Buffer>
+void test_producer_consumer(char const* name)
+{
+    Buffer buffer = make_buffer(static_cast<Buffer*>(nullptr));
+
+    std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+
+    hpx::future<void> p = hpx::async(&producer<Buffer>, std::ref(buffer));
+    hpx::future<std::size_t> c =
+        hpx::async(&consumer<Buffer>, std::ref(buffer));
+
+    p.get();
+    std::size_t sum = c.get();
+
+    std::uint64_t end = hpx::chrono::high_resolution_clock::now();
+
+    if (sum != NUM_STEPS * (NUM_STEPS - 1) / 2)
+    {
+        std::cout << "Error!\n";
+    }
+
+    report(name, "1 producer, 1 consumer",
+        static_cast<double>(end - start) / 1e9);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_sequential<map_buffer>("receive_buffer");
+    test_sequential<ring_buffer>("ring_receive_buffer");
+
+    test_producer_consumer<map_buffer>("receive_buffer");
+    test_producer_consumer<ring_buffer>("ring_receive_buffer");
+
+    return 0;
+}
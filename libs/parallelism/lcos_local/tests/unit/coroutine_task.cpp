@@ -0,0 +1,207 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_HAVE_CXX20_COROUTINES)
+#error "This test requires compiler support for C++20 coroutines"
+#endif
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos_local.hpp>
+#include <hpx/lcos_local/task.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <stdexcept>
+
+///////////////////////////////////////////////////////////////////////////////
+int just_wait(int result)
+{
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+    return result;
+}
+
+hpx::task<int> ready_value()
+{
+    co_return 42;
+}
+
+hpx::task<int> await_task()
+{
+    int result = co_await ready_value();
+    co_return result + 1;
+}
+
+hpx::task<> void_task(int& value)
+{
+    value = co_await ready_value();
+    co_return;
+}
+
+void test_simple()
+{
+    HPX_TEST_EQ(ready_value().get_future().get(), 42);
+    HPX_TEST_EQ(await_task().get_future().get(), 43);
+
+    int value = 0;
+    void_task(value).get_future().get();
+    HPX_TEST_EQ(value, 42);
+
+    // tasks are started lazily
+    hpx::task<int> t = ready_value();
+    HPX_TEST(t.valid());
+    HPX_TEST(!t.is_ready());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+hpx::task<int> fib(int n)
+{
+    if (n < 2)
+        co_return n;
+    co_return co_await fib(n - 1) + co_await fib(n - 2);
+}
+
+// awaiting many tasks in sequence doesn't grow the stack as control is
+// transferred symmetrically between the coroutines
+hpx::task<std::size_t> sum_tasks(std::size_t count)
+{
+    std::size_t sum = 0;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        sum += static_cast<std::size_t>(co_await ready_value());
+    }
+    co_return sum;
+}
+
+void test_nested()
+{
+    HPX_TEST_EQ(fib(15).get_future().get(), 610);
+    HPX_TEST_EQ(sum_tasks(10000).get_future().get(), std::size_t(420000));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+hpx::task<int> await_futures()
+{
+    int a = co_await hpx::make_ready_future(1);
+    int b = co_await hpx::async(&just_wait, 2);
+
+    hpx::shared_future<int> sf = hpx::async(&just_wait, 3);
+    int c = co_await sf;
+    int d = co_await sf;
+
+    hpx::future<int> f = hpx::async(hpx::launch::deferred, &just_wait, 4);
+    int e = co_await f;
+
+    co_await hpx::async([]() {});
+
+    co_return a + b + c + d + e;
+}
+
+void test_futures()
+{
+    HPX_TEST_EQ(await_futures().get_future().get(), 13);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+hpx::task<int> receive(hpx::lcos::local::channel<int>& c, int count)
+{
+    int sum = 0;
+    for (int i = 0; i != count; ++i)
+    {
+        sum += co_await c;
+    }
+    co_return sum;
+}
+
+void test_channel()
+{
+    hpx::lcos::local::channel<int> c;
+    hpx::future<int> f = receive(c, 10).get_future();
+
+    for (int i = 0; i != 10; ++i)
+    {
+        c.set(i);
+    }
+    HPX_TEST_EQ(f.get(), 45);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+hpx::task<int> throw_exception()
+{
+    co_await hpx::async([]() {});
+    throw std::runtime_error("error");
+    co_return 0;
+}
+
+hpx::task<int> catch_exception()
+{
+    try
+    {
+        co_await throw_exception();
+    }
+    catch (std::runtime_error const&)
+    {
+        co_return 1;
+    }
+    co_return 0;
+}
+
+hpx::task<int> await_exceptional_future()
+{
+    co_return co_await hpx::async([]() -> int {
+        throw std::runtime_error("error");
+    });
+}
+
+void test_exceptions()
+{
+    HPX_TEST_EQ(catch_exception().get_future().get(), 1);
+
+    bool caught = false;
+    try
+    {
+        throw_exception().get_future().get();
+    }
+    catch (std::runtime_error const&)
+    {
+        caught = true;
+    }
+    HPX_TEST(caught);
+
+    caught = false;
+    try
+    {
+        await_exceptional_future().get_future().get();
+    }
+    catch (std::runtime_error const&)
+    {
+        caught = true;
+    }
+    HPX_TEST(caught);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_simple();
+    test_nested();
+    test_futures();
+    test_channel();
+    test_exceptions();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
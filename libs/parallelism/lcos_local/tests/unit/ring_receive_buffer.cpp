@@ -0,0 +1,215 @@
+//  Copyright (c) 2021 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos_local.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using hpx::lcos::local::out_of_window_policy;
+using hpx::lcos::local::ring_receive_buffer;
+
+constexpr std::size_t num_steps = 10000;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_store_receive()
+{
+    ring_receive_buffer<int> buffer(5);
+    HPX_TEST_EQ(buffer.capacity(), std::size_t(8));
+    HPX_TEST(buffer.empty());
+
+    // receive before store
+    hpx::future<int> f = buffer.receive(0);
+    HPX_TEST(!f.is_ready());
+    HPX_TEST(!buffer.empty());
+
+    buffer.store_received(0, 42);
+    HPX_TEST_EQ(f.get(), 42);
+    HPX_TEST(buffer.empty());
+
+    // store before receive
+    buffer.store_received(1, 43);
+    HPX_TEST(buffer.try_receive(1));
+    HPX_TEST(!buffer.try_receive(2));
+    HPX_TEST_EQ(buffer.receive(1).get(), 43);
+    HPX_TEST(buffer.empty());
+}
+
+void test_recycling()
+{
+    ring_receive_buffer<std::size_t> buffer(4);
+
+    // each slot is reused for many generations
+    for (std::size_t i = 0; i != num_steps; ++i)
+    {
+        hpx::future<std::size_t> f = buffer.receive(i);
+        buffer.store_received(i, std::size_t(i));
+        HPX_TEST_EQ(f.get(), i);
+    }
+    HPX_TEST(buffer.empty());
+
+    // a slot is not recycled before all copies of the future are released
+    hpx::shared_future<std::size_t> f = buffer.receive(num_steps);
+    buffer.store_received(num_steps, std::size_t(1));
+
+    bool caught = false;
+    try
+    {
+        buffer.receive(num_steps + 4);
+    }
+    catch (hpx::exception const& e)
+    {
+        caught = true;
+        HPX_TEST_EQ(e.get_error(), hpx::out_of_range);
+    }
+    HPX_TEST(caught);
+
+    hpx::shared_future<std::size_t> g = f;
+    f = hpx::shared_future<std::size_t>();
+    HPX_TEST_EQ(g.get(), std::size_t(1));
+    g = hpx::shared_future<std::size_t>();
+
+    HPX_TEST(buffer.empty());
+
+    buffer.store_received(num_steps + 4, std::size_t(2));
+    HPX_TEST_EQ(buffer.receive(num_steps + 4).get(), std::size_t(2));
+
+    // generations which have been recycled already can't be accessed
+    caught = false;
+    try
+    {
+        buffer.receive(num_steps);
+    }
+    catch (hpx::exception const& e)
+    {
+        caught = true;
+        HPX_TEST_EQ(e.get_error(), hpx::invalid_status);
+    }
+    HPX_TEST(caught);
+}
+
+void test_duplicate_receive()
+{
+    ring_receive_buffer<int> buffer(4);
+
+    hpx::future<int> f = buffer.receive(0);
+
+    // a second receive for the same generation throws and leaves the slot
+    // to the first receiver
+    bool caught = false;
+    try
+    {
+        buffer.receive(0);
+    }
+    catch (hpx::exception const& e)
+    {
+        caught = true;
+        HPX_TEST_EQ(e.get_error(), hpx::invalid_status);
+    }
+    HPX_TEST(caught);
+    HPX_TEST(!f.is_ready());
+
+    // the slot can't have been recycled while the first future is alive
+    caught = false;
+    try
+    {
+        buffer.store_received(4, 43);
+    }
+    catch (hpx::exception const& e)
+    {
+        caught = true;
+        HPX_TEST_EQ(e.get_error(), hpx::out_of_range);
+    }
+    HPX_TEST(caught);
+
+    buffer.store_received(0, 42);
+    HPX_TEST(f.is_ready());
+    HPX_TEST_EQ(f.get(), 42);
+    HPX_TEST(buffer.empty());
+}
+
+void test_concurrent()
+{
+    ring_receive_buffer<std::size_t> buffer(16, out_of_window_policy::wait);
+
+    // the producer runs ahead of the consumer and has to wait for slots to
+    // be recycled
+    hpx::future<void> producer = hpx::async([&]() {
+        for (std::size_t i = 0; i != num_steps; ++i)
+        {
+            buffer.store_received(i, std::size_t(i));
+        }
+    });
+
+    hpx::future<std::size_t> consumer = hpx::async([&]() {
+        std::size_t sum = 0;
+        for (std::size_t i = 0; i != num_steps; ++i)
+        {
+            sum += buffer.receive(i).get();
+        }
+        return sum;
+    });
+
+    producer.get();
+    HPX_TEST_EQ(consumer.get(), num_steps * (num_steps - 1) / 2);
+    HPX_TEST(buffer.empty());
+}
+
+void test_cancel_waiting()
+{
+    ring_receive_buffer<int> buffer(4);
+
+    hpx::future<int> f = buffer.receive(0);
+    buffer.store_received(1, 42);
+
+    HPX_TEST_EQ(buffer.cancel_waiting(std::make_exception_ptr(
+                    std::runtime_error("canceled"))),
+        std::size_t(1));
+
+    bool caught = false;
+    try
+    {
+        f.get();
+    }
+    catch (std::runtime_error const&)
+    {
+        caught = true;
+    }
+    HPX_TEST(caught);
+    HPX_TEST(!buffer.empty());
+
+    HPX_TEST_EQ(buffer.cancel_waiting(std::make_exception_ptr(
+                                          std::runtime_error("canceled")),
+                    true),
+        std::size_t(1));
+    HPX_TEST(buffer.empty());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_store_receive();
+    test_recycling();
+    test_duplicate_receive();
+    test_concurrent();
+    test_cancel_waiting();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -140,7 +140,9 @@ namespace hpx { namespace agas
 
     addressing_service::addressing_service(
         util::runtime_configuration const& ini_)
-      : gva_cache_(new gva_cache_type)
+      : gva_cache_(new gva_cache_type(
+            ini_.get_agas_caching_mode() ? ini_.get_agas_local_cache_shards() :
+                                           1))
       , console_cache_(naming::invalid_locality_id)
       , max_refcnt_requests_(ini_.get_agas_max_pending_refcnt_requests())
       , refcnt_requests_count_(0)
@@ -385,7 +387,7 @@ void addressing_service::adjust_local_cache_size(std::size_t cache_size)
     if (caching_)
     {
         std::size_t previous = gva_cache_->size();
-            gva_cache_->reserve(cache_size);
+        gva_cache_->reserve(cache_size);
 
         LAGAS_(info) << hpx::util::format(
             "addressing_service::adjust_local_cache_size, previous size: {1}, "
@@ -1948,32 +1950,28 @@ void addressing_service::update_cache_entry(
 
         const gva_cache_key key(gid, count);
 
+        if (!gva_cache_->update_if(key, g, check_for_collisions))
         {
-            std::unique_lock<mutex_type> lock(gva_cache_mtx_);
-            if (!gva_cache_->update_if(key, g, check_for_collisions))
+            if (LAGAS_ENABLED(warning))
             {
-                if (LAGAS_ENABLED(warning))
-                {
-                    // Figure out who we collided with.
-                    addressing_service::gva_cache_key idbase;
-                    addressing_service::gva_cache_type::entry_type e;
+                // Figure out who we collided with.
+                addressing_service::gva_cache_key idbase;
+                addressing_service::gva_cache_type::entry_type e;
 
-                    if (!gva_cache_->get_entry(key, idbase, e))
-                    {
-                        // This is impossible under sane conditions.
-                        lock.unlock();
-                        HPX_THROWS_IF(ec, invalid_data
-                          , "addressing_service::update_cache_entry"
-                          , "data corruption or lock error occurred in cache");
-                        return;
-                    }
-
-                    LAGAS_(warning) << hpx::util::format(
-                        "addressing_service::update_cache_entry, "
-                        "aborting update due to key collision in cache, "
-                        "new_gid({1}), new_count({2}), old_gid({3}), old_count({4})",
-                        gid, count, idbase.get_gid(), idbase.get_count());
+                if (!gva_cache_->get_entry(key, idbase, e))
+                {
+                    // This is impossible under sane conditions.
+                    HPX_THROWS_IF(ec, invalid_data
+                      , "addressing_service::update_cache_entry"
+                      , "data corruption or lock error occurred in cache");
+                    return;
                 }
+
+                LAGAS_(warning) << hpx::util::format(
+                    "addressing_service::update_cache_entry, "
+                    "aborting update due to key collision in cache, "
+                    "new_gid({1}), new_count({2}), old_gid({3}), old_count({4})",
+                    gid, count, idbase.get_gid(), idbase.get_count());
             }
         }
 
@@ -2000,7 +1998,6 @@ bool addressing_service::get_cache_entry(
     gva_cache_key k(gid);
     gva_cache_key idbase_key;
 
-    std::unique_lock<mutex_type> lock(gva_cache_mtx_);
     if(gva_cache_->get_entry(k, idbase_key, gva))
     {
         const std::uint64_t id_msb =
@@ -2008,7 +2005,6 @@ bool addressing_service::get_cache_entry(
 
         if (HPX_UNLIKELY(id_msb != idbase_key.get_gid().get_msb()))
         {
-            lock.unlock();
             HPX_THROWS_IF(ec, internal_server_error
               , "addressing_service::get_cache_entry"
               , "bad entry in cache, MSBs of GID base and GID do not match");
@@ -2037,8 +2033,6 @@ void addressing_service::clear_cache(
     try {
         LAGAS_(warning) << "addressing_service::clear_cache, clearing cache";
 
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-
         gva_cache_->clear();
 
         if (&ec != &throws)
@@ -2084,8 +2078,6 @@ void addressing_service::remove_cache_entry(
     try {
         LAGAS_(warning) << "addressing_service::remove_cache_entry";
 
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-
         gva_cache_->erase(
             [&gid](std::pair<gva_cache_key, gva> const& p)
             {
@@ -2235,81 +2227,104 @@ namespace detail
 // Helper functions to access the current cache statistics
 std::uint64_t addressing_service::get_cache_entries(bool /* reset */)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->size();
 }
 
 std::uint64_t addressing_service::get_cache_hits(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().hits(reset);
+    return gva_cache_->accumulate_statistics(
+        [reset](gva_cache_type::statistics_type& stats) {
+            return stats.hits(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_misses(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().misses(reset);
+    return gva_cache_->accumulate_statistics(
+        [reset](gva_cache_type::statistics_type& stats) {
+            return stats.misses(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_evictions(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().evictions(reset);
+    return gva_cache_->accumulate_statistics(
+        [reset](gva_cache_type::statistics_type& stats) {
+            return stats.evictions(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_insertions(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().insertions(reset);
+    return gva_cache_->accumulate_statistics(
+        [reset](gva_cache_type::statistics_type& stats) {
+            return stats.insertions(reset);
+        });
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 std::uint64_t addressing_service::get_cache_get_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_get_entry_count(reset);
+    return gva_cache_->accumulate_statistics(
+        [reset](gva_cache_type::statistics_type& stats) {
+            return stats.get_get_entry_count(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_insertion_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_insert_entry_count(reset);
+    return gva_cache_->accumulate_statistics(
+        [reset](gva_cache_type::statistics_type& stats) {
+            return stats.get_insert_entry_count(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_update_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_update_entry_count(reset);
+    return gva_cache_->accumulate_statistics(
+        [reset](gva_cache_type::statistics_type& stats) {
+            return stats.get_update_entry_count(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_erase_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_erase_entry_count(reset);
+    return gva_cache_->accumulate_statistics(
+        [reset](gva_cache_type::statistics_type& stats) {
+            return stats.get_erase_entry_count(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_get_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_get_entry_time(reset);
+    return gva_cache_->accumulate_statistics(
+        [reset](gva_cache_type::statistics_type& stats) {
+            return stats.get_get_entry_time(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_insertion_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_insert_entry_time(reset);
+    return gva_cache_->accumulate_statistics(
+        [reset](gva_cache_type::statistics_type& stats) {
+            return stats.get_insert_entry_time(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_update_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_update_entry_time(reset);
+    return gva_cache_->accumulate_statistics(
+        [reset](gva_cache_type::statistics_type& stats) {
+            return stats.get_update_entry_time(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_erase_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_erase_entry_time(reset);
+    return gva_cache_->accumulate_statistics(
+        [reset](gva_cache_type::statistics_type& stats) {
+            return stats.get_erase_entry_time(reset);
+        });
 }
 
 /// Install performance counter types exposing properties from the local cache.
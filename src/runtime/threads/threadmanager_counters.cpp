@@ -9,6 +9,7 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <hpx/config.hpp>
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/functional/bind_back.hpp>
@@ -20,10 +21,19 @@
 #include <hpx/modules/threadmanager.hpp>
 #include <hpx/runtime/threads/threadmanager_counters.hpp>
 #include <hpx/schedulers/maintain_queue_wait_times.hpp>
+#include <hpx/threading_base/latency_histogram.hpp>
+
+#if (defined(__linux) || defined(linux) || defined(__linux__) ||               \
+    defined(__FreeBSD__) || defined(__APPLE__)) &&                             \
+    defined(HPX_HAVE_THREAD_STACK_MMAP)
+#include <hpx/coroutines/detail/posix_utility.hpp>
+#include <hpx/coroutines/detail/stack_pool.hpp>
+#endif
 
 #include <cstddef>
 #include <cstdint>
 #include <utility>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace threads {
@@ -108,6 +118,89 @@ namespace hpx { namespace threads {
             return naming::invalid_gid;
         }
 
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+        naming::gid_type latency_histogram_counter_creator(threadmanager* tm,
+            threadmanager_histogram_func total_func,
+            threadpool_histogram_func pool_func,
+            performance_counters::counter_info const& info, error_code& ec)
+        {
+            // verify the validity of the counter instance name
+            performance_counters::counter_path_elements paths;
+            performance_counters::get_counter_path_elements(
+                info.fullname_, paths, ec);
+            if (ec)
+                return naming::invalid_gid;
+
+            if (paths.parentinstance_is_basename_)
+            {
+                HPX_THROWS_IF(ec, bad_parameter,
+                    "latency_histogram_counter_creator",
+                    "invalid counter instance parent name: " +
+                        paths.parentinstancename_);
+                return naming::invalid_gid;
+            }
+
+            using performance_counters::detail::create_raw_counter;
+            util::function_nonser<std::vector<std::int64_t>(bool)> f;
+
+            thread_pool_base& pool = tm->default_pool();
+            thread_pool_base* pool_instance = nullptr;
+            std::size_t num_thread = 0;
+
+            if (paths.instancename_ == "total" && paths.instanceindex_ == -1)
+            {
+                // overall counter
+                f = [tm, total_func](bool reset) {
+                    return latency_histogram::get_counter_values(
+                        (tm->*total_func)(reset));
+                };
+            }
+            else if (paths.instancename_ == "pool")
+            {
+                if (paths.instanceindex_ >= 0 &&
+                    std::size_t(paths.instanceindex_) <
+                        hpx::resource::get_num_thread_pools())
+                {
+                    // specific for given pool counter
+                    pool_instance =
+                        &hpx::resource::get_thread_pool(paths.instanceindex_);
+                    num_thread =
+                        static_cast<std::size_t>(paths.subinstanceindex_);
+                }
+            }
+            else if (paths.instancename_ == "worker-thread" &&
+                paths.instanceindex_ >= 0 &&
+                std::size_t(paths.instanceindex_) < pool.get_os_thread_count())
+            {
+                // specific counter from default
+                pool_instance = &pool;
+                num_thread = static_cast<std::size_t>(paths.instanceindex_);
+            }
+
+            if (pool_instance != nullptr)
+            {
+                f = [pool_instance, pool_func, num_thread](bool reset) {
+                    return latency_histogram::get_counter_values(
+                        (pool_instance->*pool_func)(num_thread, reset));
+                };
+            }
+
+            if (f.empty())
+            {
+                HPX_THROWS_IF(ec, bad_parameter,
+                    "latency_histogram_counter_creator",
+                    "invalid counter instance name: " + paths.instancename_);
+                return naming::invalid_gid;
+            }
+
+            naming::gid_type gid = create_raw_counter(info, std::move(f), ec);
+            if (!ec)
+                set_latency_histograms_enabled(true);
+
+            return gid;
+        }
+#endif
+
         // scheduler utilization counter creation function
         naming::gid_type scheduler_utilization_counter_creator(
             threadmanager* tm, performance_counters::counter_info const& info,
@@ -414,6 +507,99 @@ namespace hpx { namespace threads {
             return naming::invalid_gid;
         }
 #endif
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
+    _POSIX_MAPPED_FILES > 0
+        ///////////////////////////////////////////////////////////////////////
+        // stack pool occupancy counter creation function
+        naming::gid_type stack_pool_counter_creator(
+            performance_counters::counter_info const& info, error_code& ec)
+        {
+            // verify the validity of the counter instance name
+            performance_counters::counter_path_elements paths;
+            performance_counters::get_counter_path_elements(
+                info.fullname_, paths, ec);
+            if (ec)
+                return naming::invalid_gid;
+
+            namespace stack_pool = coroutines::detail::posix::stack_pool;
+
+            struct creator_data
+            {
+                char const* const countername;
+                util::function_nonser<std::int64_t(bool)> total_func;
+            };
+
+            creator_data data[] = {
+                // /threads{locality#%d/total}/stack-pool/in-use
+                {"stack-pool/in-use", &stack_pool::get_in_use_count},
+                // /threads{locality#%d/total}/stack-pool/idle
+                {"stack-pool/idle", &stack_pool::get_idle_count},
+                // /threads{locality#%d/total}/stack-pool/mapped
+                {"stack-pool/mapped", &stack_pool::get_mapped_bytes},
+                // /threads{locality#%d/total}/stack-pool/released
+                {"stack-pool/released", &stack_pool::get_release_count},
+            };
+            std::size_t const data_size = sizeof(data) / sizeof(data[0]);
+
+            for (creator_data const* d = data; d < &data[data_size]; ++d)
+            {
+                if (paths.countername_ == d->countername)
+                {
+                    return counter_creator(info, paths, d->total_func,
+                        util::function_nonser<std::int64_t(bool)>(), "", 0,
+                        ec);
+                }
+            }
+
+            HPX_THROWS_IF(ec, bad_parameter, "stack_pool_counter_creator",
+                "invalid counter instance name: " + paths.instancename_);
+            return naming::invalid_gid;
+        }
+#endif
+
+        ///////////////////////////////////////////////////////////////////////
+        // thread local allocation cache counter creation function
+        naming::gid_type allocator_cache_counter_creator(
+            performance_counters::counter_info const& info, error_code& ec)
+        {
+            // verify the validity of the counter instance name
+            performance_counters::counter_path_elements paths;
+            performance_counters::get_counter_path_elements(
+                info.fullname_, paths, ec);
+            if (ec)
+                return naming::invalid_gid;
+
+            struct creator_data
+            {
+                char const* const countername;
+                util::function_nonser<std::int64_t(bool)> total_func;
+            };
+
+            creator_data data[] = {
+                // /threads{locality#%d/total}/allocator-cache/hits
+                {"allocator-cache/hits",
+                    &util::get_thread_local_cache_hit_count},
+                // /threads{locality#%d/total}/allocator-cache/misses
+                {"allocator-cache/misses",
+                    &util::get_thread_local_cache_miss_count},
+            };
+            std::size_t const data_size = sizeof(data) / sizeof(data[0]);
+
+            for (creator_data const* d = data; d < &data[data_size]; ++d)
+            {
+                if (paths.countername_ == d->countername)
+                {
+                    return counter_creator(info, paths, d->total_func,
+                        util::function_nonser<std::int64_t(bool)>(), "", 0,
+                        ec);
+                }
+            }
+
+            HPX_THROWS_IF(ec, bad_parameter, "allocator_cache_counter_creator",
+                "invalid counter instance name: " + paths.instancename_);
+            return naming::invalid_gid;
+        }
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -423,6 +609,13 @@ namespace hpx { namespace threads {
         performance_counters::create_counter_func counts_creator(
             util::bind_front(&detail::thread_counts_counter_creator));
 #endif
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
+    _POSIX_MAPPED_FILES > 0
+        performance_counters::create_counter_func stack_pool_creator(
+            &detail::stack_pool_counter_creator);
+#endif
+        performance_counters::create_counter_func allocator_cache_creator(
+            &detail::allocator_cache_counter_creator);
 
         performance_counters::generic_counter_type_data counter_types[] = {
             // length of thread queue(s)
@@ -458,6 +651,41 @@ namespace hpx { namespace threads {
                 &performance_counters::locality_pool_thread_counter_discoverer,
                 "ns"},
 #endif
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+            // histograms of scheduling latencies
+            {"/threads/time/queue-wait-histogram",
+                performance_counters::counter_histogram,
+                "returns a histogram of the times pending HPX-threads have "
+                "waited before being run for the first time on the "
+                "referenced object",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&detail::latency_histogram_counter_creator,
+                    &tm, &threadmanager::get_queue_wait_time_histogram,
+                    &thread_pool_base::get_queue_wait_time_histogram),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                "ns"},
+            {"/threads/time/phase-duration-histogram",
+                performance_counters::counter_histogram,
+                "returns a histogram of the durations of the HPX-thread "
+                "phases (activations) run on the referenced object",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&detail::latency_histogram_counter_creator,
+                    &tm, &threadmanager::get_thread_phase_duration_histogram,
+                    &thread_pool_base::get_thread_phase_duration_histogram),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                "ns"},
+            {"/threads/time/resume-latency-histogram",
+                performance_counters::counter_histogram,
+                "returns a histogram of the times HPX-threads have waited "
+                "after being resumed from suspension before being run again "
+                "on the referenced object",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&detail::latency_histogram_counter_creator,
+                    &tm, &threadmanager::get_resume_latency_histogram,
+                    &thread_pool_base::get_resume_latency_histogram),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                "ns"},
+#endif
 #ifdef HPX_HAVE_THREAD_IDLE_RATES
             // idle rate
             {"/threads/idle-rate", performance_counters::counter_average_count,
@@ -727,6 +955,48 @@ namespace hpx { namespace threads {
                 HPX_PERFORMANCE_COUNTER_V1, counts_creator,
                 &detail::locality_allocator_counter_discoverer, ""},
 #endif
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
+    _POSIX_MAPPED_FILES > 0
+            {   "/threads/stack-pool/in-use",
+                performance_counters::counter_raw,
+                "returns the number of HPX-thread stacks currently handed out "
+                "by the stack pool for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, stack_pool_creator,
+                &performance_counters::locality_counter_discoverer, ""},
+            {   "/threads/stack-pool/idle",
+                performance_counters::counter_raw,
+                "returns the number of idle HPX-thread stacks held by the "
+                "stack pool for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, stack_pool_creator,
+                &performance_counters::locality_counter_discoverer, ""},
+            {   "/threads/stack-pool/mapped",
+                performance_counters::counter_raw,
+                "returns the overall amount of memory mapped by the stack "
+                "pool for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, stack_pool_creator,
+                &performance_counters::locality_counter_discoverer, "bytes"},
+            {   "/threads/stack-pool/released",
+                performance_counters::counter_monotonically_increasing,
+                "returns the number of idle HPX-thread stacks whose memory "
+                "was given back to the operating system by the stack pool for "
+                "the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, stack_pool_creator,
+                &performance_counters::locality_counter_discoverer, ""},
+#endif
+            {   "/threads/allocator-cache/hits",
+                performance_counters::counter_monotonically_increasing,
+                "returns the number of shared state and continuation "
+                "allocations served from the thread local caches for the "
+                "referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, allocator_cache_creator,
+                &performance_counters::locality_counter_discoverer, ""},
+            {   "/threads/allocator-cache/misses",
+                performance_counters::counter_monotonically_increasing,
+                "returns the number of shared state and continuation "
+                "allocations which could not be served from the thread local "
+                "caches for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, allocator_cache_creator,
+                &performance_counters::locality_counter_discoverer, ""},
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
             {   "/threads/count/pending-misses",
                 performance_counters::counter_monotonically_increasing,
@@ -18,6 +18,7 @@
 #include <hpx/cache/local_cache.hpp>
 #include <hpx/cache/statistics/local_full_statistics.hpp>
 #include <hpx/preprocessor/stringize.hpp>
+#include <hpx/runtime/agas/detail/sharded_gva_cache.hpp>
 #include <hpx/statistics/histogram.hpp>
 #include <hpx/modules/testing.hpp>
 
@@ -30,6 +31,7 @@
 #include <iomanip>
 #include <iostream>
 #include <map>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -125,6 +127,12 @@ typedef hpx::util::cache::local_cache<
     hpx::util::cache::statistics::local_full_statistics
 > gva_cache_type;
 
+// The sharded cache as used by the AGAS addressing_service
+typedef hpx::agas::detail::sharded_gva_cache<gva_cache_key, hpx::agas::gva,
+    hpx::util::cache::statistics::local_full_statistics,
+    hpx::lcos::local::spinlock>
+    sharded_gva_cache_type;
+
 ///////////////////////////////////////////////////////////////////////////////
 void calculate_histogram(std::string const& prefix,
     std::vector<std::uint64_t> const& timings)
@@ -231,6 +239,88 @@ void test_update(gva_cache_type& cache, hpx::naming::gid_type first_key)
     calculate_histogram("update", timings);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Measure the throughput of cache hits while all worker threads concurrently
+// look up entries
+template <typename F>
+double concurrent_get_throughput(
+    F const& get_entry, std::size_t num_entries, std::size_t num_lookups)
+{
+    std::size_t const num_threads = hpx::get_os_thread_count();
+
+    hpx::chrono::high_resolution_timer t;
+
+    std::vector<hpx::future<void>> threads;
+    threads.reserve(num_threads);
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        threads.push_back(hpx::async([&, i]() {
+            std::size_t idx = i;
+            for (std::size_t j = 0; j != num_lookups; ++j)
+            {
+                idx = (idx * 2654435761ull + 1) % num_entries;
+                get_entry(idx);
+            }
+        }));
+    }
+    hpx::wait_all(threads);
+
+    return double(num_threads * num_lookups) / t.elapsed();
+}
+
+void test_concurrent_get(std::size_t cache_size, std::size_t num_entries,
+    std::size_t num_lookups)
+{
+    hpx::naming::gid_type locality = hpx::get_locality();
+    std::uint32_t ct = hpx::components::component_invalid;
+
+    num_entries = (std::min)(num_entries, cache_size);
+
+    std::vector<gva_cache_key> keys;
+    keys.reserve(num_entries);
+
+    gva_cache_type cache;
+    cache.reserve(cache_size);
+    hpx::lcos::local::spinlock cache_mtx;
+
+    sharded_gva_cache_type sharded_cache(hpx::get_os_thread_count());
+    sharded_cache.reserve(cache_size);
+
+    for (std::size_t i = 0; i != num_entries; ++i)
+    {
+        keys.emplace_back(hpx::detail::get_next_id(), 1);
+        hpx::agas::gva value(locality, ct, 1, std::uint64_t(0), 0);
+
+        cache.insert(keys.back(), value);
+        sharded_cache.update_if(keys.back(), value,
+            [](gva_cache_key const&, gva_cache_key const&) { return false; });
+    }
+
+    double single_lock = concurrent_get_throughput(
+        [&](std::size_t idx) {
+            gva_cache_key idbase;
+            gva_cache_type::entry_type e;
+
+            std::lock_guard<hpx::lcos::local::spinlock> l(cache_mtx);
+            cache.get_entry(keys[idx], idbase, e);
+        },
+        num_entries, num_lookups);
+
+    double sharded = concurrent_get_throughput(
+        [&](std::size_t idx) {
+            gva_cache_key idbase;
+            hpx::agas::gva e;
+
+            sharded_cache.get_entry(keys[idx], idbase, e);
+        },
+        num_entries, num_lookups);
+
+    std::cout << "concurrent get (" << hpx::get_os_thread_count()
+              << " threads): single lock " << single_lock << " [op/s], "
+              << sharded_cache.num_shards() << " shards " << sharded
+              << " [op/s]" << std::endl;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -242,6 +332,10 @@ int hpx_main(hpx::program_options::variables_map& vm)
     if (vm.count("num_entries"))
         num_entries = vm["num_entries"].as<std::size_t>();
 
+    std::size_t num_lookups = 100000;
+    if (vm.count("num_lookups"))
+        num_lookups = vm["num_lookups"].as<std::size_t>();
+
     gva_cache_type cache;
     cache.reserve(cache_size);
 
@@ -252,6 +346,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
     test_insert(cache, num_entries);
     test_get(cache, first_key);
     test_update(cache, first_key);
+    test_concurrent_get(cache_size, num_entries, num_lookups);
 
     double elapsed = t1.elapsed();
     hpx::util::print_cdash_timing("AGASCache", elapsed);
@@ -271,6 +366,8 @@ int main(int argc, char* argv[])
          HPX_PP_STRINGIZE(HPX_AGAS_LOCAL_CACHE_SIZE_PER_THREAD) ")")
         ("num_entries,n", value<std::size_t>(),
          "number of items to insert into cache (default: 1000)")
+        ("num_lookups", value<std::size_t>(),
+         "number of concurrent lookups per worker thread (default: 100000)")
         ;
 
     // Initialize and run HPX
@@ -4,6 +4,7 @@
 //  Distributed under the Boost Software License, Version 1.0. (See accompanying
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
 #include <hpx/hpx.hpp>
 #include <hpx/hpx_init.hpp>
 #include <hpx/modules/testing.hpp>
@@ -62,6 +63,16 @@ hpx::future<void> spawn_level(std::size_t num_tasks)
     return hpx::when_all(tasks);
 }
 
+void print_allocator_cache_stats()
+{
+    std::int64_t const hits = hpx::util::get_thread_local_cache_hit_count(true);
+    std::int64_t const misses =
+        hpx::util::get_thread_local_cache_miss_count(true);
+
+    std::cout << "Allocator cache: hits " << hits << ", misses " << misses
+              << std::endl;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -71,6 +82,10 @@ int hpx_main(hpx::program_options::variables_map& vm)
 
     double seqential_time_per_task = 0;
 
+    // don't count the allocations done during startup
+    hpx::util::get_thread_local_cache_hit_count(true);
+    hpx::util::get_thread_local_cache_miss_count(true);
+
     {
         std::vector<hpx::future<void> > tasks;
         tasks.reserve(num_tasks);
@@ -90,6 +105,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
                   << static_cast<double>(end - start) / 1e9 << " [s], ("
                   << seqential_time_per_task << " [s])" << std::endl;
         hpx::util::print_cdash_timing("AsyncSequential", seqential_time_per_task);
+        print_allocator_cache_stats();
     }
 
     double hierarchical_time_per_task = 0;
@@ -108,6 +124,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
                   << static_cast<double>(end - start) / 1e9 << " [s], ("
                   << hierarchical_time_per_task << " [s])" << std::endl;
         hpx::util::print_cdash_timing("AsyncHierarchical", hierarchical_time_per_task);
+        print_allocator_cache_stats();
     }
 
     std::cout
@@ -7,13 +7,19 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <hpx/config.hpp>
+#include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
 #if defined(HPX_HAVE_DISTRIBUTED_RUNTIME) && !defined(HPX_COMPUTE_DEVICE_CODE)
 #include <hpx/actions_base/plain_action.hpp>
 #include <hpx/runtime/actions/continuation.hpp>
 #endif
 #include <hpx/async_combinators/wait_each.hpp>
+#include <hpx/execution/algorithms/sync_wait.hpp>
+#include <hpx/execution/algorithms/then.hpp>
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/executors/limiting_executor.hpp>
+#include <hpx/executors/thread_pool_scheduler.hpp>
+#include <hpx/futures/futures_factory.hpp>
 #include <hpx/hpx_init.hpp>
 #include <hpx/include/apply.hpp>
 #include <hpx/include/async.hpp>
@@ -32,6 +38,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <iostream>
+#include <memory>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -351,6 +358,107 @@ void measure_function_futures_for_loop(std::uint64_t count, bool csv,
         executor_name ? executor_name : exec_name(exec), count, duration, csv);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Each iteration runs null_function on a new thread followed by a chain of
+// continuations run inline, the futures version allocates a shared state for
+// each continuation, the senders version doesn't allocate anything but the
+// thread
+double add_null_function(double d) noexcept
+{
+    return d + null_function();
+}
+
+void measure_function_futures_then_chain(std::uint64_t count, bool csv,
+    hpx::execution::parallel_executor const& exec)
+{
+    auto continuation = [](future<double>&& f) {
+        return add_null_function(f.get());
+    };
+
+    // start the clock
+    high_resolution_timer walltime;
+    for (std::uint64_t i = 0; i < count; ++i)
+    {
+        global_scratch += async(exec, &null_function)
+                              .then(hpx::launch::sync, continuation)
+                              .then(hpx::launch::sync, continuation)
+                              .then(hpx::launch::sync, continuation)
+                              .then(hpx::launch::sync, continuation)
+                              .get();
+    }
+
+    // stop the clock
+    const double duration = walltime.elapsed();
+    print_stats("then_chain", "get", exec_name(exec), count, duration, csv);
+}
+
+void measure_function_senders_then_chain(std::uint64_t count, bool csv)
+{
+    namespace ex = hpx::execution::experimental;
+
+    ex::thread_pool_scheduler sched;
+
+    // start the clock
+    high_resolution_timer walltime;
+    for (std::uint64_t i = 0; i < count; ++i)
+    {
+        global_scratch += ex::sync_wait(ex::then(
+            ex::then(
+                ex::then(
+                    ex::then(ex::then(ex::schedule(sched), &null_function),
+                        &add_null_function),
+                    &add_null_function),
+                &add_null_function),
+            &add_null_function));
+    }
+
+    // stop the clock
+    const double duration = walltime.elapsed();
+    print_stats("then_chain", "sync_wait", "thread_pool_scheduler", count,
+        duration, csv);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Same as measure_function_futures_wait_all, except that the shared states are
+// allocated using the given allocator (hpx::async uses the thread local caching
+// allocator by default)
+template <typename Allocator>
+void measure_function_futures_allocator(std::uint64_t count, bool csv,
+    Allocator const& alloc, char const* allocator_name)
+{
+    std::vector<future<double>> futures;
+    futures.reserve(count);
+
+    // start the clock
+    high_resolution_timer walltime;
+    for (std::uint64_t i = 0; i < count; ++i)
+    {
+        hpx::lcos::local::futures_factory<double()> p(
+            std::allocator_arg, alloc, &null_function);
+        futures.push_back(p.get_future());
+        p.apply();
+    }
+    wait_all(futures);
+
+    // stop the clock
+    const double duration = walltime.elapsed();
+    print_stats(
+        "futures_factory", "WaitAll", allocator_name, count, duration, csv);
+}
+
+void print_allocator_cache_stats(bool csv)
+{
+    std::int64_t const hits = hpx::util::get_thread_local_cache_hit_count(true);
+    std::int64_t const misses =
+        hpx::util::get_thread_local_cache_miss_count(true);
+
+    if (!csv)
+    {
+        std::cout << "allocator cache: hits " << hits << ", misses " << misses
+                  << std::endl;
+    }
+}
+
 void measure_function_futures_register_work(std::uint64_t count, bool csv)
 {
     hpx::lcos::local::latch l(count);
@@ -569,11 +677,19 @@ int hpx_main(variables_map& vm)
                 measure_function_futures_for_loop(count, csv, par_agg);
                 measure_function_futures_for_loop(
                     count, csv, par_nostack, "parallel_executor_nostack");
+                measure_function_futures_then_chain(count, csv, par);
+                measure_function_senders_then_chain(count, csv);
+                measure_function_futures_allocator(count, csv,
+                    hpx::util::internal_allocator<>{}, "internal_allocator");
+                measure_function_futures_allocator(count, csv,
+                    hpx::util::thread_local_caching_allocator<>{},
+                    "caching_allocator");
                 measure_function_futures_register_work(count, csv);
                 measure_function_futures_create_thread(count, csv);
                 measure_function_futures_apply_hierarchical_placement(
                     count, csv);
             }
+            print_allocator_cache_stats(csv);
         }
     }
 
@@ -41,8 +41,9 @@ create_tasks(std::size_t num_tasks, std::size_t delay)
     return tasks;
 }
 
+template <typename F>
 double wait_tasks(std::size_t num_samples, std::size_t num_tasks,
-    std::size_t num_chunks, std::size_t delay)
+    std::size_t num_chunks, std::size_t delay, F&& wait)
 {
     std::size_t num_chunk_tasks = ((num_tasks + num_chunks) / num_chunks) - 1;
     std::size_t last_num_chunk_tasks = num_tasks - (num_chunks - 1) * num_chunk_tasks;
@@ -66,14 +67,14 @@ double wait_tasks(std::size_t num_samples, std::size_t num_tasks,
         hpx::chrono::high_resolution_timer t;
         if (num_chunks == 1)
         {
-            hpx::wait_all(chunks[0]);
+            wait(chunks[0]);
         }
         else
         {
             for (std::size_t c = 0; c != num_chunks; ++c)
             {
                 chunk_results.push_back(
-                    hpx::async([&chunks, c]() { hpx::wait_all(chunks[c]); })
+                    hpx::async([&wait, &chunks, c]() { wait(chunks[c]); })
                 );
             }
             hpx::wait_all(chunk_results);
@@ -84,6 +85,18 @@ double wait_tasks(std::size_t num_samples, std::size_t num_tasks,
     return result / num_samples;
 }
 
+// wait for the futures using wait_all
+void wait_all_tasks(std::vector<hpx::future<void> >& tasks)
+{
+    hpx::wait_all(tasks);
+}
+
+// wait for the futures using the future returned from when_all
+void when_all_tasks(std::vector<hpx::future<void> >& tasks)
+{
+    hpx::when_all(tasks).get();
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -108,37 +121,58 @@ int hpx_main(hpx::program_options::variables_map& vm)
         num_chunks = 1;
 
     // wait for all of the tasks sequentially
-    double elapsed_seq = wait_tasks(num_samples, num_tasks, 1, delay);
+    double elapsed_seq =
+        wait_tasks(num_samples, num_tasks, 1, delay, &wait_all_tasks);
+    double elapsed_when_all_seq =
+        wait_tasks(num_samples, num_tasks, 1, delay, &when_all_tasks);
 
     // wait of tasks in chunks
     double elapsed_chunks = 0;
+    double elapsed_when_all_chunks = 0;
     if (num_chunks != 1)
-        elapsed_chunks = wait_tasks(num_samples, num_tasks, num_chunks, delay);
+    {
+        elapsed_chunks = wait_tasks(
+            num_samples, num_tasks, num_chunks, delay, &wait_all_tasks);
+        elapsed_when_all_chunks = wait_tasks(
+            num_samples, num_tasks, num_chunks, delay, &when_all_tasks);
+    }
 
     if (header)
     {
-        hpx::cout
-            << "Tasks,Chunks,Delay[s],Total Walltime[s],Walltime per Task[s]"
-             << hpx::endl;
+        hpx::cout << "Function,Tasks,Chunks,Delay[s],Total Walltime[s],"
+                     "Walltime per Task[s]"
+                  << hpx::endl;
     }
 
     std::string const tasks_str = hpx::util::format("{}", num_tasks);
     std::string const chunks_str = hpx::util::format("{}", num_chunks);
     std::string const delay_str = hpx::util::format("{}", delay);
 
-    hpx::util::format_to(hpx::cout, "{:10},{:10},{:10},{:10},{:10.12}\n",
-        tasks_str, std::string("1"), delay_str, elapsed_seq,
-        elapsed_seq / num_tasks)
+    hpx::util::format_to(hpx::cout, "{:10},{:10},{:10},{:10},{:10},{:10.12}\n",
+        std::string("wait_all"), tasks_str, std::string("1"), delay_str,
+        elapsed_seq, elapsed_seq / num_tasks)
+        << hpx::endl;
+    hpx::util::format_to(hpx::cout, "{:10},{:10},{:10},{:10},{:10},{:10.12}\n",
+        std::string("when_all"), tasks_str, std::string("1"), delay_str,
+        elapsed_when_all_seq, elapsed_when_all_seq / num_tasks)
         << hpx::endl;
     hpx::util::print_cdash_timing("WaitAll", elapsed_seq / num_tasks);
+    hpx::util::print_cdash_timing("WhenAll", elapsed_when_all_seq / num_tasks);
 
     if (num_chunks != 1)
     {
         hpx::util::format_to(hpx::cout,
-            "{:10},{:10},{:10},{:10},{:10.12},{:10.12}\n",
-            tasks_str, chunks_str, delay_str,
+            "{:10},{:10},{:10},{:10},{:10},{:10.12}\n",
+            std::string("wait_all"), tasks_str, chunks_str, delay_str,
             elapsed_chunks, elapsed_chunks / num_tasks) << hpx::endl;
+        hpx::util::format_to(hpx::cout,
+            "{:10},{:10},{:10},{:10},{:10},{:10.12}\n",
+            std::string("when_all"), tasks_str, chunks_str, delay_str,
+            elapsed_when_all_chunks, elapsed_when_all_chunks / num_tasks)
+            << hpx::endl;
         hpx::util::print_cdash_timing("WaitAllChunks", elapsed_chunks / num_tasks);
+        hpx::util::print_cdash_timing(
+            "WhenAllChunks", elapsed_when_all_chunks / num_tasks);
     }
     return hpx::finalize();
 }
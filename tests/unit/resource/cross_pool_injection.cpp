@@ -286,6 +286,9 @@ int main(int argc, char* argv[])
 #if defined(HPX_HAVE_SHARED_PRIORITY_SCHEDULER)
     // The shared_priority scheduler sometimes hangs in this test.
     //hpx::resource::scheduling_policy::shared_priority,
+#endif
+#if defined(HPX_HAVE_WORK_STEALING_SCHEDULER)
+        hpx::resource::scheduling_policy::work_stealing,
 #endif
     };
 
@@ -81,6 +81,9 @@ int main(int argc, char* argv[])
 #endif
 #if defined(HPX_HAVE_SHARED_PRIORITY_SCHEDULER)
             hpx::resource::scheduling_policy::shared_priority,
+#endif
+#if defined(HPX_HAVE_WORK_STEALING_SCHEDULER)
+            hpx::resource::scheduling_policy::work_stealing,
 #endif
         };
 
@@ -142,6 +142,9 @@ int main(int argc, char* argv[])
 #if defined(HPX_HAVE_ABP_SCHEDULER) && defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
             hpx::resource::scheduling_policy::abp_priority_fifo,
             hpx::resource::scheduling_policy::abp_priority_lifo,
+#endif
+#if defined(HPX_HAVE_WORK_STEALING_SCHEDULER)
+            hpx::resource::scheduling_policy::work_stealing,
 #endif
         };
 